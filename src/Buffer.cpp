@@ -0,0 +1,151 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Buffer.cpp
+ * \brief Contains BufferBase class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Buffer.hpp"
+#include "include/Runner.hpp"
+
+#include <cstring>
+
+using namespace Vulkalc;
+
+BufferBase::BufferBase(Runner* runner, VkDeviceSize size) : m_pRunner(runner), m_size(size),
+                                                            m_vkBuffer(VK_NULL_HANDLE),
+                                                            m_vkDeviceMemory(VK_NULL_HANDLE),
+                                                            m_pMappedMemory(nullptr), m_memoryTypeIndex(0),
+                                                            m_memorySize(0), m_pBufferBytes(nullptr)
+{
+    if (runner == nullptr)
+        throw InvalidArgumentException("Runner is required to create Buffer");
+    if (size == 0)
+        throw InvalidArgumentException("Buffer size must be greater than 0");
+
+    //storage buffers are accessed by uint words in shaders and vkCmdFillBuffer works with words too
+    m_allocatedSize = (size + 3) & ~static_cast<VkDeviceSize>(3);
+    VkDevice device = m_pRunner->getVkDevice();
+
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = m_allocatedSize;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                             VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkResult result = vkCreateBuffer(device, &bufferCreateInfo, nullptr, &m_vkBuffer);
+    if (result != VK_SUCCESS)
+        throw VulkanException(result, "Failed to create VkBuffer");
+
+    VkMemoryRequirements memoryRequirements;
+    vkGetBufferMemoryRequirements(device, m_vkBuffer, &memoryRequirements);
+
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = memoryRequirements.size;
+    try
+    {
+        memoryAllocateInfo.memoryTypeIndex = m_pRunner->findMemoryTypeIndex(memoryRequirements.memoryTypeBits,
+                                                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+    catch (...)
+    {
+        //destructor is not called, if constructor throws
+        vkDestroyBuffer(device, m_vkBuffer, nullptr);
+        throw;
+    }
+    result = vkAllocateMemory(device, &memoryAllocateInfo, nullptr, &m_vkDeviceMemory);
+    if (result == VK_SUCCESS)
+        result = vkBindBufferMemory(device, m_vkBuffer, m_vkDeviceMemory, 0);
+    if (result == VK_SUCCESS)
+        result = vkMapMemory(device, m_vkDeviceMemory, 0, VK_WHOLE_SIZE, 0, &m_pMappedMemory);
+    if (result != VK_SUCCESS)
+    {
+        if (m_vkDeviceMemory != VK_NULL_HANDLE)
+            vkFreeMemory(device, m_vkDeviceMemory, nullptr);
+        vkDestroyBuffer(device, m_vkBuffer, nullptr);
+        throw VulkanException(result, "Failed to allocate device memory for VkBuffer");
+    }
+    m_memoryTypeIndex = memoryAllocateInfo.memoryTypeIndex;
+    m_memorySize = memoryRequirements.size;
+    m_pRunner->getInformationProvider()->trackAllocation(m_memoryTypeIndex, m_memorySize);
+    m_pBufferBytes = m_pRunner->m_instruments.bufferBytes;
+    if (m_pBufferBytes)
+        m_pBufferBytes->add(static_cast<int64_t>(m_allocatedSize));
+}
+
+BufferBase::~BufferBase()
+{
+    if (m_pBufferBytes)
+        m_pBufferBytes->add(-static_cast<int64_t>(m_allocatedSize));
+    VkDevice device = m_pRunner->getVkDevice();
+    if (m_vkDeviceMemory != VK_NULL_HANDLE)
+    {
+        //memory is unmapped implicitly when freed
+        vkFreeMemory(device, m_vkDeviceMemory, nullptr);
+        if (m_pRunner->getInformationProvider())
+            m_pRunner->getInformationProvider()->trackFree(m_memoryTypeIndex, m_memorySize);
+        m_vkDeviceMemory = VK_NULL_HANDLE;
+        m_pMappedMemory = nullptr;
+    }
+    if (m_vkBuffer != VK_NULL_HANDLE)
+    {
+        vkDestroyBuffer(device, m_vkBuffer, nullptr);
+        m_vkBuffer = VK_NULL_HANDLE;
+    }
+}
+
+void BufferBase::write(const void* data, VkDeviceSize size, VkDeviceSize offset)
+{
+    tryWrite(data, size, offset).valueOrThrow();
+}
+
+Expected<void> BufferBase::tryWrite(const void* data, VkDeviceSize size, VkDeviceSize offset)
+{
+    if (offset > m_size || size > m_size - offset)
+        return Error(ERROR_INVALID_ARGUMENT, "Data doesn't fit in Buffer");
+    memcpy(static_cast<char*>(m_pMappedMemory) + offset, data, static_cast<size_t>(size));
+    if (m_pRunner->m_instruments.uploadedBytes)
+        m_pRunner->m_instruments.uploadedBytes->add(size);
+    return Expected<void>();
+}
+
+void BufferBase::read(void* data, VkDeviceSize size, VkDeviceSize offset) const
+{
+    tryRead(data, size, offset).valueOrThrow();
+}
+
+Expected<void> BufferBase::tryRead(void* data, VkDeviceSize size, VkDeviceSize offset) const
+{
+    if (offset > m_size || size > m_size - offset)
+        return Error(ERROR_INVALID_ARGUMENT, "Requested range is out of Buffer");
+    memcpy(data, static_cast<const char*>(m_pMappedMemory) + offset, static_cast<size_t>(size));
+    if (m_pRunner->m_instruments.downloadedBytes)
+        m_pRunner->m_instruments.downloadedBytes->add(size);
+    return Expected<void>();
+}
@@ -0,0 +1,287 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ComputeGraph.cpp
+ * \brief Contains ComputeGraph class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/ComputeGraph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+using namespace Vulkalc;
+
+static const size_t NO_TASK = std::numeric_limits<size_t>::max();
+
+static VkPipelineStageFlags getStage(const Task& task)
+{
+    return task.getType() == Task::TYPE_DISPATCH ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+                                                 : VK_PIPELINE_STAGE_TRANSFER_BIT;
+}
+
+static VkAccessFlags getAccessMask(const Task& task, unsigned access)
+{
+    bool isDispatch = task.getType() == Task::TYPE_DISPATCH;
+    VkAccessFlags mask = 0;
+    if (access & Task::ACCESS_READ)
+        mask |= isDispatch ? VK_ACCESS_SHADER_READ_BIT : VK_ACCESS_TRANSFER_READ_BIT;
+    if (access & Task::ACCESS_WRITE)
+        mask |= isDispatch ? VK_ACCESS_SHADER_WRITE_BIT : VK_ACCESS_TRANSFER_WRITE_BIT;
+    return mask;
+}
+
+ComputeGraph::ComputeGraph() : m_branchCount(0), m_levelCount(0), m_compiledQueueCount(0)
+{
+}
+
+size_t ComputeGraph::add(const Task& task)
+{
+    size_t index = m_tasks.size();
+    m_tasks.push_back(task);
+    m_dependencies.push_back(Dependencies());
+    m_levels.push_back(0);
+    m_branches.push_back(index);
+    ++m_branchCount;
+    m_compiledQueueCount = 0;
+
+    //the same buffer may be bound several times, its accesses are merged
+    std::vector<std::pair<const BufferBase*, unsigned>> accesses;
+    for (size_t i = 0; i < task.getBuffers().size(); ++i)
+    {
+        //bindings skipped by binding by name have no buffer
+        if (task.getBuffers()[i] == nullptr)
+            continue;
+        auto sameBuffer = [&task, i](const std::pair<const BufferBase*, unsigned>& access)
+        {
+            return access.first == task.getBuffers()[i];
+        };
+        auto found = std::find_if(accesses.begin(), accesses.end(), sameBuffer);
+        if (found == accesses.end())
+            accesses.push_back(std::make_pair(task.getBuffers()[i], static_cast<unsigned>(task.getAccesses()[i])));
+        else
+            found->second |= task.getAccesses()[i];
+    }
+
+    for (auto& access : accesses)
+    {
+        auto inserted = m_bufferStates.insert(std::make_pair(access.first, BufferState()));
+        BufferState& state = inserted.first->second;
+        if (inserted.second)
+            state.writer = NO_TASK;
+
+        Edge edge;
+        edge.buffer = access.first;
+        if (state.writer != NO_TASK && ((access.second & Task::ACCESS_READ) || state.readers.empty()))
+        {
+            //read after write or write after write
+            edge.task = state.writer;
+            edge.srcAccessMask = getAccessMask(m_tasks[state.writer], Task::ACCESS_WRITE);
+            edge.dstAccessMask = getAccessMask(task, access.second);
+            addDependency(index, edge);
+        }
+        if (access.second & Task::ACCESS_WRITE)
+        {
+            //write after read needs only execution dependency, readers already depend on previous writer
+            edge.srcAccessMask = 0;
+            edge.dstAccessMask = 0;
+            for (size_t reader : state.readers)
+            {
+                edge.task = reader;
+                addDependency(index, edge);
+            }
+            state.writer = index;
+            state.readers.clear();
+        }
+        else
+        {
+            state.readers.push_back(index);
+        }
+    }
+    m_levelCount = std::max(m_levelCount, m_levels[index] + 1);
+    return index;
+}
+
+void ComputeGraph::addDependency(size_t task, const Edge& edge)
+{
+    Dependencies& dependencies = m_dependencies[task];
+    dependencies.edges.push_back(edge);
+    if (std::find(dependencies.tasks.begin(), dependencies.tasks.end(), edge.task) != dependencies.tasks.end())
+        return;
+
+    dependencies.tasks.push_back(edge.task);
+    m_levels[task] = std::max(m_levels[task], m_levels[edge.task] + 1);
+
+    size_t branch = findBranch(task);
+    size_t dependencyBranch = findBranch(edge.task);
+    if (branch != dependencyBranch)
+    {
+        m_branches[branch] = dependencyBranch;
+        --m_branchCount;
+    }
+}
+
+size_t ComputeGraph::findBranch(size_t task)
+{
+    while (m_branches[task] != task)
+    {
+        m_branches[task] = m_branches[m_branches[task]];
+        task = m_branches[task];
+    }
+    return task;
+}
+
+const std::vector<ComputeGraph::Schedule>& ComputeGraph::compile(uint32_t queueCount)
+{
+    if (queueCount == 0)
+        throw InvalidArgumentException("At least one queue is required to compile ComputeGraph");
+    if (queueCount == m_compiledQueueCount)
+        return m_schedules;
+
+    //the biggest branches are distributed first, each to the least loaded queue
+    std::map<size_t, size_t> branchSizes;
+    for (size_t task = 0; task < m_tasks.size(); ++task)
+        ++branchSizes[findBranch(task)];
+    std::vector<std::pair<size_t, size_t>> branches;
+    for (auto& branchSize : branchSizes)
+        branches.push_back(std::make_pair(branchSize.second, branchSize.first));
+    std::sort(branches.begin(), branches.end(), std::greater<std::pair<size_t, size_t>>());
+
+    size_t usedQueueCount = std::min<size_t>(queueCount, branches.size());
+    std::vector<size_t> queueLoads(usedQueueCount, 0);
+    std::map<size_t, size_t> branchQueues;
+    for (auto& branch : branches)
+    {
+        size_t queue = static_cast<size_t>(std::min_element(queueLoads.begin(), queueLoads.end()) -
+                                           queueLoads.begin());
+        queueLoads[queue] += branch.first;
+        branchQueues[branch.second] = queue;
+    }
+
+    //tasks of the same level never depend on each other, so every non-empty level becomes a step
+    std::vector<std::vector<std::vector<size_t>>> queueLevels(usedQueueCount,
+                                                              std::vector<std::vector<size_t>>(m_levelCount));
+    for (size_t task = 0; task < m_tasks.size(); ++task)
+        queueLevels[branchQueues[findBranch(task)]][m_levels[task]].push_back(task);
+
+    m_schedules.assign(usedQueueCount, Schedule());
+    std::vector<size_t> taskSteps(m_tasks.size());
+    for (size_t queue = 0; queue < usedQueueCount; ++queue)
+    {
+        Schedule& schedule = m_schedules[queue];
+        for (auto& level : queueLevels[queue])
+        {
+            if (level.empty())
+                continue;
+
+            size_t stepIndex = schedule.size();
+            schedule.push_back(Step());
+            Step& step = schedule.back();
+            step.srcStageMask = 0;
+            step.dstStageMask = 0;
+            step.tasks = level;
+            for (size_t task : level)
+            {
+                taskSteps[task] = stepIndex;
+                VkPipelineStageFlags dstStage = getStage(m_tasks[task]);
+                for (auto& edge : m_dependencies[task].edges)
+                {
+                    VkPipelineStageFlags srcStage = getStage(m_tasks[edge.task]);
+
+                    //barrier between tasks already covers dependency, if it includes both stages and buffer accesses
+                    bool isCovered = false;
+                    for (size_t i = taskSteps[edge.task] + 1; i < stepIndex && !isCovered; ++i)
+                    {
+                        const Step& previous = schedule[i];
+                        if ((previous.srcStageMask & srcStage) != srcStage ||
+                            (previous.dstStageMask & dstStage) != dstStage)
+                            continue;
+                        isCovered = edge.srcAccessMask == 0;
+                        for (auto& barrier : previous.bufferBarriers)
+                        {
+                            isCovered = isCovered || (barrier.buffer == edge.buffer &&
+                                                      (barrier.srcAccessMask & edge.srcAccessMask) ==
+                                                      edge.srcAccessMask &&
+                                                      (barrier.dstAccessMask & edge.dstAccessMask) ==
+                                                      edge.dstAccessMask);
+                        }
+                    }
+                    if (isCovered)
+                        continue;
+
+                    step.srcStageMask |= srcStage;
+                    step.dstStageMask |= dstStage;
+                    if (edge.srcAccessMask == 0)
+                        continue;
+                    auto sameBuffer = [&edge](const BufferBarrier& barrier) { return barrier.buffer == edge.buffer; };
+                    auto found = std::find_if(step.bufferBarriers.begin(), step.bufferBarriers.end(), sameBuffer);
+                    if (found == step.bufferBarriers.end())
+                    {
+                        BufferBarrier barrier;
+                        barrier.buffer = edge.buffer;
+                        barrier.srcAccessMask = edge.srcAccessMask;
+                        barrier.dstAccessMask = edge.dstAccessMask;
+                        step.bufferBarriers.push_back(barrier);
+                    }
+                    else
+                    {
+                        found->srcAccessMask |= edge.srcAccessMask;
+                        found->dstAccessMask |= edge.dstAccessMask;
+                    }
+                }
+            }
+        }
+    }
+    m_compiledQueueCount = queueCount;
+    return m_schedules;
+}
+
+size_t ComputeGraph::getPipelineBarrierCount() const
+{
+    size_t count = 0;
+    for (auto& schedule : m_schedules)
+    {
+        for (auto& step : schedule)
+        {
+            if (step.srcStageMask != 0)
+                ++count;
+        }
+    }
+    return count;
+}
+
+size_t ComputeGraph::getBufferBarrierCount() const
+{
+    size_t count = 0;
+    for (auto& schedule : m_schedules)
+    {
+        for (auto& step : schedule)
+            count += step.bufferBarriers.size();
+    }
+    return count;
+}
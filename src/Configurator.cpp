@@ -32,9 +32,197 @@
 #include "include/Configurator.hpp"
 #include "include/Exceptions.h"
 
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
 using namespace Vulkalc;
 
-Configurator::Configurator()
+const char* const Configurator::DEFAULT_SETTINGS_FILE = "vulkalc.ini";
+
+namespace
+{
+    //values are parsed into Setting and assigned only if valid
+    struct Setting
+    {
+        const char* key;
+        bool (* assign)(Configuration& configuration, const char* value, std::list<std::string>& strings);
+    };
+
+    bool parseBool(const char* value, bool& result)
+    {
+        static const char* const TRUE_VALUES[] = {"true", "on", "yes", "1"};
+        static const char* const FALSE_VALUES[] = {"false", "off", "no", "0"};
+        for (size_t i = 0; i < sizeof(TRUE_VALUES) / sizeof(TRUE_VALUES[0]); ++i)
+        {
+            if (strcmp(value, TRUE_VALUES[i]) == 0 || strcmp(value, FALSE_VALUES[i]) == 0)
+            {
+                result = strcmp(value, TRUE_VALUES[i]) == 0;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parseUnsigned(const char* value, uint32_t& result)
+    {
+        if (!isdigit(static_cast<unsigned char>(value[0])))
+            return false;
+        char* end = nullptr;
+        errno = 0;
+        unsigned long long parsed = strtoull(value, &end, 10);
+        if (*end != '\0' || errno == ERANGE || parsed > std::numeric_limits<uint32_t>::max())
+            return false;
+        result = static_cast<uint32_t>(parsed);
+        return true;
+    }
+
+    const char* keep(const char* value, std::list<std::string>& strings)
+    {
+        if (*value == '\0')
+            return nullptr;
+        strings.push_back(value);
+        return strings.back().c_str();
+    }
+
+    std::vector<const char*> keepList(const char* value, std::list<std::string>& strings)
+    {
+        std::vector<const char*> names;
+        std::string list(value);
+        size_t begin = 0;
+        while (begin <= list.size())
+        {
+            size_t end = list.find(',', begin);
+            if (end == std::string::npos)
+                end = list.size();
+            size_t first = list.find_first_not_of(" \t", begin);
+            size_t last = list.find_last_not_of(" \t", end - 1);
+            if (first != std::string::npos && first < end && last != std::string::npos && last >= first)
+            {
+                strings.push_back(list.substr(first, last - first + 1));
+                names.push_back(strings.back().c_str());
+            }
+            begin = end + 1;
+        }
+        return names;
+    }
+
+#define VULKALC_BOOL_SETTING(KEY, FIELD) \
+    {KEY, [](Configuration& configuration, const char* value, std::list<std::string>&) \
+          { return parseBool(value, configuration.FIELD); }}
+#define VULKALC_UNSIGNED_SETTING(KEY, FIELD, IS_ZERO_ALLOWED) \
+    {KEY, [](Configuration& configuration, const char* value, std::list<std::string>&) \
+          { \
+              uint32_t parsed = 0; \
+              if (!parseUnsigned(value, parsed) || (parsed == 0 && !(IS_ZERO_ALLOWED))) \
+                  return false; \
+              configuration.FIELD = parsed; \
+              return true; \
+          }}
+#define VULKALC_STRING_SETTING(KEY, FIELD) \
+    {KEY, [](Configuration& configuration, const char* value, std::list<std::string>& strings) \
+          { \
+              configuration.FIELD = keep(value, strings); \
+              return true; \
+          }}
+
+    const Setting SETTINGS[] = {
+            VULKALC_STRING_SETTING("application_name", applicationName),
+            VULKALC_STRING_SETTING("shaders_directory", shadersDirectory),
+            VULKALC_STRING_SETTING("shader_cache_directory", shaderCacheDirectory),
+            VULKALC_STRING_SETTING("trace_file", traceFile),
+            VULKALC_STRING_SETTING("tuning_file", tuningFile),
+            VULKALC_STRING_SETTING("vulkan_info_file", vulkanInfoFile),
+            {"enabled_layers", [](Configuration& configuration, const char* value, std::list<std::string>& strings)
+            {
+                configuration.enabledLayersNames = keepList(value, strings);
+                return true;
+            }},
+            {"enabled_extensions", [](Configuration& configuration, const char* value,
+                                      std::list<std::string>& strings)
+            {
+                configuration.enabledExtensionsNames = keepList(value, strings);
+                return true;
+            }},
+            {"device", [](Configuration& configuration, const char* value, std::list<std::string>&)
+            {
+                if (strcmp(value, "auto") == 0)
+                {
+                    configuration.isDeviceAutoSelected = true;
+                    return true;
+                }
+                if (!parseUnsigned(value, configuration.deviceToUse))
+                    return false;
+                configuration.isDeviceAutoSelected = false;
+                return true;
+            }},
+            VULKALC_UNSIGNED_SETTING("compute_queue_count", computeQueueCount, false),
+            VULKALC_UNSIGNED_SETTING("descriptor_sets_per_pool", descriptorSetsPerPool, false),
+            VULKALC_BOOL_SETTING("profiling", isProfilingEnabled),
+            VULKALC_BOOL_SETTING("metrics", isMetricsEnabled),
+            VULKALC_BOOL_SETTING("logging", isLoggingEnabled),
+            VULKALC_BOOL_SETTING("error_logging", isErrorLoggingEnabled),
+            VULKALC_BOOL_SETTING("push_descriptors", isPushDescriptorEnabled),
+            VULKALC_BOOL_SETTING("device_benchmark", isDeviceBenchmarkEnabled),
+            {"profile", [](Configuration& configuration, const char* value, std::list<std::string>&)
+            {
+                static const char* const PROFILES[] = {"custom", "debug", "release", "profiling"};
+                for (unsigned i = 0; i < 4; ++i)
+                {
+                    if (strcmp(value, PROFILES[i]) == 0)
+                    {
+                        configuration.profile = static_cast<Configuration::PROFILE>(i);
+                        return true;
+                    }
+                }
+                return false;
+            }},
+            {"min_log_level", [](Configuration& configuration, const char* value, std::list<std::string>&)
+            {
+                static const char* const LEVELS[] = {"info", "warn", "error"};
+                for (unsigned i = 0; i < 3; ++i)
+                {
+                    if (strcmp(value, LEVELS[i]) == 0)
+                    {
+                        configuration.minLogLevel = i;
+                        return true;
+                    }
+                }
+                uint32_t level = 0;
+                if (!parseUnsigned(value, level) || level > 2)
+                    return false;
+                configuration.minLogLevel = level;
+                return true;
+            }}
+    };
+
+#undef VULKALC_BOOL_SETTING
+#undef VULKALC_UNSIGNED_SETTING
+#undef VULKALC_STRING_SETTING
+}
+
+Configurator::Reader::Reader(const Configurator& configurator) : m_configurator(configurator)
+{
+    //counter is incremented before snapshot is loaded, so publish() can't miss this Reader
+    m_configurator.m_readerCount.fetch_add(1);
+    m_pSnapshot = m_configurator.m_pSnapshot.load();
+}
+
+Configurator::Reader::~Reader()
+{
+    //without it snapshots, retired while read, would be kept until next publish()
+    if (m_configurator.m_readerCount.fetch_sub(1) == 1 &&
+        m_configurator.m_hasRetiredSnapshots.load())
+    {
+        std::lock_guard<std::mutex> lock(m_configurator.m_publishMutex);
+        m_configurator.deleteRetiredSnapshots();
+    }
+}
+
+Configurator::Configurator() : m_pSnapshot(nullptr), m_readerCount(0), m_hasRetiredSnapshots(false)
 {
     try
     {
@@ -44,13 +232,105 @@ Configurator::Configurator()
     {
         throw HostMemoryAllocationException("Failed to allocate Configuration in Configurator");
     }
+    //file is per machine, environment is per process, so the latter overrides the former
+    const char* path = getenv("VULKALC_CONFIG_FILE");
+    load(path != nullptr && *path != '\0' ? path : DEFAULT_SETTINGS_FILE);
+    loadEnvironment();
+}
+
+bool Configurator::set(const char* key, const char* value)
+{
+    for (auto& setting : SETTINGS)
+    {
+        if (strcmp(setting.key, key) == 0)
+            return setting.assign(*m_spConfiguration, value, m_strings);
+    }
+    return false;
+}
+
+bool Configurator::load(const char* path)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::string line;
+    for (unsigned lineNumber = 1; std::getline(file, line); ++lineNumber)
+    {
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#' || line[first] == ';' || line[first] == '[')
+            continue;
+        size_t separator = line.find('=', first);
+        size_t keyEnd = separator != std::string::npos ? line.find_last_not_of(" \t", separator - 1) : 0;
+        size_t valueBegin = separator != std::string::npos ? line.find_first_not_of(" \t", separator + 1) : 0;
+        size_t valueEnd = line.find_last_not_of(" \t\r");
+        std::string key = separator != std::string::npos && separator > first ?
+                          line.substr(first, keyEnd - first + 1) : std::string();
+        std::string value = valueBegin != std::string::npos && valueBegin <= valueEnd ?
+                            line.substr(valueBegin, valueEnd - valueBegin + 1) : std::string();
+        if (key.empty() || !set(key.c_str(), value.c_str()))
+            m_loadErrors.push_back(std::string(path) + ":" + std::to_string(lineNumber) + ": invalid setting " +
+                                   line);
+    }
+    return true;
+}
+
+void Configurator::loadEnvironment()
+{
+    for (auto& setting : SETTINGS)
+    {
+        std::string variable = "VULKALC_";
+        for (const char* character = setting.key; *character != '\0'; ++character)
+            variable += static_cast<char>(toupper(static_cast<unsigned char>(*character)));
+        const char* value = getenv(variable.c_str());
+        if (value != nullptr && !setting.assign(*m_spConfiguration, value, m_strings))
+            m_loadErrors.push_back(variable + ": invalid value " + value);
+    }
 }
 
 Configurator::~Configurator()
 {
+    for (const Configuration* snapshot : m_retiredSnapshots)
+        delete snapshot;
+    m_retiredSnapshots.clear();
+    delete m_pSnapshot.load();
     if (m_spConfiguration)
     {
         delete m_spConfiguration;
         m_spConfiguration = nullptr;
     }
 }
+
+const Configuration* Configurator::publish()
+{
+    Configuration* snapshot = nullptr;
+    try
+    {
+        snapshot = new Configuration(*m_spConfiguration);
+    }
+    catch(std::bad_alloc& e)
+    {
+        throw HostMemoryAllocationException("Failed to allocate snapshot of Configuration");
+    }
+
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    const Configuration* previous = m_pSnapshot.exchange(snapshot);
+    if (previous != nullptr)
+    {
+        m_retiredSnapshots.push_back(previous);
+        m_hasRetiredSnapshots.store(true);
+    }
+    deleteRetiredSnapshots();
+    return snapshot;
+}
+
+void Configurator::deleteRetiredSnapshots() const
+{
+    //Readers, which started after exchange, see new snapshot, so retired ones are unreachable without Readers
+    if (m_readerCount.load() != 0)
+        return;
+    for (const Configuration* retired : m_retiredSnapshots)
+        delete retired;
+    m_retiredSnapshots.clear();
+    m_hasRetiredSnapshots.store(false);
+}
@@ -0,0 +1,384 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Context.cpp
+ * \brief Contains Context class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Context.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace Vulkalc;
+
+static const char* const PROFILE_NAMES[] = {"custom", "debug", "release", "profiling"};
+static const char* const VALIDATION_LAYERS[] = {"VK_LAYER_KHRONOS_validation", "VK_LAYER_LUNARG_standard_validation"};
+//Runner enables push descriptors, memory budget and calibrated timestamps only with this extension
+static const char* const RUNNER_INSTANCE_EXTENSIONS[] = {"VK_KHR_get_physical_device_properties2"};
+
+static void addUnique(std::vector<const char*>& names, const char* name)
+{
+    for (const char* existing : names)
+    {
+        if (strcmp(existing, name) == 0)
+            return;
+    }
+    names.push_back(name);
+}
+
+Context::Context() : m_isInitialized(false), m_isConfigured(false), m_pConfigurator(nullptr),
+                     m_pLogStream(nullptr), m_pErrorStream(nullptr), m_pVkApplicationInfo(nullptr),
+                     m_pVkInstanceCreateInfo(nullptr), m_pInstanceConfiguration(nullptr), m_vkInstance(VK_NULL_HANDLE),
+                     m_instanceCreationTime(0), m_pRunner(nullptr), m_pLogger(nullptr), m_pMetrics(nullptr)
+{
+    init();
+}
+
+Context::~Context()
+{
+    release();
+}
+
+void Context::init()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isInitialized)
+        return;
+
+    m_pConfigurator = new Configurator();
+    m_isInitialized = true;
+}
+
+void Context::configure() throw(ApplicationNotInitializedException, HostMemoryAllocationException,
+                                VulkanException, InvalidArgumentException)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isInitialized)
+        throw ApplicationNotInitializedException();
+    if (m_isConfigured)
+        return;
+
+    try
+    {
+        //profile changes only lists of layers and extensions and profiling flag of published snapshot
+        const Configuration* published = m_pConfigurator->publish();
+        VulkanInfo* vulkanInfo = VulkanInfo::getInstance();
+        if (published->vulkanInfoFile != nullptr)
+            vulkanInfo->load(published->vulkanInfoFile);
+        std::vector<const char*> layers;
+        std::vector<const char*> extensions;
+        selectInstanceProfile(*published, layers, extensions);
+        m_pInstanceConfiguration = new Configuration(*published);
+        m_pInstanceConfiguration->enabledLayersNames = layers;
+        m_pInstanceConfiguration->enabledExtensionsNames = extensions;
+        if (published->profile == Configuration::PROFILE_PROFILING)
+            m_pInstanceConfiguration->isProfilingEnabled = true;
+        const Configuration* configuration = m_pInstanceConfiguration;
+        m_pLogStream = configuration->logStream;
+        m_pErrorStream = configuration->errorStream;
+
+        //filling in VkApplicationInfo
+        prepareVulkanApplicationInfo(configuration);
+        if (m_pVkApplicationInfo == nullptr)
+            throw HostMemoryAllocationException("Failed to allocate memory for VkApplicationInfo");
+        //filling in VkInstanceCreateInfo
+        prepareVulkanInstanceInfo(configuration);
+        if (m_pVkInstanceCreateInfo == nullptr)
+            throw HostMemoryAllocationException("Failed to allocate memory for VkInstanceCreateInfo");
+
+        if (configuration->isLoggingEnabled && (m_pLogStream || m_pErrorStream))
+        {
+            std::string prefix = std::string(m_pVkApplicationInfo->pApplicationName) + " from " +
+                                 m_pVkApplicationInfo->pEngineName + " ";
+            std::iostream* errorStream = m_pErrorStream ? m_pErrorStream : m_pLogStream;
+            m_pLogger = new Logger(prefix, m_pLogStream,
+                                   configuration->isErrorLoggingEnabled ? errorStream : nullptr);
+            for (auto& error : m_pConfigurator->getLoadErrors())
+                m_pLogger->log(Logger::LEVEL_WARN, error.c_str());
+        }
+
+        if (configuration->isMetricsEnabled)
+            m_pMetrics = new Metrics();
+
+        auto instanceCreationBegin = std::chrono::steady_clock::now();
+        bool isSnapshotStale = false;
+        try
+        {
+            createVulkanInstance();
+        }
+        catch (VulkanException& exception)
+        {
+            //layers or extensions may be removed after snapshot was saved, so loader is asked again
+            if (published->vulkanInfoFile == nullptr || published->profile == Configuration::PROFILE_CUSTOM ||
+                (exception.getResult() != VK_ERROR_LAYER_NOT_PRESENT &&
+                 exception.getResult() != VK_ERROR_EXTENSION_NOT_PRESENT))
+                throw;
+            VulkanInfo freshVulkanInfo;
+            selectInstanceProfile(*published, freshVulkanInfo, layers, extensions);
+            m_pInstanceConfiguration->enabledLayersNames = layers;
+            m_pInstanceConfiguration->enabledExtensionsNames = extensions;
+            delete m_pVkInstanceCreateInfo;
+            prepareVulkanInstanceInfo(configuration);
+            if (m_pVkInstanceCreateInfo == nullptr)
+                throw HostMemoryAllocationException("Failed to allocate memory for VkInstanceCreateInfo");
+            createVulkanInstance();
+            isSnapshotStale = true;
+        }
+        m_instanceCreationTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                                           instanceCreationBegin).count();
+        if (m_pMetrics)
+            m_pMetrics->getGauge("vulkalc_instance_creation_microseconds",
+                                 "Time of vkCreateInstance with layers and extensions of profile")
+                    .set(static_cast<int64_t>(m_instanceCreationTime * 1000));
+        if (m_pLogger)
+            VULKALC_LOG_INFO(m_pLogger, "VkInstance created",
+                             Logger::Field("profile", PROFILE_NAMES[configuration->profile]),
+                             Logger::Field("layers", configuration->enabledLayersNames.size()),
+                             Logger::Field("extensions", configuration->enabledExtensionsNames.size()),
+                             Logger::Field("milliseconds", m_instanceCreationTime));
+        m_pRunner = new Runner(m_vkInstance, configuration);
+        m_pRunner->setLogger(m_pLogger);
+        m_pRunner->setMetrics(m_pMetrics);
+        //snapshot is only a cache, so failure to write it isn't an error, stale one is written again by next process
+        if (configuration->vulkanInfoFile != nullptr && isSnapshotStale)
+            remove(configuration->vulkanInfoFile);
+        else if (configuration->vulkanInfoFile != nullptr && vulkanInfo->isModified())
+            vulkanInfo->save(configuration->vulkanInfoFile);
+    }
+    catch (...)
+    {
+        releaseConfiguration();
+        throw;
+    }
+    //readers on other threads see Context configured only when everything is created
+    m_isConfigured = true;
+}
+
+void Context::reconfigure()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isInitialized)
+        throw ApplicationNotInitializedException();
+    if (!m_isConfigured)
+        throw ApplicationNotConfiguredException();
+
+    const Configuration* configuration = m_pConfigurator->publish();
+    m_pRunner->setProfilingEnabled(configuration->isProfilingEnabled);
+}
+
+void Context::selectInstanceProfile(const Configuration& configuration, std::vector<const char*>& layers,
+                                    std::vector<const char*>& extensions)
+{
+    selectInstanceProfile(configuration, *VulkanInfo::getInstance(), layers, extensions);
+}
+
+void Context::selectInstanceProfile(const Configuration& configuration, VulkanInfo& vulkanInfo,
+                                    std::vector<const char*>& layers, std::vector<const char*>& extensions)
+{
+    layers.clear();
+    extensions.clear();
+    if (configuration.profile == Configuration::PROFILE_CUSTOM)
+    {
+        layers = configuration.enabledLayersNames;
+        extensions = configuration.enabledExtensionsNames;
+        return;
+    }
+
+    //loading of every layer adds overhead to every Vulkan call, so only debug profile has them
+    if (configuration.profile == Configuration::PROFILE_DEBUG)
+    {
+        for (const char* layer : VALIDATION_LAYERS)
+        {
+            if (vulkanInfo.isLayerSupported(layer))
+            {
+                layers.push_back(layer);
+                break;
+            }
+        }
+        for (const char* layer : configuration.enabledLayersNames)
+        {
+            if (vulkanInfo.isLayerSupported(layer))
+                addUnique(layers, layer);
+        }
+    }
+    for (const char* extension : RUNNER_INSTANCE_EXTENSIONS)
+    {
+        if (vulkanInfo.isInstanceExtensionSupported(extension))
+            extensions.push_back(extension);
+    }
+    for (const char* extension : configuration.enabledExtensionsNames)
+    {
+        if (vulkanInfo.isInstanceExtensionSupported(extension))
+            addUnique(extensions, extension);
+    }
+}
+
+Runner* const Context::getRunner()
+{
+    if (!m_isInitialized)
+        throw ApplicationNotInitializedException();
+    if (!m_isConfigured)
+        throw ApplicationNotConfiguredException();
+
+    return m_pRunner;
+}
+
+void Context::release()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isInitialized = false;
+    m_isConfigured = false;
+    releaseConfiguration();
+    if (m_pConfigurator)
+    {
+        delete m_pConfigurator;
+        m_pConfigurator = nullptr;
+    }
+}
+
+void Context::releaseConfiguration()
+{
+    if (m_pRunner)
+    {
+        delete m_pRunner;
+        m_pRunner = nullptr;
+    }
+    if (m_vkInstance != VK_NULL_HANDLE)
+    {
+        vkDestroyInstance(m_vkInstance, nullptr);
+        m_vkInstance = VK_NULL_HANDLE;
+    }
+    if (m_pVkApplicationInfo)
+    {
+        delete m_pVkApplicationInfo;
+        m_pVkApplicationInfo = nullptr;
+    }
+    if (m_pVkInstanceCreateInfo)
+    {
+        delete m_pVkInstanceCreateInfo;
+        m_pVkInstanceCreateInfo = nullptr;
+    }
+    if (m_pInstanceConfiguration)
+    {
+        delete m_pInstanceConfiguration;
+        m_pInstanceConfiguration = nullptr;
+    }
+    m_instanceCreationTime = 0;
+    if (m_pLogger)
+    {
+        delete m_pLogger;
+        m_pLogger = nullptr;
+    }
+    if (m_pMetrics)
+    {
+        delete m_pMetrics;
+        m_pMetrics = nullptr;
+    }
+    m_pLogStream = nullptr;
+    m_pErrorStream = nullptr;
+}
+
+void Context::log(const char* message, Context::LOG_LEVEL level)
+{
+    if (!m_isInitialized)
+        throw ApplicationNotInitializedException();
+    if (!m_isConfigured)
+        throw ApplicationNotConfiguredException();
+    if (level < VULKALC_MIN_LOG_LEVEL || m_pLogger == nullptr)
+        return;
+
+    //snapshot may be replaced by reconfigure() meanwhile, Reader keeps the one read here alive
+    Configurator::Reader configuration(*m_pConfigurator);
+    if (!configuration->isLoggingEnabled || static_cast<unsigned>(level) < configuration->minLogLevel)
+        return;
+
+    //only copies message, formatting and writing to stream happen on logger thread
+    m_pLogger->log(static_cast<Logger::LEVEL>(level), message);
+}
+
+void Context::prepareVulkanApplicationInfo(const Configuration* configuration)
+{
+    try
+    {
+        m_pVkApplicationInfo = new VkApplicationInfo();
+    }
+    catch (std::bad_alloc& e)
+    {
+        m_pVkApplicationInfo = nullptr;
+        return;
+    }
+
+    m_pVkApplicationInfo->apiVersion = configuration->apiVersion;
+    m_pVkApplicationInfo->engineVersion = configuration->engineVersion;
+    m_pVkApplicationInfo->applicationVersion = configuration->applicationVersion;
+    m_pVkApplicationInfo->pApplicationName = configuration->applicationName;
+    m_pVkApplicationInfo->pEngineName = configuration->engineName;
+    m_pVkApplicationInfo->pNext = nullptr;
+    m_pVkApplicationInfo->sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+}
+
+void Context::prepareVulkanInstanceInfo(const Configuration* configuration)
+{
+    try
+    {
+        m_pVkInstanceCreateInfo = new VkInstanceCreateInfo();
+    }
+    catch (std::bad_alloc& e)
+    {
+        m_pVkInstanceCreateInfo = nullptr;
+        return;
+    }
+    m_pVkInstanceCreateInfo->sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    m_pVkInstanceCreateInfo->pNext = nullptr;
+    m_pVkInstanceCreateInfo->flags = 0;
+    m_pVkInstanceCreateInfo->enabledExtensionCount = static_cast<uint32_t>(configuration->enabledExtensionsNames
+            .size());
+    m_pVkInstanceCreateInfo->enabledLayerCount = static_cast<uint32_t>(configuration->enabledLayersNames.size());
+    m_pVkInstanceCreateInfo->pApplicationInfo = m_pVkApplicationInfo;
+
+    if (configuration->enabledExtensionsNames.size() > 0)
+        m_pVkInstanceCreateInfo->ppEnabledExtensionNames = &configuration->enabledExtensionsNames[0];
+    else
+        m_pVkInstanceCreateInfo->ppEnabledExtensionNames = nullptr;
+
+    if (configuration->enabledLayersNames.size() > 0)
+        m_pVkInstanceCreateInfo->ppEnabledLayerNames = &configuration->enabledLayersNames[0];
+    else
+        m_pVkInstanceCreateInfo->ppEnabledLayerNames = nullptr;
+}
+
+void Context::createVulkanInstance()
+{
+    VkResult result = vkCreateInstance(m_pVkInstanceCreateInfo, nullptr, &m_vkInstance);
+    if (result != VK_SUCCESS)
+    {
+        m_vkInstance = VK_NULL_HANDLE;
+        throw VulkanException(result, "Failed to create VkInstance");
+    }
+}
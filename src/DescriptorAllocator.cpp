@@ -0,0 +1,120 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file DescriptorAllocator.cpp
+ * \brief Contains DescriptorAllocator class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/DescriptorAllocator.hpp"
+
+using namespace Vulkalc;
+
+DescriptorAllocator::DescriptorAllocator(VkDevice device, uint32_t setsPerPool) : m_vkDevice(device),
+                                                                                  m_setsPerPool(setsPerPool)
+{
+    if (setsPerPool == 0)
+        throw InvalidArgumentException("Descriptor pool must have at least one descriptor set");
+    m_statistics.allocationCount = 0;
+    m_statistics.poolCount = 0;
+    m_statistics.resetCount = 0;
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+    for (auto& layoutPools : m_pools)
+    {
+        for (VkDescriptorPool pool : layoutPools.second.pools)
+            vkDestroyDescriptorPool(m_vkDevice, pool, nullptr);
+    }
+    m_pools.clear();
+}
+
+VkDescriptorSet DescriptorAllocator::allocate(VkDescriptorSetLayout layout, uint32_t bindingCount)
+{
+    auto inserted = m_pools.insert(std::make_pair(bindingCount, Pools()));
+    Pools& pools = inserted.first->second;
+    if (inserted.second)
+    {
+        pools.currentPool = 0;
+        pools.allocatedSetCount = 0;
+    }
+
+    if (pools.allocatedSetCount == m_setsPerPool)
+    {
+        ++pools.currentPool;
+        pools.allocatedSetCount = 0;
+    }
+    if (pools.currentPool == pools.pools.size())
+    {
+        VkDescriptorPoolSize poolSize = {};
+        poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSize.descriptorCount = m_setsPerPool * bindingCount;
+
+        VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
+        descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        descriptorPoolCreateInfo.maxSets = m_setsPerPool;
+        descriptorPoolCreateInfo.poolSizeCount = 1;
+        descriptorPoolCreateInfo.pPoolSizes = &poolSize;
+        VkDescriptorPool pool = VK_NULL_HANDLE;
+        VkResult result = vkCreateDescriptorPool(m_vkDevice, &descriptorPoolCreateInfo, nullptr, &pool);
+        if (result != VK_SUCCESS)
+            throw VulkanException(result, "Failed to create VkDescriptorPool");
+        pools.pools.push_back(pool);
+        ++m_statistics.poolCount;
+    }
+
+    VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+    descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descriptorSetAllocateInfo.descriptorPool = pools.pools[pools.currentPool];
+    descriptorSetAllocateInfo.descriptorSetCount = 1;
+    descriptorSetAllocateInfo.pSetLayouts = &layout;
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    VkResult result = vkAllocateDescriptorSets(m_vkDevice, &descriptorSetAllocateInfo, &descriptorSet);
+    if (result != VK_SUCCESS)
+        throw VulkanException(result, "Failed to allocate VkDescriptorSet");
+    ++pools.allocatedSetCount;
+    ++m_statistics.allocationCount;
+    return descriptorSet;
+}
+
+void DescriptorAllocator::reset()
+{
+    for (auto& layoutPools : m_pools)
+    {
+        Pools& pools = layoutPools.second;
+        //pools after current one have nothing allocated
+        for (size_t i = 0; i <= pools.currentPool && i < pools.pools.size(); ++i)
+        {
+            VkResult result = vkResetDescriptorPool(m_vkDevice, pools.pools[i], 0);
+            if (result != VK_SUCCESS)
+                throw VulkanException(result, "Failed to reset VkDescriptorPool");
+        }
+        pools.currentPool = 0;
+        pools.allocatedSetCount = 0;
+    }
+    ++m_statistics.resetCount;
+}
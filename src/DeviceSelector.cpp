@@ -0,0 +1,316 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file DeviceSelector.cpp
+ * \brief Contains DeviceSelector class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/DeviceSelector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+using namespace Vulkalc;
+
+const char* const DeviceSelector::DEVICE_KERNEL = "device";
+const char* const DeviceSelector::COPY_BANDWIDTH_PARAMETER = "copyBandwidth";
+
+static const VkDeviceSize BENCHMARK_BUFFER_SIZE = 16 << 20;
+static const uint32_t BENCHMARK_COPY_COUNT = 8;
+
+/*
+ * Objects of copy benchmark, destroyed in reverse order of creation
+ */
+struct CopyBenchmark
+{
+    VkDevice device = VK_NULL_HANDLE;
+    VkBuffer buffers[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+
+    ~CopyBenchmark()
+    {
+        if (device == VK_NULL_HANDLE)
+            return;
+        if (fence != VK_NULL_HANDLE)
+            vkDestroyFence(device, fence, nullptr);
+        if (commandPool != VK_NULL_HANDLE)
+            vkDestroyCommandPool(device, commandPool, nullptr);
+        for (VkBuffer buffer : buffers)
+        {
+            if (buffer != VK_NULL_HANDLE)
+                vkDestroyBuffer(device, buffer, nullptr);
+        }
+        if (memory != VK_NULL_HANDLE)
+            vkFreeMemory(device, memory, nullptr);
+        vkDestroyDevice(device, nullptr);
+    }
+};
+
+static uint32_t findComputeQueueFamily(const VulkanInfo::PhysicalDeviceInfo& info)
+{
+    for (uint32_t i = 0; i < info.queueFamilies.size(); ++i)
+    {
+        if (info.queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT)
+            return i;
+    }
+    return std::numeric_limits<uint32_t>::max();
+}
+
+uint64_t DeviceSelector::getScore(const VulkanInfo::PhysicalDeviceInfo& info)
+{
+    if (findComputeQueueFamily(info) == std::numeric_limits<uint32_t>::max())
+        return 0;
+
+    //type decides first, software and integrated devices lose to discrete ones regardless of limits
+    uint64_t typeRank = 1;
+    switch (info.properties.deviceType)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+            typeRank = 5;
+            break;
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+            typeRank = 4;
+            break;
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+            typeRank = 3;
+            break;
+        case VK_PHYSICAL_DEVICE_TYPE_OTHER:
+            typeRank = 2;
+            break;
+        default:
+            break;
+    }
+
+    VkDeviceSize localMemorySize = 0;
+    for (uint32_t i = 0; i < info.memoryProperties.memoryHeapCount; ++i)
+    {
+        if (info.memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            localMemorySize = std::max(localMemorySize, info.memoryProperties.memoryHeaps[i].size);
+    }
+    const VkPhysicalDeviceLimits& limits = info.properties.limits;
+    uint64_t computeLimits = static_cast<uint64_t>(limits.maxComputeWorkGroupInvocations) *
+                             (limits.maxComputeSharedMemorySize >> 10);
+
+    //every component gets its own bits, so each one only breaks ties of previous ones
+    const uint64_t componentMask = (1ull << 24) - 1;
+    return typeRank << 48 | std::min<uint64_t>(localMemorySize >> 20, componentMask) << 24 |
+           std::min(computeLimits, componentMask);
+}
+
+uint32_t DeviceSelector::measureCopyBandwidth(VkPhysicalDevice physicalDevice)
+{
+    const VulkanInfo::PhysicalDeviceInfo& info = VulkanInfo::getInstance()->getPhysicalDeviceInfo(physicalDevice);
+    uint32_t queueFamilyIndex = findComputeQueueFamily(info);
+    if (queueFamilyIndex == std::numeric_limits<uint32_t>::max())
+        return 0;
+
+    CopyBenchmark benchmark;
+    float queuePriority = 1.0f;
+    VkDeviceQueueCreateInfo queueCreateInfo = {};
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueFamilyIndex = queueFamilyIndex;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+    VkDeviceCreateInfo deviceCreateInfo = {};
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    if (vkCreateDevice(physicalDevice, &deviceCreateInfo, nullptr, &benchmark.device) != VK_SUCCESS)
+        return 0;
+    VkDevice device = benchmark.device;
+    VkQueue queue = VK_NULL_HANDLE;
+    vkGetDeviceQueue(device, queueFamilyIndex, 0, &queue);
+
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = BENCHMARK_BUFFER_SIZE;
+    bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    for (VkBuffer& buffer : benchmark.buffers)
+    {
+        if (vkCreateBuffer(device, &bufferCreateInfo, nullptr, &buffer) != VK_SUCCESS)
+            return 0;
+    }
+
+    //both buffers share one allocation, device local memory is preferred
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, benchmark.buffers[0], &requirements);
+    VkDeviceSize offset = (requirements.size + requirements.alignment - 1) / requirements.alignment *
+                          requirements.alignment;
+    uint32_t memoryTypeIndex = std::numeric_limits<uint32_t>::max();
+    for (uint32_t i = 0; i < info.memoryProperties.memoryTypeCount; ++i)
+    {
+        if (!(requirements.memoryTypeBits & (1u << i)))
+            continue;
+        if (memoryTypeIndex == std::numeric_limits<uint32_t>::max() ||
+            (info.memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))
+            memoryTypeIndex = i;
+        if (info.memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+            break;
+    }
+    if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+        return 0;
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.allocationSize = offset + requirements.size;
+    allocateInfo.memoryTypeIndex = memoryTypeIndex;
+    if (vkAllocateMemory(device, &allocateInfo, nullptr, &benchmark.memory) != VK_SUCCESS ||
+        vkBindBufferMemory(device, benchmark.buffers[0], benchmark.memory, 0) != VK_SUCCESS ||
+        vkBindBufferMemory(device, benchmark.buffers[1], benchmark.memory, offset) != VK_SUCCESS)
+        return 0;
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndex;
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    if (vkCreateCommandPool(device, &commandPoolCreateInfo, nullptr, &benchmark.commandPool) != VK_SUCCESS ||
+        vkCreateFence(device, &fenceCreateInfo, nullptr, &benchmark.fence) != VK_SUCCESS)
+        return 0;
+    commandBufferAllocateInfo.commandPool = benchmark.commandPool;
+    if (vkAllocateCommandBuffers(device, &commandBufferAllocateInfo, &commandBuffer) != VK_SUCCESS)
+        return 0;
+
+    //copies go back and forth, so every copy waits for previous one like in real chains of Tasks
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    VkBufferCopy region = {0, 0, BENCHMARK_BUFFER_SIZE};
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
+        return 0;
+    for (uint32_t i = 0; i < BENCHMARK_COPY_COUNT; ++i)
+    {
+        vkCmdCopyBuffer(commandBuffer, benchmark.buffers[i % 2], benchmark.buffers[1 - i % 2], 1, &region);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                             &barrier, 0, nullptr, 0, nullptr);
+    }
+    if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
+        return 0;
+
+    //first submission warms up clocks and page tables, only second one is measured
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+    double seconds = 0;
+    for (int submission = 0; submission < 2; ++submission)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        if (vkQueueSubmit(queue, 1, &submitInfo, benchmark.fence) != VK_SUCCESS ||
+            vkWaitForFences(device, 1, &benchmark.fence, VK_TRUE,
+                            std::numeric_limits<uint64_t>::max()) != VK_SUCCESS ||
+            vkResetFences(device, 1, &benchmark.fence) != VK_SUCCESS)
+            return 0;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    }
+
+    double bandwidth = static_cast<double>(BENCHMARK_BUFFER_SIZE >> 20) * BENCHMARK_COPY_COUNT /
+                       std::max(seconds, 1e-9);
+    return static_cast<uint32_t>(std::max(1.0, std::min(bandwidth, 4294967295.0)));
+}
+
+VkPhysicalDevice DeviceSelector::select(VkInstance instance, const char* tuningFile, bool isBenchmarkEnabled)
+{
+    uint32_t deviceCount = 0;
+    VkResult result = vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
+    if (result != VK_SUCCESS)
+        throw VulkanException(result, "Failed to enumerate physical devices");
+    std::vector<VkPhysicalDevice> devices(deviceCount);
+    result = vkEnumeratePhysicalDevices(instance, &deviceCount, devices.data());
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+        throw VulkanException(result, "Failed to enumerate physical devices");
+    devices.resize(deviceCount);
+
+    TuningDatabase tuningDatabase;
+    if (tuningFile != nullptr)
+        tuningDatabase.load(tuningFile);
+    bool isMeasured = false;
+    VkPhysicalDevice selectedDevice = VK_NULL_HANDLE;
+    uint32_t selectedBandwidth = 0;
+    uint64_t selectedScore = 0;
+    for (VkPhysicalDevice device : devices)
+    {
+        const VulkanInfo::PhysicalDeviceInfo& info = VulkanInfo::getInstance()->getPhysicalDeviceInfo(device);
+        uint64_t score = getScore(info);
+        if (score == 0)
+            continue;
+
+        //bandwidth is ignored without benchmark, as cached values may exist only for some devices
+        uint32_t bandwidth = 0;
+        if (isBenchmarkEnabled)
+        {
+            std::string deviceKey = TuningDatabase::getDeviceKey(info.properties);
+            TuningDatabase::KernelParameters parameters = tuningDatabase.getKernelParameters(deviceKey);
+            uint32_t& cachedBandwidth = parameters[DEVICE_KERNEL][COPY_BANDWIDTH_PARAMETER];
+            if (cachedBandwidth == 0)
+            {
+                //device, which failed benchmark, is measured again next time and loses to measured devices
+                cachedBandwidth = measureCopyBandwidth(device);
+                if (cachedBandwidth != 0)
+                {
+                    tuningDatabase.setKernelParameters(deviceKey, parameters);
+                    isMeasured = true;
+                }
+            }
+            bandwidth = cachedBandwidth;
+        }
+        if (selectedDevice == VK_NULL_HANDLE || bandwidth > selectedBandwidth ||
+            (bandwidth == selectedBandwidth && score > selectedScore))
+        {
+            selectedDevice = device;
+            selectedBandwidth = bandwidth;
+            selectedScore = score;
+        }
+    }
+    if (selectedDevice == VK_NULL_HANDLE)
+        throw InvalidArgumentException("There is no physical device with compute support");
+
+    //cache is optional, so failure to write it isn't an error
+    if (isMeasured && tuningFile != nullptr)
+    {
+        try
+        {
+            tuningDatabase.save(tuningFile);
+        }
+        catch (InvalidArgumentException&)
+        {
+        }
+    }
+    return selectedDevice;
+}
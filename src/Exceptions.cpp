@@ -31,18 +31,52 @@
 
 #include "include/Exceptions.h"
 
+#include <cstdio>
+
 using namespace Vulkalc;
 
-Exception::Exception(const char* message) : m_message(message)
+static const char* const EXCEPTION_PREFIX = "Exception in Vulkalc Application";
+
+Exception::Exception() : m_errorCode(ERROR_UNKNOWN)
 {
-    if(message != nullptr)
-    {
-        m_exception_message.append(": ");
-        m_exception_message.append(m_message);
-    }
+    snprintf(m_exceptionMessage, MAX_MESSAGE_LENGTH, "%s", EXCEPTION_PREFIX);
+}
+
+Exception::Exception(const char* message, ErrorCode code) : m_errorCode(code)
+{
+    //fixed buffer instead of std::string, exceptions are also thrown when host is out of memory
+    if (message != nullptr)
+        snprintf(m_exceptionMessage, MAX_MESSAGE_LENGTH, "%s: %s", EXCEPTION_PREFIX, message);
+    else
+        snprintf(m_exceptionMessage, MAX_MESSAGE_LENGTH, "%s", EXCEPTION_PREFIX);
 }
 
 const char* Exception::what() const
 {
-    return m_exception_message.c_str();
+    return m_exceptionMessage;
+}
+
+void Vulkalc::throwError(const Error& error)
+{
+    switch (error.code)
+    {
+        case ERROR_APPLICATION_NOT_INITIALIZED:
+            throw ApplicationNotInitializedException();
+        case ERROR_APPLICATION_NOT_CONFIGURED:
+            throw ApplicationNotConfiguredException();
+        case ERROR_HOST_MEMORY_ALLOCATION:
+            throw HostMemoryAllocationException(error.message);
+        case ERROR_VULKAN:
+            throw VulkanException(error.result, error.message);
+        case ERROR_INVALID_ARGUMENT:
+            throw InvalidArgumentException(error.message);
+        case ERROR_SHADER_LOADING:
+            throw ShaderLoadingException(error.message);
+        case ERROR_SHADER_COMPILATION:
+            throw ShaderCompilationException(error.message);
+        case ERROR_SHADER_VERIFICATION:
+            throw ShaderVerificationException(error.message);
+        default:
+            throw Exception(error.message);
+    }
 }
@@ -0,0 +1,134 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Expression.cpp
+ * \brief Contains ExpressionProgram class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Expression.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace Vulkalc;
+
+//every invocation evaluates at least this number of elements
+static const uint32_t ELEMENTS_PER_INVOCATION = 4;
+//instructions are packed by 4 into 32-bit specialization constants
+static const uint32_t INSTRUCTIONS_PER_WORD = 4;
+
+struct ExpressionParameters
+{
+    uint32_t count;
+    uint32_t constants[ExpressionProgram::MAX_CONSTANTS];
+};
+
+void ExpressionProgram::pushInstruction(OPCODE opcode, uint32_t argument, int stackChange)
+{
+    if (m_instructions.size() >= MAX_INSTRUCTIONS)
+        throw InvalidArgumentException("Expression has too many operations");
+    if (stackChange < 0 && m_stackDepth < static_cast<uint32_t>(1 - stackChange))
+        throw InvalidArgumentException("Expression operation lacks operands");
+    if (stackChange > 0 && m_stackDepth >= MAX_STACK_DEPTH)
+        throw InvalidArgumentException("Expression is nested too deeply");
+
+    m_stackDepth = static_cast<uint32_t>(static_cast<int>(m_stackDepth) + stackChange);
+    m_instructions.push_back(static_cast<uint8_t>((opcode << 4) | argument));
+}
+
+void ExpressionProgram::pushOperand(const BufferBase* buffer, size_t count)
+{
+    auto operand = std::find(m_operands.begin(), m_operands.end(), buffer);
+    if (operand == m_operands.end())
+    {
+        if (m_operands.size() >= MAX_OPERANDS)
+            throw InvalidArgumentException("Expression has too many buffers");
+        operand = m_operands.insert(m_operands.end(), buffer);
+    }
+    m_minOperandCount = std::min(m_minOperandCount, count);
+    pushInstruction(OPCODE_LOAD, static_cast<uint32_t>(operand - m_operands.begin()), 1);
+}
+
+void ExpressionProgram::pushConstant(uint32_t bits)
+{
+    if (m_constants.size() >= MAX_CONSTANTS)
+        throw InvalidArgumentException("Expression has too many constants");
+
+    m_constants.push_back(bits);
+    pushInstruction(OPCODE_CONSTANT, static_cast<uint32_t>(m_constants.size() - 1), 1);
+}
+
+void ExpressionProgram::pushOperation(OPCODE opcode)
+{
+    pushInstruction(opcode, 0, opcode == OPCODE_NEGATE ? 0 : -1);
+}
+
+Task ExpressionProgram::createTask(const char* shaderName, const BufferBase& output, size_t count) const
+{
+    if (m_instructions.empty() || m_stackDepth != 1)
+        throw InvalidArgumentException("Expression is incomplete");
+    if (count > m_minOperandCount)
+        throw InvalidArgumentException("Buffers of expression are smaller than output buffer");
+    if (count > std::numeric_limits<uint32_t>::max())
+        throw InvalidArgumentException("Expression supports up to 2^32 - 1 elements");
+
+    Runner* runner = output.getRunner();
+    ExpressionParameters parameters = {};
+    parameters.count = static_cast<uint32_t>(count);
+    std::copy(m_constants.begin(), m_constants.end(), parameters.constants);
+
+    uint32_t workgroupSize = runner->getKernelWorkgroupSize(shaderName);
+    uint32_t elementsPerInvocation = runner->getKernelParameter(shaderName, "itemsPerInvocation",
+                                                                ELEMENTS_PER_INVOCATION);
+    Task task(runner->getShaderLoader()->loadBuiltin(shaderName),
+              runner->getGroupCount(count, workgroupSize, elementsPerInvocation));
+    task.setPushConstants(parameters)
+            .setSpecializationConstant(0, workgroupSize)
+            .setSpecializationConstant(1, static_cast<uint32_t>(m_instructions.size()));
+    for (uint32_t word = 0; word < MAX_INSTRUCTIONS / INSTRUCTIONS_PER_WORD; ++word)
+    {
+        uint32_t packed = 0;
+        for (uint32_t i = 0; i < INSTRUCTIONS_PER_WORD; ++i)
+        {
+            size_t index = word * INSTRUCTIONS_PER_WORD + i;
+            if (index < m_instructions.size())
+                packed |= static_cast<uint32_t>(m_instructions[index]) << (8 * i);
+        }
+        task.setSpecializationConstant(2 + word, packed);
+    }
+
+    //fused shader always has MAX_OPERANDS inputs, unused ones are bound to output buffer and never read
+    task.bind(output, Task::ACCESS_WRITE);
+    for (uint32_t i = 0; i < MAX_OPERANDS; ++i)
+    {
+        if (i < m_operands.size())
+            task.bind(*m_operands[i], Task::ACCESS_READ);
+        else
+            task.bind(output, Task::ACCESS_WRITE);
+    }
+    return task;
+}
@@ -0,0 +1,138 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Histogram.cpp
+ * \brief Contains Histogram class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Histogram.hpp"
+
+#include <limits>
+
+using namespace Vulkalc;
+
+//every thread counts at least this number of values, so merging of shared bins is amortized
+static const uint32_t VALUES_PER_INVOCATION = 16;
+
+struct HistogramParameters
+{
+    uint32_t count;
+    uint32_t binCount;
+    float minValue;
+    float scale;
+};
+
+Histogram::Histogram(Runner* runner, uint32_t binCount, float minValue, float maxValue) : m_pRunner(runner),
+                                                                                         m_binCount(binCount),
+                                                                                         m_minValue(minValue),
+                                                                                         m_maxValue(maxValue)
+{
+    if (runner == nullptr)
+        throw InvalidArgumentException("Runner is required to compute Histogram");
+    if (binCount == 0)
+        throw InvalidArgumentException("Histogram must have at least one bin");
+    if (!(minValue < maxValue))
+        throw InvalidArgumentException("Histogram range is empty");
+
+    setPrivatizationEnabled(true);
+}
+
+void Histogram::setPrivatizationEnabled(bool enabled)
+{
+    uint32_t sharedMemorySize = m_pRunner->getPhysicalDeviceProperties().limits.maxComputeSharedMemorySize;
+    m_isPrivatized = enabled && m_binCount <= sharedMemorySize / sizeof(uint32_t);
+}
+
+void Histogram::compute(const Buffer<float>& input, Buffer<uint32_t>& bins)
+{
+    compute(input, input.getCount(), "histogram_float", bins);
+}
+
+void Histogram::compute(const Buffer<int32_t>& input, Buffer<uint32_t>& bins)
+{
+    compute(input, input.getCount(), "histogram_int", bins);
+}
+
+void Histogram::compute(const Buffer<uint32_t>& input, Buffer<uint32_t>& bins)
+{
+    compute(input, input.getCount(), "histogram_uint", bins);
+}
+
+void Histogram::compute(const BufferBase& input, size_t count, const char* shaderName, Buffer<uint32_t>& bins)
+{
+    if (bins.getCount() < m_binCount)
+        throw InvalidArgumentException("Buffer for bins is smaller than number of bins");
+    if (count > std::numeric_limits<uint32_t>::max())
+        throw InvalidArgumentException("Histogram supports up to 2^32 - 1 values");
+
+    HistogramParameters parameters;
+    parameters.count = static_cast<uint32_t>(count);
+    parameters.binCount = m_binCount;
+    parameters.minValue = m_minValue;
+    parameters.scale = static_cast<float>(m_binCount) / (m_maxValue - m_minValue);
+
+    uint32_t workgroupSize = m_pRunner->getKernelWorkgroupSize(shaderName);
+    uint32_t valuesPerInvocation = m_pRunner->getKernelParameter(shaderName, "itemsPerInvocation",
+                                                                 VALUES_PER_INVOCATION);
+    Task dispatch(m_pRunner->getShaderLoader()->loadBuiltin(shaderName),
+                  m_pRunner->getGroupCount(count, workgroupSize, valuesPerInvocation));
+    dispatch.bind(input, Task::ACCESS_READ).bind(bins).setPushConstants(parameters)
+            .setSpecializationConstant(0, workgroupSize)
+            .setSpecializationConstant(1, m_isPrivatized ? m_binCount : 1)
+            .setSpecializationConstant(2, m_isPrivatized ? VK_TRUE : VK_FALSE);
+
+    std::vector<Task> tasks;
+    tasks.push_back(Task::fill(bins, 0));
+    if (count > 0)
+        tasks.push_back(dispatch);
+    m_pRunner->execute(tasks);
+}
+
+void Histogram::computeBytes(Runner* runner, const Buffer<uint8_t>& input, Buffer<uint32_t>& bins)
+{
+    if (runner == nullptr)
+        throw InvalidArgumentException("Runner is required to compute Histogram");
+    if (bins.getCount() < BYTE_BIN_COUNT)
+        throw InvalidArgumentException("Buffer for bins is smaller than number of bins");
+    if (input.getCount() > std::numeric_limits<uint32_t>::max())
+        throw InvalidArgumentException("Histogram supports up to 2^32 - 1 values");
+
+    uint32_t count = static_cast<uint32_t>(input.getCount());
+    uint32_t workgroupSize = runner->getKernelWorkgroupSize("histogram_bytes");
+    uint32_t wordsPerInvocation = runner->getKernelParameter("histogram_bytes", "itemsPerInvocation",
+                                                             VALUES_PER_INVOCATION);
+    //every invocation reads 4 bytes at once
+    Task dispatch(runner->getShaderLoader()->loadBuiltin("histogram_bytes"),
+                  runner->getGroupCount((input.getCount() + 3) / 4, workgroupSize, wordsPerInvocation));
+    dispatch.bind(input, Task::ACCESS_READ).bind(bins).setPushConstants(count)
+            .setSpecializationConstant(0, workgroupSize);
+
+    std::vector<Task> tasks;
+    tasks.push_back(Task::fill(bins, 0));
+    tasks.push_back(dispatch);
+    runner->execute(tasks);
+}
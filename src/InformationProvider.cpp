@@ -0,0 +1,201 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file InformationProvider.cpp
+ * \brief Contains InformationProvider class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/InformationProvider.hpp"
+
+#include <algorithm>
+
+using namespace Vulkalc;
+
+InformationProvider::InformationProvider(VkInstance instance, VkPhysicalDevice physicalDevice,
+                                         bool isMemoryBudgetEnabled) : m_vkPhysicalDevice(physicalDevice),
+                                                                       m_vkGetMemoryProperties2(nullptr),
+                                                                       m_watermarkFraction(0.0)
+{
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_vkMemoryProperties);
+    m_heapCount = m_vkMemoryProperties.memoryHeapCount;
+    m_heaps.reset(new Heap[m_heapCount]);
+    for (uint32_t i = 0; i < m_heapCount; ++i)
+    {
+        Heap& heap = m_heaps[i];
+        heap.size = m_vkMemoryProperties.memoryHeaps[i].size;
+        heap.isDeviceLocal = (m_vkMemoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+        heap.budget = heap.size;
+        heap.reportedUsage = 0;
+        heap.trackedUsage = 0;
+        heap.trackedUsageAtRefresh = 0;
+        heap.watermark = 0;
+        heap.isAboveWatermark = false;
+    }
+
+#ifdef VK_EXT_memory_budget
+    if (isMemoryBudgetEnabled)
+        m_vkGetMemoryProperties2 = vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties2KHR");
+#else
+    (void) instance;
+    (void) isMemoryBudgetEnabled;
+#endif
+    refresh();
+}
+
+InformationProvider::~InformationProvider()
+{
+
+}
+
+InformationProvider::HeapBudget InformationProvider::getHeapBudget(uint32_t heapIndex) const
+{
+    if (heapIndex >= m_heapCount)
+        throw InvalidArgumentException("Memory heap doesn't exist");
+    return getHeapBudget(m_heaps[heapIndex]);
+}
+
+std::vector<InformationProvider::HeapBudget> InformationProvider::getHeapBudgets() const
+{
+    std::vector<HeapBudget> budgets;
+    budgets.reserve(m_heapCount);
+    for (uint32_t i = 0; i < m_heapCount; ++i)
+        budgets.push_back(getHeapBudget(m_heaps[i]));
+    return budgets;
+}
+
+InformationProvider::HeapBudget InformationProvider::getHeapBudget(const Heap& heap) const
+{
+    HeapBudget budget;
+    budget.budget = heap.budget.load(std::memory_order_relaxed);
+    budget.trackedUsage = heap.trackedUsage.load(std::memory_order_relaxed);
+    budget.isDeviceLocal = heap.isDeviceLocal;
+    if (isMemoryBudgetSupported())
+    {
+        //driver reported usage of the whole process, allocations since then are added to it
+        int64_t usage = static_cast<int64_t>(heap.reportedUsage.load(std::memory_order_relaxed)) +
+                        static_cast<int64_t>(budget.trackedUsage) -
+                        static_cast<int64_t>(heap.trackedUsageAtRefresh.load(std::memory_order_relaxed));
+        budget.usage = usage > 0 ? static_cast<VkDeviceSize>(usage) : 0;
+    }
+    else
+        budget.usage = budget.trackedUsage;
+    return budget;
+}
+
+void InformationProvider::refresh()
+{
+#ifdef VK_EXT_memory_budget
+    if (isMemoryBudgetSupported())
+    {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {};
+        budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+        VkPhysicalDeviceMemoryProperties2KHR memoryProperties = {};
+        memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+        memoryProperties.pNext = &budgetProperties;
+        reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>(m_vkGetMemoryProperties2)(m_vkPhysicalDevice,
+                                                                                                &memoryProperties);
+        for (uint32_t i = 0; i < m_heapCount; ++i)
+        {
+            Heap& heap = m_heaps[i];
+            heap.trackedUsageAtRefresh.store(heap.trackedUsage.load(std::memory_order_relaxed),
+                                             std::memory_order_relaxed);
+            heap.reportedUsage.store(budgetProperties.heapUsage[i], std::memory_order_relaxed);
+            heap.budget.store(budgetProperties.heapBudget[i], std::memory_order_relaxed);
+        }
+    }
+#endif
+    {
+        std::lock_guard<std::mutex> lock(m_watermarkMutex);
+        for (uint32_t i = 0; i < m_heapCount; ++i)
+            updateWatermark(m_heaps[i]);
+    }
+    //budget may shrink below usage without any allocation
+    for (uint32_t i = 0; i < m_heapCount; ++i)
+    {
+        if (m_heaps[i].watermark.load(std::memory_order_relaxed) > 0)
+            checkWatermark(i);
+    }
+}
+
+void InformationProvider::setWatermark(double fraction, WatermarkCallback callback)
+{
+    if (callback && !(fraction > 0.0 && fraction <= 1.0))
+        throw InvalidArgumentException("Watermark must be a fraction of budget in (0, 1]");
+    std::lock_guard<std::mutex> lock(m_watermarkMutex);
+    m_watermarkFraction = callback ? fraction : 0.0;
+    m_watermarkCallback = callback;
+    for (uint32_t i = 0; i < m_heapCount; ++i)
+    {
+        m_heaps[i].isAboveWatermark.store(false);
+        updateWatermark(m_heaps[i]);
+    }
+}
+
+void InformationProvider::updateWatermark(Heap& heap)
+{
+    uint64_t watermark = static_cast<uint64_t>(m_watermarkFraction * heap.budget.load(std::memory_order_relaxed));
+    //fraction is greater than 0, so watermark is not 0 unless it's disabled
+    heap.watermark.store(m_watermarkFraction > 0.0 ? std::max<uint64_t>(watermark, 1) : 0,
+                         std::memory_order_relaxed);
+}
+
+void InformationProvider::trackAllocation(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    uint32_t heapIndex = m_vkMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    m_heaps[heapIndex].trackedUsage.fetch_add(size, std::memory_order_relaxed);
+    if (m_heaps[heapIndex].watermark.load(std::memory_order_relaxed) > 0)
+        checkWatermark(heapIndex);
+}
+
+void InformationProvider::trackFree(uint32_t memoryTypeIndex, VkDeviceSize size)
+{
+    uint32_t heapIndex = m_vkMemoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    m_heaps[heapIndex].trackedUsage.fetch_sub(size, std::memory_order_relaxed);
+    if (m_heaps[heapIndex].watermark.load(std::memory_order_relaxed) > 0)
+        checkWatermark(heapIndex);
+}
+
+void InformationProvider::checkWatermark(uint32_t heapIndex)
+{
+    Heap& heap = m_heaps[heapIndex];
+    HeapBudget budget = getHeapBudget(heap);
+    if (budget.usage < heap.watermark.load(std::memory_order_relaxed))
+    {
+        heap.isAboveWatermark.store(false);
+        return;
+    }
+    //only the thread, which crossed watermark first, calls callback
+    if (heap.isAboveWatermark.exchange(true))
+        return;
+    WatermarkCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(m_watermarkMutex);
+        callback = m_watermarkCallback;
+    }
+    if (callback)
+        callback(heapIndex, budget);
+}
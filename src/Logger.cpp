@@ -0,0 +1,225 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Logger.cpp
+ * \brief Contains Logger class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Logger.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace Vulkalc;
+
+static const char* const LEVEL_NAMES[] = {"INFO", "WARNING", "ERROR"};
+
+Logger::Logger(const std::string& prefix, std::ostream* logStream, std::ostream* errorStream, size_t capacity) :
+        m_prefix(prefix), m_pLogStream(logStream), m_pErrorStream(errorStream),
+        m_startTime(std::chrono::steady_clock::now()), m_enqueuePosition(0), m_dequeuePosition(0),
+        m_flushedPosition(0), m_droppedCount(0), m_isStopping(false)
+{
+    size_t slotCount = 2;
+    while (slotCount < capacity)
+        slotCount *= 2;
+    m_slots = std::vector<Slot>(slotCount);
+    m_mask = slotCount - 1;
+    //sequence equal to position means that slot is free for producer at this position
+    for (size_t i = 0; i < slotCount; ++i)
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+
+    m_thread = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger()
+{
+    m_isStopping.store(true, std::memory_order_release);
+    m_thread.join();
+    //messages queued while thread was stopping
+    while (drain());
+    if (m_pLogStream)
+        m_pLogStream->flush();
+    if (m_pErrorStream)
+        m_pErrorStream->flush();
+}
+
+bool Logger::log(LEVEL level, const char* message, const Field& field0, const Field& field1, const Field& field2,
+                 const Field& field3)
+{
+    uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_startTime).count());
+
+    //bounded multi-producer queue: producer claims position, whose slot was released by consumer
+    size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;)
+    {
+        slot = &m_slots[position & m_mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record& record = slot->record;
+    record.timestamp = timestamp;
+    record.level = level;
+    size_t length = strlen(message);
+    record.length = static_cast<uint32_t>(length < MAX_MESSAGE_LENGTH ? length : MAX_MESSAGE_LENGTH);
+    memcpy(record.text, message, record.length);
+
+    const Field* fields[MAX_FIELDS] = {&field0, &field1, &field2, &field3};
+    uint32_t textLength = record.length;
+    record.fieldCount = 0;
+    for (const Field* field : fields)
+    {
+        if (field->key == nullptr)
+            continue;
+
+        uint32_t index = record.fieldCount++;
+        record.fields[index] = *field;
+        if (field->type == Field::TYPE_STRING)
+        {
+            const char* string = field->value.string ? field->value.string : "";
+            size_t stringLength = strnlen(string, MAX_MESSAGE_LENGTH - textLength);
+            memcpy(record.text + textLength, string, stringLength);
+            record.stringOffsets[index] = textLength;
+            record.stringLengths[index] = static_cast<uint32_t>(stringLength);
+            textLength += static_cast<uint32_t>(stringLength);
+        }
+    }
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::flush()
+{
+    size_t position = m_enqueuePosition.load(std::memory_order_acquire);
+    while (m_flushedPosition.load(std::memory_order_acquire) < position)
+        std::this_thread::yield();
+}
+
+bool Logger::drain()
+{
+    size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[position & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+        return false;
+
+    write(slot.record);
+    slot.sequence.store(position + m_slots.size(), std::memory_order_release);
+    m_dequeuePosition.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::write(const Record& record)
+{
+    std::ostream* stream = record.level == LEVEL_ERROR ? m_pErrorStream : m_pLogStream;
+    if (stream == nullptr)
+        return;
+
+    //whole line is formatted into one buffer to write it with single call
+    char line[64 + MAX_MESSAGE_LENGTH];
+    uint64_t microseconds = record.timestamp / 1000;
+    int length = snprintf(line, sizeof(line), "[%6llu.%06llu] ",
+                          static_cast<unsigned long long>(microseconds / 1000000),
+                          static_cast<unsigned long long>(microseconds % 1000000));
+    stream->write(line, length);
+    stream->write(m_prefix.data(), m_prefix.size());
+    length = snprintf(line, sizeof(line), "%s: %.*s", LEVEL_NAMES[record.level], static_cast<int>(record.length),
+                      record.text);
+    stream->write(line, length);
+
+    for (uint32_t i = 0; i < record.fieldCount; ++i)
+    {
+        const Field& field = record.fields[i];
+        switch (field.type)
+        {
+            case Field::TYPE_INTEGER:
+                length = snprintf(line, sizeof(line), " %s=%lld", field.key,
+                                  static_cast<long long>(field.value.integer));
+                break;
+            case Field::TYPE_UNSIGNED:
+                length = snprintf(line, sizeof(line), " %s=%llu", field.key,
+                                  static_cast<unsigned long long>(field.value.unsignedInteger));
+                break;
+            case Field::TYPE_REAL:
+                length = snprintf(line, sizeof(line), " %s=%g", field.key, field.value.real);
+                break;
+            case Field::TYPE_STRING:
+                length = snprintf(line, sizeof(line), " %s=%.*s", field.key,
+                                  static_cast<int>(record.stringLengths[i]), record.text + record.stringOffsets[i]);
+                break;
+            default:
+                length = 0;
+                break;
+        }
+        //snprintf returns untruncated length
+        stream->write(line, length < static_cast<int>(sizeof(line)) ? length : static_cast<int>(sizeof(line)) - 1);
+    }
+    stream->put('\n');
+}
+
+void Logger::run()
+{
+    //consumer spins briefly, then sleeps, so producers never need to wake it up
+    unsigned idleCount = 0;
+    while (!m_isStopping.load(std::memory_order_acquire))
+    {
+        if (drain())
+        {
+            idleCount = 0;
+            continue;
+        }
+        //streams are flushed once after every batch, so after flush() returns they are not touched until
+        //next message is queued
+        if (idleCount == 0)
+        {
+            if (m_pLogStream)
+                m_pLogStream->flush();
+            if (m_pErrorStream && m_pErrorStream != m_pLogStream)
+                m_pErrorStream->flush();
+            m_flushedPosition.store(m_dequeuePosition.load(std::memory_order_relaxed), std::memory_order_release);
+        }
+        if (++idleCount < 64)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
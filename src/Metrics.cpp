@@ -0,0 +1,290 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Metrics.cpp
+ * \brief Contains Metrics registry and metric classes implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Metrics.hpp"
+#include "include/Utilities.h"
+
+#include <cstdio>
+#include <limits>
+
+using namespace Vulkalc;
+
+/*
+ * Smallest and largest bucket boundaries of exposed histograms are 2^10 ns and 2^34 ns, about 1 us and 17 s
+ */
+static const uint32_t FIRST_EXPOSED_POWER = 10;
+static const uint32_t LAST_EXPOSED_POWER = 34;
+
+static uint32_t getHighestBit(uint64_t value)
+{
+    uint32_t bit = 0;
+    for (uint32_t shift = 32; shift > 0; shift /= 2)
+    {
+        if (value >> shift)
+        {
+            value >>= shift;
+            bit += shift;
+        }
+    }
+    return bit;
+}
+
+static void writeHelp(std::ostream& stream, const std::string& name, const std::string& help, const char* type)
+{
+    stream << "# HELP " << name << " ";
+    for (char character : help)
+    {
+        if (character == '\\')
+            stream << "\\\\";
+        else if (character == '\n')
+            stream << "\\n";
+        else
+            stream << character;
+    }
+    stream << "\n# TYPE " << name << " " << type << "\n";
+}
+
+static void writeSeconds(std::ostream& stream, uint64_t nanoseconds)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%.9g", nanoseconds / 1e9);
+    stream << text;
+}
+
+Counter::Counter()
+{
+    for (size_t i = 0; i < SHARD_COUNT; ++i)
+        m_shards[i].value.store(0, std::memory_order_relaxed);
+}
+
+uint64_t Counter::get() const
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < SHARD_COUNT; ++i)
+        value += m_shards[i].value.load(std::memory_order_relaxed);
+    return value;
+}
+
+size_t Counter::getShardIndex()
+{
+    //threads take shards in order of their first increment, so up to SHARD_COUNT threads never share a shard
+    static std::atomic<size_t> nextShardIndex(0);
+    static thread_local size_t shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return shardIndex;
+}
+
+LatencyHistogram::LatencyHistogram() : m_count(0), m_sum(0)
+{
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+        m_buckets[i].store(0, std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT)
+        return static_cast<uint32_t>(value);
+    //every power of 2 above SUB_BUCKET_COUNT is split by SUB_BUCKET_BITS bits following the highest one
+    uint32_t shift = getHighestBit(value) - SUB_BUCKET_BITS;
+    return SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT +
+           static_cast<uint32_t>((value >> shift) & (SUB_BUCKET_COUNT - 1));
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint32_t index)
+{
+    if (index < SUB_BUCKET_COUNT)
+        return index + 1;
+    if (index >= BUCKET_COUNT - 1)
+        return std::numeric_limits<uint64_t>::max();
+    uint32_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + subBucket + 1) << shift;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const
+{
+    //count is summed from copied buckets, so snapshot is consistent even while values are recorded
+    Snapshot snapshot;
+    snapshot.count = 0;
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.buckets.resize(BUCKET_COUNT);
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    return snapshot;
+}
+
+uint64_t LatencyHistogram::Snapshot::getPercentile(double percentile) const
+{
+    if (count == 0)
+        return 0;
+    double rank = percentile / 100.0 * count;
+    uint64_t target = rank < 1.0 ? 1 : static_cast<uint64_t>(rank);
+    if (static_cast<double>(target) < rank)
+        ++target;
+    if (target > count)
+        target = count;
+
+    uint64_t cumulativeCount = 0;
+    for (uint32_t i = 0; i < buckets.size(); ++i)
+    {
+        cumulativeCount += buckets[i];
+        if (cumulativeCount >= target)
+            return getBucketUpperBound(i) - 1;
+    }
+    return std::numeric_limits<uint64_t>::max();
+}
+
+void Metrics::checkName(const std::string& name, const void* registry) const
+{
+    //names must match [a-zA-Z_:][a-zA-Z0-9_:]* to be valid in Prometheus
+    bool isValid = !name.empty();
+    for (size_t i = 0; i < name.size() && isValid; ++i)
+    {
+        char character = name[i];
+        isValid = (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+                  character == '_' || character == ':' || (i > 0 && character >= '0' && character <= '9');
+    }
+    if (!isValid)
+        throw InvalidArgumentException("Metric name must contain only letters, digits, '_' and ':'");
+    if ((registry != &m_counters && m_counters.count(name) > 0) ||
+        (registry != &m_gauges && m_gauges.count(name) > 0) ||
+        (registry != &m_histograms && m_histograms.count(name) > 0))
+        throw InvalidArgumentException("Metric name is already used by metric of other type");
+}
+
+Counter& Metrics::getCounter(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_counters.find(name);
+    if (found != m_counters.end())
+        return *found->second.second;
+    checkName(name, &m_counters);
+    Counter* counter = new Counter();
+    m_counters[name] = std::make_pair(help, std::unique_ptr<Counter>(counter));
+    return *counter;
+}
+
+Gauge& Metrics::getGauge(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_gauges.find(name);
+    if (found != m_gauges.end())
+        return *found->second.second;
+    checkName(name, &m_gauges);
+    Gauge* gauge = new Gauge();
+    m_gauges[name] = std::make_pair(help, std::unique_ptr<Gauge>(gauge));
+    return *gauge;
+}
+
+LatencyHistogram& Metrics::getHistogram(const std::string& name, const std::string& help)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_histograms.find(name);
+    if (found != m_histograms.end())
+        return *found->second.second;
+    checkName(name, &m_histograms);
+    LatencyHistogram* histogram = new LatencyHistogram();
+    m_histograms[name] = std::make_pair(help, std::unique_ptr<LatencyHistogram>(histogram));
+    return *histogram;
+}
+
+Metrics::Snapshot Metrics::getSnapshot() const
+{
+    //lock only keeps registration out, metrics are still updated while they are copied
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Snapshot snapshot;
+    for (auto& counter : m_counters)
+    {
+        Value value = {counter.first, counter.second.first, static_cast<double>(counter.second.second->get())};
+        snapshot.counters.push_back(value);
+    }
+    for (auto& gauge : m_gauges)
+    {
+        Value value = {gauge.first, gauge.second.first, static_cast<double>(gauge.second.second->get())};
+        snapshot.gauges.push_back(value);
+    }
+    for (auto& histogram : m_histograms)
+    {
+        Distribution distribution = {histogram.first, histogram.second.first,
+                                     histogram.second.second->getSnapshot()};
+        snapshot.histograms.push_back(distribution);
+    }
+    return snapshot;
+}
+
+void Metrics::writePrometheus(std::ostream& stream) const
+{
+    Snapshot snapshot = getSnapshot();
+    for (auto& counter : snapshot.counters)
+    {
+        writeHelp(stream, counter.name, counter.help, "counter");
+        stream << counter.name << " " << static_cast<uint64_t>(counter.value) << "\n";
+    }
+    for (auto& gauge : snapshot.gauges)
+    {
+        writeHelp(stream, gauge.name, gauge.help, "gauge");
+        stream << gauge.name << " " << static_cast<int64_t>(gauge.value) << "\n";
+    }
+    for (auto& distribution : snapshot.histograms)
+    {
+        //bucket boundaries are powers of 2, so every exposed bucket is sum of whole buckets of histogram
+        writeHelp(stream, distribution.name, distribution.help, "histogram");
+        const LatencyHistogram::Snapshot& histogram = distribution.histogram;
+        uint64_t cumulativeCount = 0;
+        uint32_t index = 0;
+        for (uint32_t power = FIRST_EXPOSED_POWER; power <= LAST_EXPOSED_POWER; ++power)
+        {
+            uint64_t bound = static_cast<uint64_t>(1) << power;
+            for (; index < histogram.buckets.size() && LatencyHistogram::getBucketUpperBound(index) <= bound;
+                   ++index)
+                cumulativeCount += histogram.buckets[index];
+            stream << distribution.name << "_bucket{le=\"";
+            writeSeconds(stream, bound);
+            stream << "\"} " << cumulativeCount << "\n";
+        }
+        stream << distribution.name << "_bucket{le=\"+Inf\"} " << histogram.count << "\n";
+        stream << distribution.name << "_sum ";
+        writeSeconds(stream, histogram.sum);
+        stream << "\n" << distribution.name << "_count " << histogram.count << "\n";
+    }
+}
+
+void Metrics::writePrometheus(const char* path) const
+{
+    if (path == nullptr)
+        throw InvalidArgumentException("Path to metrics file is required");
+
+    //collectors never read half-written metrics
+    if (!replaceFile(path, false, [this](std::ostream& stream) { writePrometheus(stream); }))
+        throw InvalidArgumentException("Failed to write metrics file");
+}
@@ -0,0 +1,161 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Profiler.cpp
+ * \brief Contains Profiler class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Profiler.hpp"
+
+#include <algorithm>
+
+using namespace Vulkalc;
+
+Profiler::Profiler(VkDevice device, float timestampPeriod, uint32_t timestampValidBits) :
+        m_vkDevice(device), m_timestampPeriod(timestampPeriod), m_usedQueryCount(0), m_queue(0)
+{
+    m_timestampMask = timestampValidBits >= 64 ? ~0ull : (1ull << timestampValidBits) - 1;
+}
+
+Profiler::~Profiler()
+{
+    for (VkQueryPool queryPool : m_vkQueryPools)
+        vkDestroyQueryPool(m_vkDevice, queryPool, nullptr);
+    m_vkQueryPools.clear();
+}
+
+void Profiler::begin(VkCommandBuffer commandBuffer, const char* name)
+{
+    //pair of queries never crosses pools, because QUERIES_PER_POOL is even
+    uint32_t poolIndex = m_usedQueryCount / QUERIES_PER_POOL;
+    if (poolIndex == m_vkQueryPools.size())
+    {
+        VkQueryPoolCreateInfo queryPoolCreateInfo = {};
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolCreateInfo.queryCount = QUERIES_PER_POOL;
+        VkQueryPool queryPool = VK_NULL_HANDLE;
+        VkResult result = vkCreateQueryPool(m_vkDevice, &queryPoolCreateInfo, nullptr, &queryPool);
+        if (result != VK_SUCCESS)
+            throw VulkanException(result, "Failed to create VkQueryPool");
+        m_vkQueryPools.push_back(queryPool);
+    }
+
+    VkQueryPool queryPool = m_vkQueryPools[poolIndex];
+    uint32_t query = m_usedQueryCount % QUERIES_PER_POOL;
+    vkCmdResetQueryPool(commandBuffer, queryPool, query, 2);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, query);
+    Scope scope = {name, m_queue, m_usedQueryCount};
+    m_scopes.push_back(scope);
+    m_usedQueryCount += 2;
+}
+
+void Profiler::end(VkCommandBuffer commandBuffer)
+{
+    uint32_t query = m_scopes.back().query + 1;
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                        m_vkQueryPools[query / QUERIES_PER_POOL], query % QUERIES_PER_POOL);
+}
+
+void Profiler::collect(bool isAggregated)
+{
+    m_lastSamples.clear();
+    if (m_scopes.empty())
+        return;
+
+    m_timestamps.resize(m_usedQueryCount);
+    for (uint32_t first = 0; first < m_usedQueryCount; first += QUERIES_PER_POOL)
+    {
+        uint32_t count = m_usedQueryCount - first;
+        if (count > QUERIES_PER_POOL)
+            count = QUERIES_PER_POOL;
+        VkResult result = vkGetQueryPoolResults(m_vkDevice, m_vkQueryPools[first / QUERIES_PER_POOL], 0, count,
+                                                count * sizeof(uint64_t), &m_timestamps[first], sizeof(uint64_t),
+                                                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        if (result != VK_SUCCESS)
+        {
+            discard();
+            throw VulkanException(result, "Failed to get results of VkQueryPool");
+        }
+    }
+
+    for (auto& scope : m_scopes)
+    {
+        uint64_t begin = m_timestamps[scope.query] & m_timestampMask;
+        uint64_t end = m_timestamps[scope.query + 1] & m_timestampMask;
+        //timestamp counter may wrap around within valid bits
+        double microseconds = ((end - begin) & m_timestampMask) * m_timestampPeriod / 1000.0;
+        Sample sample = {scope.name, scope.queue, begin * m_timestampPeriod,
+                         begin * m_timestampPeriod + microseconds * 1000.0};
+        m_lastSamples.push_back(sample);
+        if (!isAggregated)
+            continue;
+
+        auto found = m_kernels.find(scope.name);
+        if (found == m_kernels.end())
+        {
+            Kernel kernel = {0, microseconds, 0.0, std::vector<double>(), 0};
+            found = m_kernels.insert(std::make_pair(std::string(scope.name), kernel)).first;
+        }
+        Kernel& kernel = found->second;
+        ++kernel.count;
+        kernel.minMicroseconds = std::min(kernel.minMicroseconds, microseconds);
+        kernel.totalMicroseconds += microseconds;
+        if (kernel.window.size() < SAMPLE_WINDOW)
+            kernel.window.push_back(microseconds);
+        else
+            kernel.window[kernel.nextSample] = microseconds;
+        kernel.nextSample = (kernel.nextSample + 1) % SAMPLE_WINDOW;
+    }
+    discard();
+}
+
+void Profiler::discard()
+{
+    m_scopes.clear();
+    m_usedQueryCount = 0;
+}
+
+std::map<std::string, Profiler::KernelStatistics> Profiler::getStatistics() const
+{
+    std::map<std::string, KernelStatistics> statistics;
+    std::vector<double> window;
+    for (auto& kernel : m_kernels)
+    {
+        window = kernel.second.window;
+        size_t index = (window.size() * 99) / 100;
+        std::nth_element(window.begin(), window.begin() + index, window.end());
+
+        KernelStatistics& kernelStatistics = statistics[kernel.first];
+        kernelStatistics.count = kernel.second.count;
+        kernelStatistics.minMicroseconds = kernel.second.minMicroseconds;
+        kernelStatistics.meanMicroseconds = kernel.second.totalMicroseconds / kernel.second.count;
+        kernelStatistics.p99Microseconds = window[index];
+        kernelStatistics.totalMicroseconds = kernel.second.totalMicroseconds;
+    }
+    return statistics;
+}
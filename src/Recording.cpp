@@ -0,0 +1,184 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Recording.cpp
+ * \brief Contains Recording class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Recording.hpp"
+#include "include/Runner.hpp"
+
+#include <algorithm>
+
+using namespace Vulkalc;
+
+Recording::Recording(Runner* runner, const std::vector<Task>& tasks) : m_pRunner(runner),
+                                                                       m_pDescriptorAllocator(nullptr),
+                                                                       m_dispatchCount(0)
+{
+    if (runner == nullptr)
+        throw InvalidArgumentException("Runner is required to record Tasks");
+
+    try
+    {
+        prepare(tasks);
+        if (!tasks.empty())
+        {
+            m_vkCommandBuffers.push_back(m_pRunner->beginCommandBuffer(0));
+            m_pRunner->recordTasks(m_vkCommandBuffers.back(), tasks, m_vkDescriptorSets, nullptr);
+            m_pRunner->endCommandBuffer(m_vkCommandBuffers.back());
+        }
+    }
+    catch (...)
+    {
+        //destructor is not called, if constructor throws
+        release();
+        throw;
+    }
+}
+
+Recording::Recording(Runner* runner, ComputeGraph& graph) : m_pRunner(runner), m_pDescriptorAllocator(nullptr),
+                                                             m_dispatchCount(0)
+{
+    if (runner == nullptr)
+        throw InvalidArgumentException("Runner is required to record Tasks");
+
+    try
+    {
+        const std::vector<ComputeGraph::Schedule>& schedules = graph.compile(m_pRunner->getComputeQueueCount());
+        prepare(graph.getTasks());
+        for (auto& schedule : schedules)
+        {
+            m_vkCommandBuffers.push_back(m_pRunner->beginCommandBuffer(0));
+            m_pRunner->recordSchedule(m_vkCommandBuffers.back(), schedule, graph.getTasks(), m_vkDescriptorSets,
+                                      nullptr);
+            m_pRunner->endCommandBuffer(m_vkCommandBuffers.back());
+            for (auto& step : schedule)
+            {
+                for (auto& barrier : step.bufferBarriers)
+                    m_directlyUsedBuffers.insert(barrier.buffer);
+            }
+        }
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+Recording::~Recording()
+{
+    release();
+}
+
+void Recording::prepare(const std::vector<Task>& tasks)
+{
+    //descriptor sets are kept for all the lifetime of Recording, so rebind() can update them
+    m_pDescriptorAllocator = new DescriptorAllocator(m_pRunner->getVkDevice(), m_pRunner->m_descriptorSetsPerPool);
+    m_pRunner->prepareTasks(tasks, m_pDescriptorAllocator, false, m_vkDescriptorSets);
+    m_bindings.resize(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        //fill and copy commands refer to VkBuffer directly, so their buffers can't be replaced
+        if (tasks[i].getType() == Task::TYPE_DISPATCH)
+        {
+            //only bindings used by shader are in its descriptor set
+            const std::vector<const BufferBase*>& buffers = tasks[i].getBuffers();
+            m_bindings[i].assign(buffers.size(), nullptr);
+            for (auto& binding : tasks[i].getShader()->getReflection().getBindings())
+            {
+                if (binding.set == 0 && binding.binding < buffers.size())
+                    m_bindings[i][binding.binding] = buffers[binding.binding];
+            }
+            ++m_dispatchCount;
+        }
+        else
+            m_directlyUsedBuffers.insert(tasks[i].getBuffers().begin(), tasks[i].getBuffers().end());
+    }
+}
+
+void Recording::release()
+{
+    VkDevice device = m_pRunner->getVkDevice();
+    if (!m_vkCommandBuffers.empty())
+    {
+        vkFreeCommandBuffers(device, m_pRunner->m_vkCommandPool, static_cast<uint32_t>(m_vkCommandBuffers.size()),
+                             m_vkCommandBuffers.data());
+        m_vkCommandBuffers.clear();
+    }
+    if (m_pDescriptorAllocator)
+    {
+        delete m_pDescriptorAllocator;
+        m_pDescriptorAllocator = nullptr;
+    }
+    m_vkDescriptorSets.clear();
+}
+
+void Recording::rebind(const BufferBase& buffer, const BufferBase& replacement)
+{
+    if (m_directlyUsedBuffers.count(&buffer) > 0)
+        throw InvalidArgumentException("Buffer is used by recorded command directly and can't be rebound");
+    if (replacement.getAllocatedSize() < buffer.getAllocatedSize())
+        throw InvalidArgumentException("Replacement buffer is smaller than rebound buffer");
+    //recorded synchronization is valid only while every buffer is used by the same Tasks
+    bool isReplacementUsed = m_directlyUsedBuffers.count(&replacement) > 0;
+    for (auto& bindings : m_bindings)
+        isReplacementUsed = isReplacementUsed ||
+                            std::find(bindings.begin(), bindings.end(), &replacement) != bindings.end();
+    if (isReplacementUsed)
+        throw InvalidArgumentException("Replacement buffer is already used by recorded Tasks");
+
+    VkDescriptorBufferInfo bufferInfo = {};
+    bufferInfo.buffer = replacement.getVkBuffer();
+    bufferInfo.offset = 0;
+    bufferInfo.range = VK_WHOLE_SIZE;
+
+    //execute() waits for completion, so descriptor sets are never in use here
+    std::vector<VkWriteDescriptorSet> writes;
+    for (size_t i = 0; i < m_bindings.size(); ++i)
+    {
+        for (size_t binding = 0; binding < m_bindings[i].size(); ++binding)
+        {
+            if (m_bindings[i][binding] != &buffer)
+                continue;
+            m_bindings[i][binding] = &replacement;
+
+            VkWriteDescriptorSet write = {};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = m_vkDescriptorSets[i];
+            write.dstBinding = static_cast<uint32_t>(binding);
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+            writes.push_back(write);
+        }
+    }
+    if (writes.empty())
+        throw InvalidArgumentException("Buffer isn't bound to recorded dispatches");
+    vkUpdateDescriptorSets(m_pRunner->getVkDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+}
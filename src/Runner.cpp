@@ -0,0 +1,1107 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Runner.cpp
+ * \brief Contains Runner class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Runner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+using namespace Vulkalc;
+
+static void checkResult(VkResult result, const char* message)
+{
+    if (result != VK_SUCCESS)
+        throw VulkanException(result, message);
+}
+
+/*
+ * Measures duration of execution for log and metrics
+ */
+class Stopwatch
+{
+public:
+    Stopwatch() : m_start(std::chrono::steady_clock::now()) {}
+
+    double getMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    uint64_t getNanoseconds() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+static uint64_t countDispatches(const std::vector<Task>& tasks)
+{
+    uint64_t dispatchCount = 0;
+    for (auto& task : tasks)
+    {
+        if (task.getType() == Task::TYPE_DISPATCH)
+            ++dispatchCount;
+    }
+    return dispatchCount;
+}
+
+Runner::Runner(VkInstance instance, const Configuration* configuration) : m_vkInstance(instance),
+                                                                          m_pConfiguration(configuration),
+                                                                          m_pLogger(nullptr), m_pMetrics(nullptr),
+                                                                          m_instruments()
+{
+    try
+    {
+        init();
+    }
+    catch (...)
+    {
+        //destructor is not called, if constructor throws
+        release();
+        throw;
+    }
+}
+
+Runner::~Runner()
+{
+    release();
+}
+
+void Runner::init()
+{
+    m_vkPhysicalDevice = VK_NULL_HANDLE;
+    m_vkDevice = VK_NULL_HANDLE;
+    m_vkCommandPool = VK_NULL_HANDLE;
+    m_pShaderLoader = nullptr;
+    m_pDescriptorAllocator = nullptr;
+    m_isPushDescriptorSupported = false;
+    m_isPushDescriptorEnabled = m_pConfiguration->isPushDescriptorEnabled;
+    m_descriptorSetsPerPool = m_pConfiguration->descriptorSetsPerPool;
+    m_vkCmdPushDescriptorSet = nullptr;
+    m_pushedDescriptorSetCount = 0;
+    m_countedDescriptorSetCount = 0;
+    m_pProfiler = nullptr;
+    m_isProfilingEnabled = m_pConfiguration->isProfilingEnabled;
+    m_pTraceWriter = nullptr;
+    m_pInformationProvider = nullptr;
+    m_pVerifier = nullptr;
+    m_vkGetCalibratedTimestamps = nullptr;
+    m_deviceClockOffset = std::numeric_limits<double>::infinity();
+    m_lastWaitEnd = 0.0;
+
+    selectPhysicalDevice();
+    if (m_pConfiguration->tuningFile != nullptr)
+    {
+        TuningDatabase tuningDatabase;
+        if (tuningDatabase.load(m_pConfiguration->tuningFile))
+            m_kernelParameters = tuningDatabase.getKernelParameters(getDeviceKey());
+    }
+    createDevice();
+
+    VkCommandPoolCreateInfo commandPoolCreateInfo = {};
+    commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    commandPoolCreateInfo.queueFamilyIndex = m_computeQueueFamilyIndex;
+    checkResult(vkCreateCommandPool(m_vkDevice, &commandPoolCreateInfo, nullptr, &m_vkCommandPool),
+                "Failed to create VkCommandPool");
+
+    //every queue has its own fence, so submissions to different queues are waited for independently
+    VkFenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    for (size_t i = 0; i < m_vkComputeQueues.size(); ++i)
+    {
+        VkFence fence = VK_NULL_HANDLE;
+        checkResult(vkCreateFence(m_vkDevice, &fenceCreateInfo, nullptr, &fence), "Failed to create VkFence");
+        m_vkFences.push_back(fence);
+    }
+
+    m_pShaderLoader = new ShaderLoader(m_vkDevice, m_pConfiguration->shadersDirectory,
+                                       m_pConfiguration->shaderCacheDirectory);
+    m_pDescriptorAllocator = new DescriptorAllocator(m_vkDevice, m_descriptorSetsPerPool);
+    m_pVerifier = new Verifier(m_vkPhysicalDeviceProperties.limits, m_vkEnabledFeatures);
+    //query pools are created on first use, so unused Profiler costs nothing
+    if (m_computeQueueFamilyTimestampValidBits > 0)
+        m_pProfiler = new Profiler(m_vkDevice, m_vkPhysicalDeviceProperties.limits.timestampPeriod,
+                                   m_computeQueueFamilyTimestampValidBits);
+    if (m_pConfiguration->traceFile != nullptr)
+    {
+        m_pTraceWriter = new TraceWriter(m_pConfiguration->traceFile);
+        m_pTraceWriter->setTrackName(0, "Host");
+        for (size_t i = 0; i < m_vkComputeQueues.size(); ++i)
+            m_pTraceWriter->setTrackName(static_cast<uint32_t>(i + 1), ("Queue " + std::to_string(i)).c_str());
+    }
+}
+
+void Runner::release()
+{
+    if (m_vkDevice != VK_NULL_HANDLE)
+        vkDeviceWaitIdle(m_vkDevice);
+
+    //spans refer to names of shaders
+    if (m_pTraceWriter)
+    {
+        delete m_pTraceWriter;
+        m_pTraceWriter = nullptr;
+    }
+    if (m_pShaderLoader)
+    {
+        delete m_pShaderLoader;
+        m_pShaderLoader = nullptr;
+    }
+    if (m_pDescriptorAllocator)
+    {
+        delete m_pDescriptorAllocator;
+        m_pDescriptorAllocator = nullptr;
+    }
+    if (m_pProfiler)
+    {
+        delete m_pProfiler;
+        m_pProfiler = nullptr;
+    }
+    if (m_pInformationProvider)
+    {
+        delete m_pInformationProvider;
+        m_pInformationProvider = nullptr;
+    }
+    if (m_pVerifier)
+    {
+        delete m_pVerifier;
+        m_pVerifier = nullptr;
+    }
+    for (auto& pipeline : m_pipelines)
+        vkDestroyPipeline(m_vkDevice, pipeline.second, nullptr);
+    m_pipelines.clear();
+    for (auto& layout : m_layouts)
+    {
+        vkDestroyPipelineLayout(m_vkDevice, layout.second.pipelineLayout, nullptr);
+        if (layout.second.descriptorSetLayout != VK_NULL_HANDLE)
+            vkDestroyDescriptorSetLayout(m_vkDevice, layout.second.descriptorSetLayout, nullptr);
+    }
+    m_layouts.clear();
+    m_shaderLayouts.clear();
+    for (VkFence fence : m_vkFences)
+        vkDestroyFence(m_vkDevice, fence, nullptr);
+    m_vkFences.clear();
+    m_vkComputeQueues.clear();
+    if (m_vkCommandPool != VK_NULL_HANDLE)
+    {
+        vkDestroyCommandPool(m_vkDevice, m_vkCommandPool, nullptr);
+        m_vkCommandPool = VK_NULL_HANDLE;
+    }
+    if (m_vkDevice != VK_NULL_HANDLE)
+    {
+        vkDestroyDevice(m_vkDevice, nullptr);
+        m_vkDevice = VK_NULL_HANDLE;
+    }
+    //physical device and instance are not owned by Runner
+    m_vkPhysicalDevice = VK_NULL_HANDLE;
+    m_vkInstance = VK_NULL_HANDLE;
+}
+
+void Runner::selectPhysicalDevice()
+{
+    if (m_pConfiguration->devicePointer != nullptr)
+    {
+        m_vkPhysicalDevice = *m_pConfiguration->devicePointer;
+    }
+    else if (m_pConfiguration->isDeviceAutoSelected)
+    {
+        m_vkPhysicalDevice = DeviceSelector::select(m_vkInstance, m_pConfiguration->tuningFile,
+                                                    m_pConfiguration->isDeviceBenchmarkEnabled);
+    }
+    else
+    {
+        uint32_t deviceCount = 0;
+        checkResult(vkEnumeratePhysicalDevices(m_vkInstance, &deviceCount, nullptr),
+                    "Failed to enumerate physical devices");
+        if (m_pConfiguration->deviceToUse >= deviceCount)
+            throw InvalidArgumentException("Configured physical device doesn't exist");
+
+        std::vector<VkPhysicalDevice> devices(deviceCount);
+        VkResult result = vkEnumeratePhysicalDevices(m_vkInstance, &deviceCount, devices.data());
+        if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+            throw VulkanException(result, "Failed to enumerate physical devices");
+        m_vkPhysicalDevice = devices[m_pConfiguration->deviceToUse];
+    }
+
+    const VulkanInfo::PhysicalDeviceInfo& info = VulkanInfo::getInstance()->getPhysicalDeviceInfo(m_vkPhysicalDevice);
+    m_vkPhysicalDeviceProperties = info.properties;
+    m_vkPhysicalDeviceMemoryProperties = info.memoryProperties;
+
+    const std::vector<VkQueueFamilyProperties>& queueFamilies = info.queueFamilies;
+    uint32_t queueFamilyCount = static_cast<uint32_t>(queueFamilies.size());
+
+    //dedicated compute queue family is preferred, as it isn't shared with graphics work
+    m_computeQueueFamilyIndex = std::numeric_limits<uint32_t>::max();
+    for (uint32_t i = 0; i < queueFamilyCount; ++i)
+    {
+        if (!(queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT))
+            continue;
+        if (m_computeQueueFamilyIndex == std::numeric_limits<uint32_t>::max() ||
+            !(queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT))
+            m_computeQueueFamilyIndex = i;
+        if (!(queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT))
+            break;
+    }
+    if (m_computeQueueFamilyIndex == std::numeric_limits<uint32_t>::max())
+        throw InvalidArgumentException("Configured physical device doesn't support compute");
+    m_computeQueueFamilyQueueCount = queueFamilies[m_computeQueueFamilyIndex].queueCount;
+    m_computeQueueFamilyTimestampValidBits = queueFamilies[m_computeQueueFamilyIndex].timestampValidBits;
+}
+
+void Runner::createDevice()
+{
+    uint32_t queueCount = std::max(1u, std::min(m_computeQueueFamilyQueueCount,
+                                                m_pConfiguration->computeQueueCount));
+    std::vector<float> queuePriorities(queueCount, 1.0f);
+    VkDeviceQueueCreateInfo queueCreateInfo = {};
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueFamilyIndex = m_computeQueueFamilyIndex;
+    queueCreateInfo.queueCount = queueCount;
+    queueCreateInfo.pQueuePriorities = queuePriorities.data();
+
+    std::vector<const char*> extensions;
+    //device extensions below require VK_KHR_get_physical_device_properties2 enabled on instance
+    bool isPropertiesExtensionEnabled = isInstanceExtensionEnabled("VK_KHR_get_physical_device_properties2");
+    bool isPushDescriptorEnabled = false;
+    bool isCalibrationEnabled = false;
+    bool isMemoryBudgetEnabled = false;
+#ifdef VK_KHR_push_descriptor
+    if (isPropertiesExtensionEnabled && isDeviceExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+    {
+        extensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        isPushDescriptorEnabled = true;
+    }
+#endif
+#ifdef VK_EXT_calibrated_timestamps
+    //calibration is needed only to put device spans on host timeline of trace
+    if (m_pConfiguration->traceFile != nullptr && isPropertiesExtensionEnabled &&
+        isDeviceExtensionSupported(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME))
+    {
+        extensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+        isCalibrationEnabled = true;
+    }
+#endif
+#ifdef VK_EXT_memory_budget
+    if (isPropertiesExtensionEnabled && isDeviceExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+    {
+        extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        isMemoryBudgetEnabled = true;
+    }
+#endif
+
+    //features, which kernels may need, are enabled when supported, Verifier rejects kernels needing others
+    const VkPhysicalDeviceFeatures& supportedFeatures =
+            VulkanInfo::getInstance()->getPhysicalDeviceInfo(m_vkPhysicalDevice).features;
+    m_vkEnabledFeatures = VkPhysicalDeviceFeatures();
+    m_vkEnabledFeatures.shaderFloat64 = supportedFeatures.shaderFloat64;
+    m_vkEnabledFeatures.shaderInt64 = supportedFeatures.shaderInt64;
+    m_vkEnabledFeatures.shaderInt16 = supportedFeatures.shaderInt16;
+
+    VkDeviceCreateInfo deviceCreateInfo = {};
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.pEnabledFeatures = &m_vkEnabledFeatures;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    deviceCreateInfo.ppEnabledExtensionNames = extensions.empty() ? nullptr : extensions.data();
+    checkResult(vkCreateDevice(m_vkPhysicalDevice, &deviceCreateInfo, nullptr, &m_vkDevice),
+                "Failed to create VkDevice");
+
+    if (isPushDescriptorEnabled)
+    {
+        m_vkCmdPushDescriptorSet = vkGetDeviceProcAddr(m_vkDevice, "vkCmdPushDescriptorSetKHR");
+        m_isPushDescriptorSupported = m_vkCmdPushDescriptorSet != nullptr;
+    }
+#if defined(VK_EXT_calibrated_timestamps) && !defined(_WIN32)
+    //steady_clock is CLOCK_MONOTONIC, host timestamps in other domains would need conversion
+    auto getTimeDomains = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(
+            vkGetInstanceProcAddr(m_vkInstance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT"));
+    if (isCalibrationEnabled && getTimeDomains != nullptr)
+    {
+        uint32_t timeDomainCount = 0;
+        getTimeDomains(m_vkPhysicalDevice, &timeDomainCount, nullptr);
+        std::vector<VkTimeDomainEXT> timeDomains(timeDomainCount);
+        getTimeDomains(m_vkPhysicalDevice, &timeDomainCount, timeDomains.data());
+        if (std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) != timeDomains.end() &&
+            std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT) != timeDomains.end())
+            m_vkGetCalibratedTimestamps = vkGetDeviceProcAddr(m_vkDevice, "vkGetCalibratedTimestampsEXT");
+    }
+#else
+    (void) isCalibrationEnabled;
+#endif
+
+    m_pInformationProvider = new InformationProvider(m_vkInstance, m_vkPhysicalDevice, isMemoryBudgetEnabled);
+
+    m_vkComputeQueues.resize(queueCount, VK_NULL_HANDLE);
+    for (uint32_t i = 0; i < queueCount; ++i)
+        vkGetDeviceQueue(m_vkDevice, m_computeQueueFamilyIndex, i, &m_vkComputeQueues[i]);
+}
+
+bool Runner::isInstanceExtensionEnabled(const char* extensionName) const
+{
+    for (const char* extension : m_pConfiguration->enabledExtensionsNames)
+    {
+        if (strcmp(extension, extensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool Runner::isDeviceExtensionSupported(const char* extensionName) const
+{
+    return VulkanInfo::getInstance()->getPhysicalDeviceInfo(m_vkPhysicalDevice).isExtensionSupported(extensionName);
+}
+
+uint32_t Runner::findMemoryTypeIndex(uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
+{
+    for (uint32_t i = 0; i < m_vkPhysicalDeviceMemoryProperties.memoryTypeCount; ++i)
+    {
+        if ((memoryTypeBits & (1u << i)) &&
+            (m_vkPhysicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            return i;
+    }
+    throw VulkanException(VK_ERROR_FEATURE_NOT_PRESENT, "There is no memory type with required properties");
+}
+
+uint32_t Runner::getWorkgroupSize(uint32_t preferredSize) const
+{
+    const VkPhysicalDeviceLimits& limits = m_vkPhysicalDeviceProperties.limits;
+    return std::min(preferredSize, std::min(limits.maxComputeWorkGroupInvocations, limits.maxComputeWorkGroupSize[0]));
+}
+
+uint32_t Runner::getKernelParameter(const char* kernel, const char* parameter, uint32_t defaultValue) const
+{
+    auto foundKernel = m_kernelParameters.find(kernel);
+    if (foundKernel == m_kernelParameters.end())
+        return defaultValue;
+    auto foundParameter = foundKernel->second.find(parameter);
+    return foundParameter != foundKernel->second.end() ? foundParameter->second : defaultValue;
+}
+
+void Runner::setKernelParameters(const TuningDatabase::KernelParameters& parameters)
+{
+    for (auto& kernel : parameters)
+    {
+        for (auto& parameter : kernel.second)
+        {
+            if (parameter.second == 0)
+                throw InvalidArgumentException("Value of kernel parameter must be greater than 0");
+        }
+    }
+    m_kernelParameters = parameters;
+}
+
+uint32_t Runner::getGroupCount(size_t itemCount, uint32_t workgroupSize, uint32_t itemsPerInvocation) const
+{
+    size_t itemsPerGroup = static_cast<size_t>(workgroupSize) * itemsPerInvocation;
+    size_t groupCount = (itemCount + itemsPerGroup - 1) / itemsPerGroup;
+    size_t maxGroupCount = m_vkPhysicalDeviceProperties.limits.maxComputeWorkGroupCount[0];
+    return static_cast<uint32_t>(std::max<size_t>(1, std::min(groupCount, maxGroupCount)));
+}
+
+void Runner::setMetrics(Metrics* metrics)
+{
+    m_pMetrics = metrics;
+    m_instruments = Instruments();
+    if (metrics == nullptr)
+        return;
+
+    m_instruments.uploadedBytes = &metrics->getCounter("vulkalc_uploaded_bytes_total",
+                                                       "Bytes written to Buffers by host");
+    m_instruments.downloadedBytes = &metrics->getCounter("vulkalc_downloaded_bytes_total",
+                                                         "Bytes read from Buffers by host");
+    m_instruments.dispatches = &metrics->getCounter("vulkalc_dispatches_total", "Dispatches submitted to device");
+    m_instruments.submits = &metrics->getCounter("vulkalc_submits_total", "Command buffers submitted to queues");
+    m_instruments.pipelineCacheHits = &metrics->getCounter("vulkalc_pipeline_cache_hits_total",
+                                                           "Dispatches, which reused cached compute pipeline");
+    m_instruments.pipelineCacheMisses = &metrics->getCounter("vulkalc_pipeline_cache_misses_total",
+                                                             "Compute pipelines created on first use");
+    m_instruments.descriptorSets = &metrics->getCounter("vulkalc_descriptor_sets_total",
+                                                        "Descriptor sets allocated for executed Tasks");
+    m_instruments.bufferBytes = &metrics->getGauge("vulkalc_buffer_bytes", "Size of existing Buffers");
+    m_instruments.descriptorPools = &metrics->getGauge("vulkalc_descriptor_pools",
+                                                       "Descriptor pools of executed Tasks");
+    m_instruments.executionLatency = &metrics->getHistogram("vulkalc_execution_seconds",
+                                                            "Host time of executions from recording to completion");
+    m_instruments.queueWaitLatency = &metrics->getHistogram("vulkalc_queue_wait_seconds",
+                                                            "Host time spent waiting for queues");
+}
+
+bool Runner::LayoutKey::operator<(const LayoutKey& other) const
+{
+    if (bindings != other.bindings)
+        return bindings < other.bindings;
+    if (usesPushDescriptors != other.usesPushDescriptors)
+        return usesPushDescriptors < other.usesPushDescriptors;
+    return pushConstantsSize < other.pushConstantsSize;
+}
+
+bool Runner::PipelineKey::operator<(const PipelineKey& other) const
+{
+    if (shaderModule != other.shaderModule)
+        return shaderModule < other.shaderModule;
+    if (layout != other.layout)
+        return layout < other.layout;
+    return specializationConstants < other.specializationConstants;
+}
+
+bool Runner::usesPushDescriptors(const Task& task) const
+{
+    return m_isPushDescriptorSupported && m_isPushDescriptorEnabled &&
+           task.getShader()->getReflection().getBindings().size() <= MAX_PUSH_DESCRIPTORS;
+}
+
+const Runner::Layout& Runner::getLayout(const Shader* shader, bool usesPushDescriptors)
+{
+    std::pair<VkShaderModule, bool> shaderKey(shader->getVkShaderModule(), usesPushDescriptors);
+    auto cachedShader = m_shaderLayouts.find(shaderKey);
+    if (cachedShader != m_shaderLayouts.end())
+        return *cachedShader->second;
+
+    //layout is derived from interface of shader, bindings Verifier rejects are left out
+    LayoutKey key;
+    for (auto& binding : shader->getReflection().getBindings())
+    {
+        if (binding.set == 0 && binding.type == ShaderReflection::BINDING_STORAGE_BUFFER && binding.count == 1)
+            key.bindings.push_back(binding.binding);
+    }
+    key.usesPushDescriptors = usesPushDescriptors && !key.bindings.empty();
+    //range is rounded up to the granularity of vkCmdPushConstants
+    uint32_t pushConstantsSize = (shader->getReflection().getPushConstantsSize() + 3) / 4 * 4;
+    key.pushConstantsSize = pushConstantsSize < Task::MAX_PUSH_CONSTANTS_SIZE ? pushConstantsSize :
+                            Task::MAX_PUSH_CONSTANTS_SIZE;
+
+    auto cached = m_layouts.find(key);
+    if (cached != m_layouts.end())
+    {
+        m_shaderLayouts[shaderKey] = &cached->second;
+        return cached->second;
+    }
+
+    Layout layout = {key.bindings, key.pushConstantsSize, VK_NULL_HANDLE, VK_NULL_HANDLE};
+    if (!key.bindings.empty())
+    {
+        std::vector<VkDescriptorSetLayoutBinding> bindings(key.bindings.size());
+        for (size_t i = 0; i < bindings.size(); ++i)
+        {
+            bindings[i].binding = key.bindings[i];
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+            bindings[i].pImmutableSamplers = nullptr;
+        }
+        VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
+        descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+#ifdef VK_KHR_push_descriptor
+        if (key.usesPushDescriptors)
+            descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+#endif
+        descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        descriptorSetLayoutCreateInfo.pBindings = bindings.data();
+        checkResult(vkCreateDescriptorSetLayout(m_vkDevice, &descriptorSetLayoutCreateInfo, nullptr,
+                                                &layout.descriptorSetLayout), "Failed to create VkDescriptorSetLayout");
+    }
+
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = key.pushConstantsSize;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+    pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutCreateInfo.setLayoutCount = layout.descriptorSetLayout != VK_NULL_HANDLE ? 1 : 0;
+    pipelineLayoutCreateInfo.pSetLayouts = layout.descriptorSetLayout != VK_NULL_HANDLE ?
+                                           &layout.descriptorSetLayout : nullptr;
+    pipelineLayoutCreateInfo.pushConstantRangeCount = key.pushConstantsSize > 0 ? 1 : 0;
+    pipelineLayoutCreateInfo.pPushConstantRanges = key.pushConstantsSize > 0 ? &pushConstantRange : nullptr;
+
+    VkResult result = vkCreatePipelineLayout(m_vkDevice, &pipelineLayoutCreateInfo, nullptr,
+                                             &layout.pipelineLayout);
+    if (result != VK_SUCCESS)
+    {
+        if (layout.descriptorSetLayout != VK_NULL_HANDLE)
+            vkDestroyDescriptorSetLayout(m_vkDevice, layout.descriptorSetLayout, nullptr);
+        throw VulkanException(result, "Failed to create VkPipelineLayout");
+    }
+    const Layout* inserted = &m_layouts.insert(std::make_pair(key, layout)).first->second;
+    m_shaderLayouts[shaderKey] = inserted;
+    return *inserted;
+}
+
+VkPipeline Runner::getPipeline(const Task& task, bool usesPushDescriptors)
+{
+    PipelineKey key;
+    key.shaderModule = task.getShader()->getVkShaderModule();
+    key.layout = getLayout(task.getShader(), usesPushDescriptors).pipelineLayout;
+    //constants absent from module or equal to defaults don't create another pipeline
+    const std::map<uint32_t, uint32_t>& declaredConstants =
+            task.getShader()->getReflection().getSpecializationConstants();
+    for (auto& constant : task.getSpecializationConstants())
+    {
+        auto declared = declaredConstants.find(constant.first);
+        if (declared != declaredConstants.end() && declared->second != constant.second)
+            key.specializationConstants.insert(constant);
+    }
+
+    auto cached = m_pipelines.find(key);
+    if (cached != m_pipelines.end())
+    {
+        if (m_instruments.pipelineCacheHits)
+            m_instruments.pipelineCacheHits->add();
+        return cached->second;
+    }
+    if (m_instruments.pipelineCacheMisses)
+        m_instruments.pipelineCacheMisses->add();
+    //kernels exceeding limits of device are rejected before driver spends time on them
+    std::vector<Verifier::Diagnostic> diagnostics = m_pVerifier->verify(task);
+    if (!diagnostics.empty())
+        throw ShaderVerificationException((std::string(task.getShader()->getName()) + ": " +
+                                           Verifier::describe(diagnostics)).c_str());
+
+    std::vector<VkSpecializationMapEntry> mapEntries;
+    std::vector<uint32_t> specializationData;
+    for (auto& constant : key.specializationConstants)
+    {
+        VkSpecializationMapEntry mapEntry;
+        mapEntry.constantID = constant.first;
+        mapEntry.offset = static_cast<uint32_t>(specializationData.size() * sizeof(uint32_t));
+        mapEntry.size = sizeof(uint32_t);
+        mapEntries.push_back(mapEntry);
+        specializationData.push_back(constant.second);
+    }
+    VkSpecializationInfo specializationInfo = {};
+    specializationInfo.mapEntryCount = static_cast<uint32_t>(mapEntries.size());
+    specializationInfo.pMapEntries = mapEntries.data();
+    specializationInfo.dataSize = specializationData.size() * sizeof(uint32_t);
+    specializationInfo.pData = specializationData.data();
+
+    VkComputePipelineCreateInfo pipelineCreateInfo = {};
+    pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineCreateInfo.stage.module = key.shaderModule;
+    pipelineCreateInfo.stage.pName = task.getShader()->getEntryPoint();
+    pipelineCreateInfo.stage.pSpecializationInfo = mapEntries.empty() ? nullptr : &specializationInfo;
+    pipelineCreateInfo.layout = key.layout;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    checkResult(vkCreateComputePipelines(m_vkDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline),
+                "Failed to create compute VkPipeline");
+    m_pipelines[key] = pipeline;
+    return pipeline;
+}
+
+void Runner::recordTask(VkCommandBuffer commandBuffer, const Task& task, VkDescriptorSet descriptorSet)
+{
+    const std::vector<const BufferBase*>& buffers = task.getBuffers();
+    switch (task.getType())
+    {
+        case Task::TYPE_DISPATCH:
+        {
+            //dispatch without descriptor set has its descriptors pushed
+            bool usesPushDescriptors = descriptorSet == VK_NULL_HANDLE;
+            const Layout& layout = getLayout(task.getShader(), usesPushDescriptors);
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, getPipeline(task, usesPushDescriptors));
+            if (usesPushDescriptors && !layout.bindings.empty())
+                pushDescriptorSet(commandBuffer, task, layout);
+            else if (!layout.bindings.empty())
+                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, layout.pipelineLayout, 0, 1,
+                                        &descriptorSet, 0, nullptr);
+            //shader can't read push constants beyond its block
+            uint32_t pushConstantsSize = std::min(task.getPushConstantsSize(), layout.pushConstantsSize);
+            if (pushConstantsSize > 0)
+                vkCmdPushConstants(commandBuffer, layout.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                   pushConstantsSize, task.getPushConstants());
+            vkCmdDispatch(commandBuffer, task.getGroupCount(0), task.getGroupCount(1), task.getGroupCount(2));
+            break;
+        }
+        case Task::TYPE_FILL:
+            vkCmdFillBuffer(commandBuffer, buffers[0]->getVkBuffer(), 0, VK_WHOLE_SIZE, task.getFillValue());
+            break;
+        case Task::TYPE_COPY:
+        {
+            VkBufferCopy region = {};
+            region.size = buffers[0]->getAllocatedSize();
+            vkCmdCopyBuffer(commandBuffer, buffers[0]->getVkBuffer(), buffers[1]->getVkBuffer(), 1, &region);
+            break;
+        }
+    }
+}
+
+void Runner::writeDescriptors(const Task& task, const Layout& layout, VkDescriptorSet descriptorSet,
+                              VkDescriptorBufferInfo* bufferInfos, VkWriteDescriptorSet* writes) const
+{
+    const std::vector<const BufferBase*>& buffers = task.getBuffers();
+    for (size_t i = 0; i < layout.bindings.size(); ++i)
+    {
+        uint32_t binding = layout.bindings[i];
+        if (binding >= buffers.size() || buffers[binding] == nullptr)
+            throw InvalidArgumentException(("Binding " + std::to_string(binding) + " of shader " +
+                                            task.getShader()->getName() + " is not bound").c_str());
+        bufferInfos[i].buffer = buffers[binding]->getVkBuffer();
+        bufferInfos[i].offset = 0;
+        bufferInfos[i].range = VK_WHOLE_SIZE;
+
+        writes[i] = {};
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = descriptorSet;
+        writes[i].dstBinding = binding;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = &bufferInfos[i];
+    }
+}
+
+void Runner::pushDescriptorSet(VkCommandBuffer commandBuffer, const Task& task, const Layout& layout)
+{
+    VkDescriptorBufferInfo bufferInfos[MAX_PUSH_DESCRIPTORS];
+    VkWriteDescriptorSet writes[MAX_PUSH_DESCRIPTORS];
+    writeDescriptors(task, layout, VK_NULL_HANDLE, bufferInfos, writes);
+#ifdef VK_KHR_push_descriptor
+    reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(m_vkCmdPushDescriptorSet)(
+            commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, layout.pipelineLayout, 0,
+            static_cast<uint32_t>(layout.bindings.size()), writes);
+    ++m_pushedDescriptorSetCount;
+#else
+    (void) commandBuffer;
+#endif
+}
+
+void Runner::execute(const Task& task)
+{
+    execute(std::vector<Task>(1, task));
+}
+
+void Runner::execute(const std::vector<Task>& tasks)
+{
+    if (tasks.empty())
+        return;
+
+    Stopwatch stopwatch;
+    //trace needs device spans, but they are aggregated into statistics only if profiling is enabled
+    bool isProfiled = isProfilingEnabled();
+    Profiler* profiler = isProfiled || m_pTraceWriter ? m_pProfiler : nullptr;
+    double recordBegin = m_pTraceWriter ? m_pTraceWriter->now() : 0.0;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    try
+    {
+        std::vector<VkDescriptorSet> descriptorSets;
+        prepareTasks(tasks, m_pDescriptorAllocator, true, descriptorSets);
+        commandBuffer = beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        if (profiler)
+            profiler->setQueue(0);
+        recordTasks(commandBuffer, tasks, descriptorSets, profiler);
+        endCommandBuffer(commandBuffer);
+        if (m_pTraceWriter)
+            m_pTraceWriter->addSpan("record", "host", recordBegin, m_pTraceWriter->now(), 0);
+        submit(std::vector<VkCommandBuffer>(1, commandBuffer));
+        if (profiler)
+        {
+            profiler->collect(isProfiled);
+            traceSamples(profiler);
+        }
+    }
+    catch (...)
+    {
+        if (commandBuffer != VK_NULL_HANDLE)
+            vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, 1, &commandBuffer);
+        if (profiler)
+            profiler->discard();
+        resetDescriptorAllocator();
+        throw;
+    }
+
+    vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, 1, &commandBuffer);
+    resetDescriptorAllocator();
+    if (m_pMetrics)
+    {
+        m_instruments.dispatches->add(countDispatches(tasks));
+        m_instruments.executionLatency->record(stopwatch.getNanoseconds());
+    }
+    VULKALC_LOG_INFO(m_pLogger, "executed tasks", {"tasks", tasks.size()},
+                     {"microseconds", stopwatch.getMicroseconds()});
+}
+
+void Runner::execute(ComputeGraph& graph)
+{
+    const std::vector<ComputeGraph::Schedule>& schedules =
+            graph.compile(static_cast<uint32_t>(m_vkComputeQueues.size()));
+    if (schedules.empty())
+        return;
+
+    Stopwatch stopwatch;
+    bool isProfiled = isProfilingEnabled();
+    Profiler* profiler = isProfiled || m_pTraceWriter ? m_pProfiler : nullptr;
+    double recordBegin = m_pTraceWriter ? m_pTraceWriter->now() : 0.0;
+    std::vector<VkCommandBuffer> commandBuffers;
+    try
+    {
+        std::vector<VkDescriptorSet> descriptorSets;
+        prepareTasks(graph.getTasks(), m_pDescriptorAllocator, true, descriptorSets);
+        for (auto& schedule : schedules)
+        {
+            //schedules are submitted to queues in order
+            if (profiler)
+                profiler->setQueue(static_cast<uint32_t>(commandBuffers.size()));
+            commandBuffers.push_back(beginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT));
+            recordSchedule(commandBuffers.back(), schedule, graph.getTasks(), descriptorSets, profiler);
+            endCommandBuffer(commandBuffers.back());
+        }
+        if (m_pTraceWriter)
+            m_pTraceWriter->addSpan("record", "host", recordBegin, m_pTraceWriter->now(), 0);
+        submit(commandBuffers);
+        if (profiler)
+        {
+            profiler->collect(isProfiled);
+            traceSamples(profiler);
+        }
+    }
+    catch (...)
+    {
+        if (!commandBuffers.empty())
+            vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, static_cast<uint32_t>(commandBuffers.size()),
+                                 commandBuffers.data());
+        if (profiler)
+            profiler->discard();
+        resetDescriptorAllocator();
+        throw;
+    }
+
+    vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, static_cast<uint32_t>(commandBuffers.size()),
+                         commandBuffers.data());
+    resetDescriptorAllocator();
+    if (m_pMetrics)
+    {
+        m_instruments.dispatches->add(countDispatches(graph.getTasks()));
+        m_instruments.executionLatency->record(stopwatch.getNanoseconds());
+    }
+    VULKALC_LOG_INFO(m_pLogger, "executed graph", {"tasks", graph.getTasks().size()},
+                     {"queues", schedules.size()}, {"barriers", graph.getPipelineBarrierCount()},
+                     {"microseconds", stopwatch.getMicroseconds()});
+}
+
+void Runner::execute(const Recording& recording)
+{
+    tryExecute(recording).valueOrThrow();
+}
+
+Expected<void> Runner::tryExecute(const Recording& recording)
+{
+    if (recording.m_pRunner != this)
+        return Error(ERROR_INVALID_ARGUMENT, "Recording was made by another Runner");
+    if (recording.m_vkCommandBuffers.empty())
+        return Expected<void>();
+
+    Stopwatch stopwatch;
+    Expected<void> result = trySubmit(recording.m_vkCommandBuffers);
+    if (!result)
+        return result;
+    if (m_pMetrics)
+    {
+        m_instruments.dispatches->add(recording.m_dispatchCount);
+        m_instruments.executionLatency->record(stopwatch.getNanoseconds());
+    }
+    VULKALC_LOG_INFO(m_pLogger, "executed recording", {"command_buffers", recording.m_vkCommandBuffers.size()},
+                     {"microseconds", stopwatch.getMicroseconds()});
+    return result;
+}
+
+void Runner::resetDescriptorAllocator()
+{
+    if (m_pMetrics)
+    {
+        const DescriptorAllocator::Statistics& statistics = m_pDescriptorAllocator->getStatistics();
+        m_instruments.descriptorSets->add(statistics.allocationCount - m_countedDescriptorSetCount);
+        m_instruments.descriptorPools->set(static_cast<int64_t>(statistics.poolCount));
+    }
+    m_countedDescriptorSetCount = m_pDescriptorAllocator->getStatistics().allocationCount;
+
+    //submissions are always waited for, so no descriptor set of the allocator is in use here
+    try
+    {
+        m_pDescriptorAllocator->reset();
+    }
+    catch (VulkanException&)
+    {
+        //pools stay allocated and new ones are created on demand
+    }
+}
+
+bool Runner::calibrateTimestamps()
+{
+#ifdef VK_EXT_calibrated_timestamps
+    if (m_vkGetCalibratedTimestamps != nullptr)
+    {
+        VkCalibratedTimestampInfoEXT timestampInfos[2] = {};
+        timestampInfos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        timestampInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+        timestampInfos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        timestampInfos[1].timeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+        uint64_t timestamps[2] = {};
+        uint64_t maxDeviation = 0;
+        auto getCalibratedTimestamps = reinterpret_cast<PFN_vkGetCalibratedTimestampsEXT>(m_vkGetCalibratedTimestamps);
+        if (getCalibratedTimestamps(m_vkDevice, 2, timestampInfos, timestamps, &maxDeviation) == VK_SUCCESS)
+        {
+            uint64_t timestampMask = m_computeQueueFamilyTimestampValidBits >= 64 ?
+                                     ~0ull : (1ull << m_computeQueueFamilyTimestampValidBits) - 1;
+            double deviceNanoseconds = (timestamps[0] & timestampMask) *
+                                       static_cast<double>(m_vkPhysicalDeviceProperties.limits.timestampPeriod);
+            m_deviceClockOffset = m_pTraceWriter->fromSteadyClock(static_cast<int64_t>(timestamps[1])) -
+                                  deviceNanoseconds / 1000.0;
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+void Runner::traceSamples(const Profiler* profiler)
+{
+    const std::vector<Profiler::Sample>& samples = profiler->getLastSamples();
+    if (m_pTraceWriter == nullptr || samples.empty())
+        return;
+
+    if (!calibrateTimestamps())
+    {
+        //every command ends before host stops waiting, so the smallest such offset is the closest to real one
+        double lastEnd = 0.0;
+        for (auto& sample : samples)
+            lastEnd = std::max(lastEnd, sample.endNanoseconds / 1000.0);
+        m_deviceClockOffset = std::min(m_deviceClockOffset, m_lastWaitEnd - lastEnd);
+    }
+
+    for (auto& sample : samples)
+        m_pTraceWriter->addSpan(sample.name, "device", sample.beginNanoseconds / 1000.0 + m_deviceClockOffset,
+                                sample.endNanoseconds / 1000.0 + m_deviceClockOffset, sample.queue + 1);
+}
+
+void Runner::recordProfiledTask(VkCommandBuffer commandBuffer, const Task& task, VkDescriptorSet descriptorSet,
+                                Profiler* profiler)
+{
+    if (profiler == nullptr)
+    {
+        recordTask(commandBuffer, task, descriptorSet);
+        return;
+    }
+
+    switch (task.getType())
+    {
+        case Task::TYPE_DISPATCH:
+            profiler->begin(commandBuffer, task.getShader()->getName());
+            break;
+        case Task::TYPE_FILL:
+            profiler->begin(commandBuffer, "fill");
+            break;
+        case Task::TYPE_COPY:
+            profiler->begin(commandBuffer, "copy");
+            break;
+    }
+    recordTask(commandBuffer, task, descriptorSet);
+    profiler->end(commandBuffer);
+}
+
+void Runner::recordTasks(VkCommandBuffer commandBuffer, const std::vector<Task>& tasks,
+                         const std::vector<VkDescriptorSet>& descriptorSets, Profiler* profiler)
+{
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        if (i > 0)
+        {
+            //every task may read results of any previous task
+            memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+            memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                                          VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+        }
+        recordProfiledTask(commandBuffer, tasks[i], descriptorSets[i], profiler);
+    }
+}
+
+void Runner::recordSchedule(VkCommandBuffer commandBuffer, const ComputeGraph::Schedule& schedule,
+                            const std::vector<Task>& tasks, const std::vector<VkDescriptorSet>& descriptorSets,
+                            Profiler* profiler)
+{
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    for (auto& step : schedule)
+    {
+        if (step.srcStageMask != 0)
+        {
+            bufferBarriers.resize(step.bufferBarriers.size());
+            for (size_t i = 0; i < step.bufferBarriers.size(); ++i)
+            {
+                bufferBarriers[i] = {};
+                bufferBarriers[i].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                bufferBarriers[i].srcAccessMask = step.bufferBarriers[i].srcAccessMask;
+                bufferBarriers[i].dstAccessMask = step.bufferBarriers[i].dstAccessMask;
+                bufferBarriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarriers[i].buffer = step.bufferBarriers[i].buffer->getVkBuffer();
+                bufferBarriers[i].offset = 0;
+                bufferBarriers[i].size = VK_WHOLE_SIZE;
+            }
+            vkCmdPipelineBarrier(commandBuffer, step.srcStageMask, step.dstStageMask, 0, 0, nullptr,
+                                 static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(), 0, nullptr);
+        }
+        for (size_t task : step.tasks)
+            recordProfiledTask(commandBuffer, tasks[task], descriptorSets[task], profiler);
+    }
+}
+
+void Runner::prepareTasks(const std::vector<Task>& tasks, DescriptorAllocator* descriptorAllocator,
+                          bool allowsPushDescriptors, std::vector<VkDescriptorSet>& descriptorSets)
+{
+    //pipelines are created before recording, so failure doesn't leave half-recorded command buffer
+    descriptorSets.assign(tasks.size(), VK_NULL_HANDLE);
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        if (tasks[i].getType() != Task::TYPE_DISPATCH)
+            continue;
+        //descriptor sets are allocated only for dispatches, which can't use push descriptors
+        bool usesPushDescriptors = allowsPushDescriptors && this->usesPushDescriptors(tasks[i]);
+        getPipeline(tasks[i], usesPushDescriptors);
+        const Layout& layout = getLayout(tasks[i].getShader(), usesPushDescriptors);
+        if (layout.bindings.empty())
+            continue;
+        std::vector<VkDescriptorBufferInfo> bufferInfos(layout.bindings.size());
+        std::vector<VkWriteDescriptorSet> writes(layout.bindings.size());
+        //unbound bindings are reported before descriptors are allocated or pushed at recording
+        writeDescriptors(tasks[i], layout, VK_NULL_HANDLE, bufferInfos.data(), writes.data());
+        if (usesPushDescriptors)
+            continue;
+
+        uint32_t bindingCount = static_cast<uint32_t>(layout.bindings.size());
+        descriptorSets[i] = descriptorAllocator->allocate(layout.descriptorSetLayout, bindingCount);
+        for (auto& write : writes)
+            write.dstSet = descriptorSets[i];
+        vkUpdateDescriptorSets(m_vkDevice, bindingCount, writes.data(), 0, nullptr);
+    }
+}
+
+VkCommandBuffer Runner::beginCommandBuffer(VkCommandBufferUsageFlags flags)
+{
+    VkCommandBufferAllocateInfo commandBufferAllocateInfo = {};
+    commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferAllocateInfo.commandPool = m_vkCommandPool;
+    commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferAllocateInfo.commandBufferCount = 1;
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    checkResult(vkAllocateCommandBuffers(m_vkDevice, &commandBufferAllocateInfo, &commandBuffer),
+                "Failed to allocate VkCommandBuffer");
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = flags;
+    VkResult result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    if (result != VK_SUCCESS)
+    {
+        vkFreeCommandBuffers(m_vkDevice, m_vkCommandPool, 1, &commandBuffer);
+        throw VulkanException(result, "Failed to begin VkCommandBuffer");
+    }
+    return commandBuffer;
+}
+
+void Runner::endCommandBuffer(VkCommandBuffer commandBuffer)
+{
+    //results must be visible to host through mapped memory
+    VkMemoryBarrier memoryBarrier = {};
+    memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    memoryBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    checkResult(vkEndCommandBuffer(commandBuffer), "Failed to end VkCommandBuffer");
+}
+
+void Runner::submit(const std::vector<VkCommandBuffer>& commandBuffers)
+{
+    trySubmit(commandBuffers).valueOrThrow();
+}
+
+Expected<void> Runner::trySubmit(const std::vector<VkCommandBuffer>& commandBuffers)
+{
+    //queues are already waited for, if submission to one of them fails
+    double submitBegin = m_pTraceWriter ? m_pTraceWriter->now() : 0.0;
+    size_t submittedCount = 0;
+    VkResult result = VK_SUCCESS;
+    for (; submittedCount < commandBuffers.size(); ++submittedCount)
+    {
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffers[submittedCount];
+        result = vkQueueSubmit(m_vkComputeQueues[submittedCount], 1, &submitInfo, m_vkFences[submittedCount]);
+        if (result != VK_SUCCESS)
+            break;
+    }
+
+    if (m_pMetrics)
+        m_instruments.submits->add(submittedCount);
+
+    double waitBegin = 0.0;
+    if (m_pTraceWriter)
+    {
+        waitBegin = m_pTraceWriter->now();
+        m_pTraceWriter->addSpan("submit", "host", submitBegin, waitBegin, 0);
+    }
+
+    if (submittedCount > 0)
+    {
+        Stopwatch stopwatch;
+        VkResult waitResult = vkWaitForFences(m_vkDevice, static_cast<uint32_t>(submittedCount), m_vkFences.data(),
+                                              VK_TRUE, std::numeric_limits<uint64_t>::max());
+        if (m_pMetrics)
+            m_instruments.queueWaitLatency->record(stopwatch.getNanoseconds());
+        if (m_pTraceWriter)
+        {
+            m_lastWaitEnd = m_pTraceWriter->now();
+            m_pTraceWriter->addSpan("wait", "host", waitBegin, m_lastWaitEnd, 0);
+        }
+        if (waitResult != VK_SUCCESS)
+            return Error(ERROR_VULKAN, "Failed to wait for VkFence", waitResult);
+        VkResult resetResult = vkResetFences(m_vkDevice, static_cast<uint32_t>(submittedCount), m_vkFences.data());
+        if (resetResult != VK_SUCCESS)
+            return Error(ERROR_VULKAN, "Failed to reset VkFence", resetResult);
+    }
+    if (result != VK_SUCCESS)
+        return Error(ERROR_VULKAN, "Failed to submit VkCommandBuffer", result);
+    return Expected<void>();
+}
@@ -0,0 +1,120 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Shader.cpp
+ * \brief Contains Shader and ShaderLoader classes implementations
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Shader.hpp"
+
+#include <fstream>
+
+using namespace Vulkalc;
+
+Shader::Shader(VkDevice device, const std::vector<uint32_t>& code, const char* entryPoint, const char* name) :
+        m_vkDevice(device), m_vkShaderModule(VK_NULL_HANDLE), m_entryPoint(entryPoint), m_name(name)
+{
+    if (code.empty())
+        throw ShaderLoadingException("SPIR-V code is empty");
+    m_reflection = ShaderReflection(code, entryPoint);
+
+    VkShaderModuleCreateInfo shaderModuleCreateInfo = {};
+    shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderModuleCreateInfo.codeSize = code.size() * sizeof(uint32_t);
+    shaderModuleCreateInfo.pCode = code.data();
+    VkResult result = vkCreateShaderModule(m_vkDevice, &shaderModuleCreateInfo, nullptr, &m_vkShaderModule);
+    if (result != VK_SUCCESS)
+        throw VulkanException(result, "Failed to create VkShaderModule");
+}
+
+Shader::~Shader()
+{
+    if (m_vkShaderModule != VK_NULL_HANDLE)
+    {
+        vkDestroyShaderModule(m_vkDevice, m_vkShaderModule, nullptr);
+        m_vkShaderModule = VK_NULL_HANDLE;
+    }
+}
+
+ShaderLoader::ShaderLoader(VkDevice device, const char* shadersDirectory, const char* cacheDirectory) :
+        m_vkDevice(device), m_shadersDirectory(shadersDirectory), m_compiler(cacheDirectory)
+{
+}
+
+ShaderLoader::~ShaderLoader()
+{
+    for (auto& shader : m_shaders)
+        delete shader.second;
+    m_shaders.clear();
+}
+
+Shader* ShaderLoader::load(const char* path)
+{
+    auto cached = m_shaders.find(path);
+    if (cached != m_shaders.end())
+        return cached->second;
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        throw ShaderLoadingException((std::string("Failed to open SPIR-V file ") + path).c_str());
+    std::streamsize size = file.tellg();
+    if (size <= 0 || size % sizeof(uint32_t) != 0)
+        throw ShaderLoadingException((std::string("Invalid size of SPIR-V file ") + path).c_str());
+
+    std::vector<uint32_t> code(static_cast<size_t>(size) / sizeof(uint32_t));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(code.data()), size))
+        throw ShaderLoadingException((std::string("Failed to read SPIR-V file ") + path).c_str());
+
+    //name of shader is name of file without directory and extension
+    std::string name(path);
+    size_t separator = name.find_last_of("/\\");
+    if (separator != std::string::npos)
+        name.erase(0, separator + 1);
+    name = name.substr(0, name.find_last_of('.'));
+    Shader* shader = new Shader(m_vkDevice, code, "main", name.c_str());
+    m_shaders[path] = shader;
+    return shader;
+}
+
+Shader* ShaderLoader::loadBuiltin(const char* name)
+{
+    return load((m_shadersDirectory + "/" + name + ".spv").c_str());
+}
+
+Shader* ShaderLoader::compile(const std::string& source, const std::vector<std::string>& defines, const char* name)
+{
+    //prefix keeps compiled shaders apart from file paths
+    std::string key = "source:" + ShaderCompiler::getCacheKey(source, defines);
+    auto cached = m_shaders.find(key);
+    if (cached != m_shaders.end())
+        return cached->second;
+
+    Shader* shader = new Shader(m_vkDevice, m_compiler.compile(source, defines, name), "main", name);
+    m_shaders[key] = shader;
+    return shader;
+}
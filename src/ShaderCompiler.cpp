@@ -0,0 +1,208 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ShaderCompiler.cpp
+ * \brief Contains ShaderCompiler class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/ShaderCompiler.hpp"
+#include "include/Utilities.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#ifdef VULKALC_RUNTIME_COMPILER
+#include <shaderc/shaderc.h>
+#endif
+
+using namespace Vulkalc;
+
+static const uint32_t SPIRV_MAGIC = 0x07230203;
+static const char* const ENTRY_POINT = "main";
+//value of shaderc_optimization_level_performance, so builds without shaderc compute the same cache keys
+static const int OPTIMIZATION_LEVEL = 2;
+
+#ifdef VULKALC_RUNTIME_COMPILER
+static_assert(OPTIMIZATION_LEVEL == shaderc_optimization_level_performance, "Optimization level must match shaderc");
+#endif
+
+ShaderCompiler::ShaderCompiler(const char* cacheDirectory) : m_cacheDirectory(cacheDirectory ? cacheDirectory : "")
+{
+    m_statistics.requestCount = 0;
+    m_statistics.cacheHitCount = 0;
+    m_statistics.compileCount = 0;
+    m_statistics.compileMilliseconds = 0;
+    m_statistics.cacheMilliseconds = 0;
+}
+
+std::vector<uint32_t> ShaderCompiler::compile(const std::string& source, const std::vector<std::string>& defines,
+                                              const char* name)
+{
+    ++m_statistics.requestCount;
+    std::vector<uint32_t> code;
+    std::string path;
+    if (!m_cacheDirectory.empty())
+    {
+        path = m_cacheDirectory + "/" + getCacheKey(source, defines) + ".spv";
+        auto start = std::chrono::steady_clock::now();
+        bool isCached = readCache(path, code);
+        m_statistics.cacheMilliseconds += std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+        if (isCached)
+        {
+            ++m_statistics.cacheHitCount;
+            return code;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    code = compileSource(source, defines, name);
+    m_statistics.compileMilliseconds += std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+    ++m_statistics.compileCount;
+
+    if (!path.empty())
+        writeCache(path, code);
+    return code;
+}
+
+std::string ShaderCompiler::getCacheKey(const std::string& source, const std::vector<std::string>& defines)
+{
+    //64-bit FNV-1a, every part is terminated by zero byte, so ("AB", "C") and ("A", "BC") differ
+    uint64_t hash = 14695981039346656037ULL;
+    auto append = [&hash](const std::string& part)
+    {
+        for (size_t i = 0; i <= part.size(); ++i)
+        {
+            hash ^= static_cast<unsigned char>(part.c_str()[i]);
+            hash *= 1099511628211ULL;
+        }
+    };
+    //shaderc comes from Vulkan SDK, so headers version identifies compiler, which cached shaders were built with
+    append("glsl-compute");
+    append(std::string("entry=") + ENTRY_POINT);
+    append("optimization=" + std::to_string(OPTIMIZATION_LEVEL));
+    append("sdk=" + std::to_string(VK_HEADER_VERSION));
+    append(source);
+    for (const std::string& define : defines)
+        append(define);
+
+    char key[17];
+    snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+    return key;
+}
+
+bool ShaderCompiler::isCompilationSupported()
+{
+#ifdef VULKALC_RUNTIME_COMPILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ShaderCompiler::readCache(const std::string& path, std::vector<uint32_t>& code) const
+{
+    std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+    std::streamsize size = file.tellg();
+    if (size < static_cast<std::streamsize>(2 * sizeof(uint32_t)) || size % sizeof(uint32_t) != 0)
+        return false;
+
+    code.resize(static_cast<size_t>(size) / sizeof(uint32_t));
+    file.seekg(0);
+    //truncated or foreign files are treated as cache misses and overwritten, code is followed by its word count
+    if (!file.read(reinterpret_cast<char*>(code.data()), size) || code.back() != code.size() - 1 ||
+        code[0] != SPIRV_MAGIC)
+        return false;
+    code.pop_back();
+    return true;
+}
+
+void ShaderCompiler::writeCache(const std::string& path, const std::vector<uint32_t>& code) const
+{
+    //cache is optional, so failure to write it isn't an error
+    replaceFile(path.c_str(), true, [&code](std::ostream& stream)
+    {
+        uint32_t wordCount = static_cast<uint32_t>(code.size());
+        stream.write(reinterpret_cast<const char*>(code.data()),
+                     static_cast<std::streamsize>(code.size() * sizeof(uint32_t)));
+        stream.write(reinterpret_cast<const char*>(&wordCount), sizeof(wordCount));
+    });
+}
+
+std::vector<uint32_t> ShaderCompiler::compileSource(const std::string& source,
+                                                    const std::vector<std::string>& defines,
+                                                    const char* name) const
+{
+#ifdef VULKALC_RUNTIME_COMPILER
+    shaderc_compiler_t compiler = shaderc_compiler_initialize();
+    shaderc_compile_options_t options = shaderc_compile_options_initialize();
+    if (!compiler || !options)
+    {
+        shaderc_compile_options_release(options);
+        shaderc_compiler_release(compiler);
+        throw ShaderCompilationException("Failed to initialize shaderc");
+    }
+    shaderc_compile_options_set_optimization_level(options,
+                                                   static_cast<shaderc_optimization_level>(OPTIMIZATION_LEVEL));
+    for (const std::string& define : defines)
+    {
+        size_t separator = define.find('=');
+        if (separator == std::string::npos)
+            shaderc_compile_options_add_macro_definition(options, define.c_str(), define.size(), nullptr, 0);
+        else
+            shaderc_compile_options_add_macro_definition(options, define.c_str(), separator,
+                                                         define.c_str() + separator + 1,
+                                                         define.size() - separator - 1);
+    }
+
+    shaderc_compilation_result_t result = shaderc_compile_into_spv(compiler, source.c_str(), source.size(),
+                                                                   shaderc_compute_shader, name, ENTRY_POINT, options);
+    shaderc_compile_options_release(options);
+    shaderc_compiler_release(compiler);
+    if (shaderc_result_get_compilation_status(result) != shaderc_compilation_status_success)
+    {
+        std::string message = std::string("Failed to compile shader ") + name + ": " +
+                              shaderc_result_get_error_message(result);
+        shaderc_result_release(result);
+        throw ShaderCompilationException(message.c_str());
+    }
+
+    const uint32_t* bytes = reinterpret_cast<const uint32_t*>(shaderc_result_get_bytes(result));
+    std::vector<uint32_t> code(bytes, bytes + shaderc_result_get_length(result) / sizeof(uint32_t));
+    shaderc_result_release(result);
+    return code;
+#else
+    (void) source;
+    (void) defines;
+    throw ShaderCompilationException((std::string("Failed to compile shader ") + name +
+                                      ": Vulkalc is built without VULKALC_RUNTIME_COMPILER").c_str());
+#endif
+}
@@ -0,0 +1,477 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ShaderReflection.cpp
+ * \brief Contains ShaderReflection class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/ShaderReflection.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Vulkalc;
+
+//numbers below are from SPIR-V specification
+static const uint32_t SPIRV_MAGIC = 0x07230203;
+static const uint32_t SPIRV_HEADER_SIZE = 5;
+
+enum SPIRV_OPCODE
+{
+    OP_NAME = 5,
+    OP_ENTRY_POINT = 15,
+    OP_EXECUTION_MODE = 16,
+    OP_CAPABILITY = 17,
+    OP_TYPE_BOOL = 20,
+    OP_TYPE_INT = 21,
+    OP_TYPE_FLOAT = 22,
+    OP_TYPE_VECTOR = 23,
+    OP_TYPE_MATRIX = 24,
+    OP_TYPE_ARRAY = 28,
+    OP_TYPE_RUNTIME_ARRAY = 29,
+    OP_TYPE_STRUCT = 30,
+    OP_TYPE_POINTER = 32,
+    OP_CONSTANT = 43,
+    OP_CONSTANT_COMPOSITE = 44,
+    OP_SPEC_CONSTANT_TRUE = 48,
+    OP_SPEC_CONSTANT_FALSE = 49,
+    OP_SPEC_CONSTANT = 50,
+    OP_SPEC_CONSTANT_COMPOSITE = 51,
+    OP_FUNCTION = 54,
+    OP_VARIABLE = 59,
+    OP_DECORATE = 71,
+    OP_MEMBER_DECORATE = 72
+};
+
+enum SPIRV_DECORATION
+{
+    DECORATION_SPEC_ID = 1,
+    DECORATION_BLOCK = 2,
+    DECORATION_BUFFER_BLOCK = 3,
+    DECORATION_ARRAY_STRIDE = 6,
+    DECORATION_BUILT_IN = 11,
+    DECORATION_BINDING = 33,
+    DECORATION_DESCRIPTOR_SET = 34,
+    DECORATION_OFFSET = 35
+};
+
+static const uint32_t EXECUTION_MODEL_GL_COMPUTE = 5;
+static const uint32_t EXECUTION_MODE_LOCAL_SIZE = 17;
+static const uint32_t BUILT_IN_WORKGROUP_SIZE = 25;
+static const uint32_t STORAGE_CLASS_UNIFORM_CONSTANT = 0;
+static const uint32_t STORAGE_CLASS_UNIFORM = 2;
+static const uint32_t STORAGE_CLASS_WORKGROUP = 4;
+static const uint32_t STORAGE_CLASS_PUSH_CONSTANT = 9;
+static const uint32_t STORAGE_CLASS_STORAGE_BUFFER = 12;
+//nested types deeper than this are considered malformed
+static const uint32_t MAX_TYPE_DEPTH = 32;
+
+namespace
+{
+    struct Type
+    {
+        uint32_t opcode;
+        //width of scalar, number of components or columns
+        uint32_t size;
+        //type of element, component, column or pointee
+        uint32_t elementType;
+        //id of length of array or storage class of pointer
+        uint32_t length;
+        std::vector<uint32_t> members;
+    };
+
+    struct Decorations
+    {
+        std::map<uint32_t, uint32_t> values;
+        std::map<uint32_t, std::map<uint32_t, uint32_t>> memberValues;
+
+        bool has(uint32_t decoration) const { return values.count(decoration) > 0; }
+
+        uint32_t get(uint32_t decoration) const
+        {
+            auto found = values.find(decoration);
+            return found != values.end() ? found->second : 0;
+        }
+    };
+
+    struct Module
+    {
+        std::map<uint32_t, Type> types;
+        std::map<uint32_t, uint32_t> constants;
+        std::map<uint32_t, std::vector<uint32_t>> composites;
+        std::map<uint32_t, Decorations> decorations;
+        std::map<uint32_t, std::string> names;
+        std::map<uint32_t, uint32_t> specializationConstants;
+
+        uint32_t getTypeSize(uint32_t typeId, uint32_t depth) const;
+    };
+}
+
+uint32_t Module::getTypeSize(uint32_t typeId, uint32_t depth) const
+{
+    auto found = types.find(typeId);
+    if (found == types.end() || depth > MAX_TYPE_DEPTH)
+        throw ShaderLoadingException("SPIR-V module has invalid type");
+    const Type& type = found->second;
+    auto foundDecorations = decorations.find(typeId);
+    switch (type.opcode)
+    {
+        case OP_TYPE_BOOL:
+            return 4;
+        case OP_TYPE_INT:
+        case OP_TYPE_FLOAT:
+            return type.size / 8;
+        case OP_TYPE_VECTOR:
+        case OP_TYPE_MATRIX:
+            return type.size * getTypeSize(type.elementType, depth + 1);
+        case OP_TYPE_ARRAY:
+        {
+            auto length = constants.find(type.length);
+            if (length == constants.end())
+                throw ShaderLoadingException("SPIR-V module has array of unknown length");
+            uint32_t stride = foundDecorations != decorations.end() &&
+                              foundDecorations->second.has(DECORATION_ARRAY_STRIDE) ?
+                              foundDecorations->second.get(DECORATION_ARRAY_STRIDE) :
+                              getTypeSize(type.elementType, depth + 1);
+            return length->second * stride;
+        }
+        case OP_TYPE_STRUCT:
+        {
+            //explicit offsets of blocks are respected, other structs are packed
+            uint32_t size = 0;
+            for (size_t i = 0; i < type.members.size(); ++i)
+            {
+                uint32_t memberSize = getTypeSize(type.members[i], depth + 1);
+                if (foundDecorations != decorations.end())
+                {
+                    auto& memberValues = foundDecorations->second.memberValues;
+                    auto member = memberValues.find(static_cast<uint32_t>(i));
+                    if (member != memberValues.end() && member->second.count(DECORATION_OFFSET))
+                    {
+                        size = std::max(size, member->second.at(DECORATION_OFFSET) + memberSize);
+                        continue;
+                    }
+                }
+                size += memberSize;
+            }
+            return size;
+        }
+        default:
+            //runtime arrays have no static size
+            return 0;
+    }
+}
+
+static std::string readString(const uint32_t* words, size_t wordCount)
+{
+    const char* begin = reinterpret_cast<const char*>(words);
+    return std::string(begin, strnlen(begin, wordCount * sizeof(uint32_t)));
+}
+
+const uint32_t ShaderReflection::NO_SPECIALIZATION;
+
+ShaderReflection::ShaderReflection() : m_hasEntryPoint(false), m_isCompute(false), m_pushConstantsSize(0)
+{
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        m_localSize[i] = 1;
+        m_localSizeIds[i] = NO_SPECIALIZATION;
+    }
+}
+
+ShaderReflection::ShaderReflection(const std::vector<uint32_t>& code, const char* entryPoint) : ShaderReflection()
+{
+    if (code.size() < SPIRV_HEADER_SIZE || code[0] != SPIRV_MAGIC)
+        throw ShaderLoadingException("Code is not SPIR-V module");
+
+    Module module;
+    std::vector<std::pair<uint32_t, uint32_t>> variables;
+    uint32_t entryPointId = 0;
+    std::map<uint32_t, std::vector<uint32_t>> localSizes;
+    size_t offset = SPIRV_HEADER_SIZE;
+    while (offset < code.size())
+    {
+        uint32_t wordCount = code[offset] >> 16;
+        uint32_t opcode = code[offset] & 0xFFFF;
+        if (wordCount == 0 || offset + wordCount > code.size())
+            throw ShaderLoadingException("SPIR-V module is truncated");
+        const uint32_t* operands = &code[offset + 1];
+        uint32_t operandCount = wordCount - 1;
+        offset += wordCount;
+        //declarations precede functions, which are not reflected
+        if (opcode == OP_FUNCTION)
+            break;
+        if (operandCount < 1)
+            continue;
+
+        switch (opcode)
+        {
+            case OP_ENTRY_POINT:
+                if (operandCount >= 3 && readString(operands + 2, operandCount - 2) == entryPoint)
+                {
+                    m_hasEntryPoint = true;
+                    m_isCompute = operands[0] == EXECUTION_MODEL_GL_COMPUTE;
+                    entryPointId = operands[1];
+                }
+                break;
+            case OP_EXECUTION_MODE:
+                if (operandCount >= 5 && operands[1] == EXECUTION_MODE_LOCAL_SIZE)
+                    localSizes[operands[0]] = std::vector<uint32_t>(operands + 2, operands + 5);
+                break;
+            case OP_CAPABILITY:
+                m_capabilities.push_back(operands[0]);
+                break;
+            case OP_TYPE_BOOL:
+            case OP_TYPE_INT:
+            case OP_TYPE_FLOAT:
+            case OP_TYPE_VECTOR:
+            case OP_TYPE_MATRIX:
+            case OP_TYPE_ARRAY:
+            case OP_TYPE_RUNTIME_ARRAY:
+            case OP_TYPE_POINTER:
+            {
+                Type type = {opcode, 0, 0, 0, std::vector<uint32_t>()};
+                if (opcode == OP_TYPE_INT || opcode == OP_TYPE_FLOAT)
+                    type.size = operandCount >= 2 ? operands[1] : 0;
+                else if ((opcode == OP_TYPE_VECTOR || opcode == OP_TYPE_MATRIX) && operandCount >= 3)
+                {
+                    type.elementType = operands[1];
+                    type.size = operands[2];
+                }
+                else if (opcode == OP_TYPE_ARRAY && operandCount >= 3)
+                {
+                    type.elementType = operands[1];
+                    type.length = operands[2];
+                }
+                else if (opcode == OP_TYPE_RUNTIME_ARRAY && operandCount >= 2)
+                    type.elementType = operands[1];
+                else if (opcode == OP_TYPE_POINTER && operandCount >= 3)
+                {
+                    type.length = operands[1];
+                    type.elementType = operands[2];
+                }
+                module.types[operands[0]] = type;
+                break;
+            }
+            case OP_TYPE_STRUCT:
+                module.types[operands[0]] = {opcode, 0, 0, 0,
+                                             std::vector<uint32_t>(operands + 1, operands + operandCount)};
+                break;
+            case OP_NAME:
+                if (operandCount >= 2)
+                    module.names[operands[0]] = readString(operands + 1, operandCount - 1);
+                break;
+            case OP_CONSTANT:
+            case OP_SPEC_CONSTANT:
+                //only the low word is needed for sizes and lengths
+                if (operandCount >= 3)
+                    module.constants[operands[1]] = operands[2];
+                if (opcode == OP_SPEC_CONSTANT && operandCount >= 3)
+                    module.specializationConstants[operands[1]] = operands[2];
+                break;
+            case OP_SPEC_CONSTANT_TRUE:
+            case OP_SPEC_CONSTANT_FALSE:
+                if (operandCount >= 2)
+                    module.specializationConstants[operands[1]] = opcode == OP_SPEC_CONSTANT_TRUE ? 1 : 0;
+                break;
+            case OP_CONSTANT_COMPOSITE:
+            case OP_SPEC_CONSTANT_COMPOSITE:
+                if (operandCount >= 2)
+                    module.composites[operands[1]] = std::vector<uint32_t>(operands + 2, operands + operandCount);
+                break;
+            case OP_VARIABLE:
+                if (operandCount >= 3)
+                    variables.push_back(std::make_pair(operands[1], operands[0]));
+                break;
+            case OP_DECORATE:
+                if (operandCount >= 2)
+                    module.decorations[operands[0]].values[operands[1]] = operandCount >= 3 ? operands[2] : 0;
+                break;
+            case OP_MEMBER_DECORATE:
+                if (operandCount >= 3)
+                    module.decorations[operands[0]].memberValues[operands[1]][operands[2]] =
+                            operandCount >= 4 ? operands[3] : 0;
+                break;
+            default:
+                break;
+        }
+    }
+
+    auto localSize = localSizes.find(entryPointId);
+    if (localSize != localSizes.end())
+        std::copy(localSize->second.begin(), localSize->second.end(), m_localSize);
+    //WorkgroupSize built-in overrides execution mode, its components may be specialization constants
+    for (auto& composite : module.composites)
+    {
+        auto decorations = module.decorations.find(composite.first);
+        if (decorations == module.decorations.end() || !decorations->second.has(DECORATION_BUILT_IN) ||
+            decorations->second.get(DECORATION_BUILT_IN) != BUILT_IN_WORKGROUP_SIZE)
+            continue;
+        for (uint32_t i = 0; i < 3 && i < composite.second.size(); ++i)
+        {
+            uint32_t component = composite.second[i];
+            auto value = module.constants.find(component);
+            if (value != module.constants.end())
+                m_localSize[i] = value->second;
+            auto componentDecorations = module.decorations.find(component);
+            if (componentDecorations != module.decorations.end() &&
+                componentDecorations->second.has(DECORATION_SPEC_ID))
+                m_localSizeIds[i] = componentDecorations->second.get(DECORATION_SPEC_ID);
+        }
+    }
+
+    for (auto& constant : module.specializationConstants)
+    {
+        auto decorations = module.decorations.find(constant.first);
+        if (decorations != module.decorations.end() && decorations->second.has(DECORATION_SPEC_ID))
+            m_specializationConstants[decorations->second.get(DECORATION_SPEC_ID)] = constant.second;
+    }
+
+    for (auto& variable : variables)
+    {
+        auto pointer = module.types.find(variable.second);
+        if (pointer == module.types.end() || pointer->second.opcode != OP_TYPE_POINTER)
+            throw ShaderLoadingException("SPIR-V module has variable of invalid type");
+        uint32_t storageClass = pointer->second.length;
+        uint32_t typeId = pointer->second.elementType;
+        switch (storageClass)
+        {
+            case STORAGE_CLASS_WORKGROUP:
+            {
+                //lengths of shared arrays are often specialization constants, like local size
+                SharedVariable sharedVariable;
+                auto type = module.types.find(typeId);
+                while (type != module.types.end() && type->second.opcode == OP_TYPE_ARRAY &&
+                       sharedVariable.lengths.size() < MAX_TYPE_DEPTH)
+                {
+                    auto length = module.constants.find(type->second.length);
+                    if (length == module.constants.end())
+                        throw ShaderLoadingException("SPIR-V module has array of unknown length");
+                    auto lengthDecorations = module.decorations.find(type->second.length);
+                    bool isSpecialized = lengthDecorations != module.decorations.end() &&
+                                         lengthDecorations->second.has(DECORATION_SPEC_ID);
+                    sharedVariable.lengths.push_back(std::make_pair(
+                            length->second,
+                            isSpecialized ? lengthDecorations->second.get(DECORATION_SPEC_ID) : NO_SPECIALIZATION));
+                    typeId = type->second.elementType;
+                    type = module.types.find(typeId);
+                }
+                sharedVariable.elementSize = module.getTypeSize(typeId, 0);
+                m_sharedVariables.push_back(sharedVariable);
+                break;
+            }
+            case STORAGE_CLASS_PUSH_CONSTANT:
+                m_pushConstantsSize = std::max(m_pushConstantsSize, module.getTypeSize(typeId, 0));
+                break;
+            case STORAGE_CLASS_UNIFORM_CONSTANT:
+            case STORAGE_CLASS_UNIFORM:
+            case STORAGE_CLASS_STORAGE_BUFFER:
+            {
+                Binding binding = {0, 0, BINDING_OTHER, 1, module.names[variable.first]};
+                auto decorations = module.decorations.find(variable.first);
+                if (decorations != module.decorations.end())
+                {
+                    binding.set = decorations->second.get(DECORATION_DESCRIPTOR_SET);
+                    binding.binding = decorations->second.get(DECORATION_BINDING);
+                }
+                //arrays of descriptors are unwrapped to their element type
+                auto type = module.types.find(typeId);
+                if (type != module.types.end() && type->second.opcode == OP_TYPE_ARRAY)
+                {
+                    auto length = module.constants.find(type->second.length);
+                    binding.count = length != module.constants.end() ? length->second : 1;
+                    typeId = type->second.elementType;
+                }
+                else if (type != module.types.end() && type->second.opcode == OP_TYPE_RUNTIME_ARRAY)
+                {
+                    binding.count = 0;
+                    typeId = type->second.elementType;
+                }
+                //instance of block without name is accessed by names of members
+                if (binding.name.empty())
+                    binding.name = module.names[typeId];
+                auto typeDecorations = module.decorations.find(typeId);
+                bool isBufferBlock = typeDecorations != module.decorations.end() &&
+                                     typeDecorations->second.has(DECORATION_BUFFER_BLOCK);
+                if (storageClass == STORAGE_CLASS_STORAGE_BUFFER ||
+                    (storageClass == STORAGE_CLASS_UNIFORM && isBufferBlock))
+                    binding.type = BINDING_STORAGE_BUFFER;
+                else if (storageClass == STORAGE_CLASS_UNIFORM)
+                    binding.type = BINDING_UNIFORM_BUFFER;
+                m_bindings.push_back(binding);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    std::sort(m_bindings.begin(), m_bindings.end(), [](const Binding& left, const Binding& right)
+    {
+        return left.set != right.set ? left.set < right.set : left.binding < right.binding;
+    });
+}
+
+uint32_t ShaderReflection::getLocalSize(uint32_t dimension,
+                                        const std::map<uint32_t, uint32_t>& specializationConstants) const
+{
+    if (dimension >= 3)
+        throw InvalidArgumentException("Workgroup has only 3 dimensions");
+    if (m_localSizeIds[dimension] != NO_SPECIALIZATION)
+    {
+        auto found = specializationConstants.find(m_localSizeIds[dimension]);
+        if (found != specializationConstants.end())
+            return found->second;
+    }
+    return m_localSize[dimension];
+}
+
+uint64_t ShaderReflection::getSharedMemorySize(const std::map<uint32_t, uint32_t>& specializationConstants) const
+{
+    uint64_t size = 0;
+    for (auto& variable : m_sharedVariables)
+    {
+        uint64_t variableSize = variable.elementSize;
+        for (auto& length : variable.lengths)
+        {
+            auto found = length.second != NO_SPECIALIZATION ? specializationConstants.find(length.second) :
+                         specializationConstants.end();
+            variableSize *= found != specializationConstants.end() ? found->second : length.first;
+        }
+        size += variableSize;
+    }
+    return size;
+}
+
+const ShaderReflection::Binding* ShaderReflection::findBinding(const char* name) const
+{
+    for (auto& binding : m_bindings)
+    {
+        if (!binding.name.empty() && binding.name == name)
+            return &binding;
+    }
+    return nullptr;
+}
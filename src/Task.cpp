@@ -0,0 +1,117 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Task.cpp
+ * \brief Contains Task class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Task.hpp"
+
+#include <cstring>
+
+using namespace Vulkalc;
+
+Task::Task(TYPE type) : m_type(type), m_pShader(nullptr), m_pushConstantsSize(0), m_fillValue(0)
+{
+    m_groupCount[0] = m_groupCount[1] = m_groupCount[2] = 0;
+}
+
+Task::Task(Shader* shader, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) : Task(TYPE_DISPATCH)
+{
+    if (shader == nullptr)
+        throw InvalidArgumentException("Shader is required to create dispatch Task");
+
+    m_pShader = shader;
+    m_groupCount[0] = groupCountX;
+    m_groupCount[1] = groupCountY;
+    m_groupCount[2] = groupCountZ;
+}
+
+Task Task::fill(const BufferBase& buffer, uint32_t value)
+{
+    Task task(TYPE_FILL);
+    task.m_buffers.push_back(&buffer);
+    task.m_accesses.push_back(ACCESS_WRITE);
+    task.m_fillValue = value;
+    return task;
+}
+
+Task Task::copy(const BufferBase& source, const BufferBase& destination)
+{
+    if (source.getAllocatedSize() > destination.getAllocatedSize())
+        throw InvalidArgumentException("Source buffer doesn't fit in destination buffer");
+
+    Task task(TYPE_COPY);
+    task.m_buffers.push_back(&source);
+    task.m_buffers.push_back(&destination);
+    task.m_accesses.push_back(ACCESS_READ);
+    task.m_accesses.push_back(ACCESS_WRITE);
+    return task;
+}
+
+Task& Task::bind(const BufferBase& buffer, ACCESS access)
+{
+    m_buffers.push_back(&buffer);
+    m_accesses.push_back(access);
+    return *this;
+}
+
+Task& Task::bind(const char* name, const BufferBase& buffer, ACCESS access)
+{
+    if (m_type != TYPE_DISPATCH)
+        throw InvalidArgumentException("Buffers can be bound by name only to dispatch Task");
+    const ShaderReflection::Binding* binding = m_pShader->getReflection().findBinding(name);
+    if (binding == nullptr || binding->set != 0 || binding->type != ShaderReflection::BINDING_STORAGE_BUFFER)
+        throw InvalidArgumentException((std::string("Shader has no storage buffer ") + name).c_str());
+
+    if (binding->binding >= m_buffers.size())
+    {
+        m_buffers.resize(binding->binding + 1, nullptr);
+        m_accesses.resize(binding->binding + 1, ACCESS_READ);
+    }
+    m_buffers[binding->binding] = &buffer;
+    m_accesses[binding->binding] = access;
+    return *this;
+}
+
+Task& Task::setPushConstants(const void* data, uint32_t size)
+{
+    if (size > MAX_PUSH_CONSTANTS_SIZE)
+        throw InvalidArgumentException("Push constants exceed maximum size");
+    if (size % 4 != 0)
+        throw InvalidArgumentException("Size of push constants must be multiple of 4");
+
+    memcpy(m_pushConstants, data, size);
+    m_pushConstantsSize = size;
+    return *this;
+}
+
+Task& Task::setSpecializationConstant(uint32_t constantId, uint32_t value)
+{
+    m_specializationConstants[constantId] = value;
+    return *this;
+}
@@ -0,0 +1,148 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file TraceWriter.cpp
+ * \brief Contains TraceWriter class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/TraceWriter.hpp"
+#include "include/Utilities.h"
+
+#include <iomanip>
+#include <utility>
+
+using namespace Vulkalc;
+
+TraceWriter::TraceWriter(const char* path) : m_file(path, std::ios::out | std::ios::trunc),
+                                            m_startTime(std::chrono::steady_clock::now()), m_pushedCount(0),
+                                            m_writtenCount(0), m_isStopping(false), m_isFirstEvent(true)
+{
+    if (!m_file.is_open())
+        throw InvalidArgumentException("Failed to create trace file");
+    m_file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    m_thread = std::thread(&TraceWriter::run, this);
+}
+
+TraceWriter::~TraceWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeCondition.notify_one();
+    m_thread.join();
+    write(m_pendingEvents);
+    //metadata events may be anywhere in trace
+    for (auto& trackName : m_trackNames)
+    {
+        m_file << (m_isFirstEvent ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+               << trackName.first << ",\"args\":{\"name\":\"" << escapeJson(trackName.second) << "\"}}";
+        m_isFirstEvent = false;
+    }
+    m_file << "\n]}\n";
+}
+
+double TraceWriter::fromSteadyClock(int64_t nanoseconds) const
+{
+    int64_t start = std::chrono::duration_cast<std::chrono::nanoseconds>(m_startTime.time_since_epoch()).count();
+    return (nanoseconds - start) / 1000.0;
+}
+
+void TraceWriter::setTrackName(uint32_t track, const char* name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_trackNames[track] = name;
+}
+
+void TraceWriter::addSpan(const char* name, const char* category, double beginMicroseconds, double endMicroseconds,
+                          uint32_t track)
+{
+    Event event = {name, category, beginMicroseconds, endMicroseconds - beginMicroseconds, track};
+    push(std::move(event));
+}
+
+void TraceWriter::push(Event event)
+{
+    bool isThresholdReached;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingEvents.push_back(std::move(event));
+        ++m_pushedCount;
+        isThresholdReached = m_pendingEvents.size() >= FLUSH_THRESHOLD;
+    }
+    if (isThresholdReached)
+        m_wakeCondition.notify_one();
+}
+
+void TraceWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t pushedCount = m_pushedCount;
+    m_wakeCondition.notify_one();
+    m_writtenCondition.wait(lock, [this, pushedCount]() { return m_writtenCount >= pushedCount; });
+}
+
+uint64_t TraceWriter::getWrittenCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_writtenCount;
+}
+
+void TraceWriter::write(const std::vector<Event>& events)
+{
+    //names come from shader file names and user code, so they may contain any characters
+    for (auto& event : events)
+    {
+        m_file << (m_isFirstEvent ? "" : ",") << "\n{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\""
+               << escapeJson(event.category) << "\",\"ph\":\"X\",\"ts\":" << event.timestamp << ",\"dur\":"
+               << event.duration << ",\"pid\":1,\"tid\":" << event.track << "}";
+        m_isFirstEvent = false;
+    }
+    m_file.flush();
+}
+
+void TraceWriter::run()
+{
+    //events are swapped out under lock and formatted without it, so producers wait only for push_back
+    std::vector<Event> events;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_isStopping)
+    {
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(100));
+        if (m_pendingEvents.empty())
+            continue;
+
+        events.swap(m_pendingEvents);
+        lock.unlock();
+        write(events);
+        size_t writtenCount = events.size();
+        events.clear();
+        lock.lock();
+        m_writtenCount += writtenCount;
+        m_writtenCondition.notify_all();
+    }
+}
@@ -0,0 +1,137 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file TuningDatabase.cpp
+ * \brief Contains TuningDatabase class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/TuningDatabase.hpp"
+#include "include/Utilities.h"
+
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+using namespace Vulkalc;
+
+static bool isName(const std::string& name)
+{
+    if (name.empty() || name[0] == '#')
+        return false;
+    for (char character : name)
+    {
+        if (character == ' ' || character == '\t' || character == '\n' || character == '\r')
+            return false;
+    }
+    return true;
+}
+
+std::string TuningDatabase::getDeviceKey(const VkPhysicalDeviceProperties& properties)
+{
+    char key[2 * VK_UUID_SIZE + 16];
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+        snprintf(key + 2 * i, 3, "%02x", properties.pipelineCacheUUID[i]);
+    snprintf(key + 2 * VK_UUID_SIZE, 16, "-%u", properties.driverVersion);
+    return key;
+}
+
+bool TuningDatabase::load(const char* path)
+{
+    if (path == nullptr)
+        throw InvalidArgumentException("Path to tuning database is required");
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream stream(line);
+        std::string deviceKey, kernel, parameter;
+        long long value = 0;
+        if (!(stream >> deviceKey) || deviceKey[0] == '#')
+            continue;
+        std::string rest;
+        if (!(stream >> kernel >> parameter >> value) || value <= 0 ||
+            value > std::numeric_limits<uint32_t>::max() || (stream >> rest))
+            throw InvalidArgumentException("Tuning database is malformed");
+        m_devices[deviceKey][kernel][parameter] = static_cast<uint32_t>(value);
+    }
+    return true;
+}
+
+void TuningDatabase::save(const char* path) const
+{
+    if (path == nullptr)
+        throw InvalidArgumentException("Path to tuning database is required");
+
+    //file is replaced at once, so Runner never loads half-written database
+    auto write = [this](std::ostream& file)
+    {
+        file << "# Vulkalc tuning database: device kernel parameter value\n";
+        for (auto& device : m_devices)
+        {
+            for (auto& kernel : device.second)
+            {
+                for (auto& parameter : kernel.second)
+                    file << device.first << " " << kernel.first << " " << parameter.first << " " << parameter.second
+                         << "\n";
+            }
+        }
+    };
+    if (!replaceFile(path, false, write))
+        throw InvalidArgumentException("Failed to write tuning database");
+}
+
+TuningDatabase::KernelParameters TuningDatabase::getKernelParameters(const std::string& deviceKey) const
+{
+    auto found = m_devices.find(deviceKey);
+    return found != m_devices.end() ? found->second : KernelParameters();
+}
+
+void TuningDatabase::setKernelParameters(const std::string& deviceKey, const KernelParameters& parameters)
+{
+    if (!isName(deviceKey))
+        throw InvalidArgumentException("Device key must not contain whitespace");
+    for (auto& kernel : parameters)
+    {
+        if (!isName(kernel.first))
+            throw InvalidArgumentException("Kernel name must not contain whitespace");
+        for (auto& parameter : kernel.second)
+        {
+            if (!isName(parameter.first))
+                throw InvalidArgumentException("Parameter name must not contain whitespace");
+            if (parameter.second == 0)
+                throw InvalidArgumentException("Value of kernel parameter must be greater than 0");
+        }
+    }
+    if (parameters.empty())
+        m_devices.erase(deviceKey);
+    else
+        m_devices[deviceKey] = parameters;
+}
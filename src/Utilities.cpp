@@ -0,0 +1,101 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Utilities.cpp
+ * \brief Contains implementation of utility functions
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Utilities.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+#include <process.h>
+#define VULKALC_GET_PROCESS_ID _getpid
+#else
+#include <unistd.h>
+#define VULKALC_GET_PROCESS_ID getpid
+#endif
+
+std::string Vulkalc::escapeJson(const std::string& text)
+{
+    std::string escaped;
+    for (char character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped += '\\';
+            escaped += character;
+        }
+        else if (static_cast<unsigned char>(character) < 0x20)
+        {
+            char code[8];
+            snprintf(code, sizeof(code), "\\u%04x", character);
+            escaped += code;
+        }
+        else
+            escaped += character;
+    }
+    return escaped;
+}
+
+bool Vulkalc::replaceFile(const char* path, bool isBinary, const std::function<void(std::ostream&)>& write)
+{
+    if (path == nullptr)
+        return false;
+    //process id separates processes, counter separates threads and calls of one process
+    static std::atomic<unsigned> temporaryFileCount(0);
+    std::string temporaryPath = std::string(path) + "." + std::to_string(VULKALC_GET_PROCESS_ID()) + "." +
+                                std::to_string(temporaryFileCount.fetch_add(1)) + ".tmp";
+    {
+        std::ofstream file(temporaryPath.c_str(), isBinary ? std::ios::binary | std::ios::trunc : std::ios::trunc);
+        if (!file.is_open())
+            return false;
+        write(file);
+        file.flush();
+        if (!file)
+        {
+            file.close();
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporaryPath.c_str(), path) != 0)
+    {
+#ifdef _WIN32
+        //rename doesn't replace existing file on Windows
+        std::remove(path);
+        if (std::rename(temporaryPath.c_str(), path) == 0)
+            return true;
+#endif
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
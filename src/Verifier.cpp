@@ -0,0 +1,232 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Verifier.cpp
+ * \brief Contains Verifier class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "include/Verifier.hpp"
+
+using namespace Vulkalc;
+
+namespace
+{
+    /*
+     * Capability, which isn't available on every Vulkan 1.0 device. Capabilities without feature need
+     * Vulkan 1.1 or device extension, which Runner doesn't enable
+     */
+    struct Capability
+    {
+        uint32_t id;
+        const char* name;
+        VkBool32 VkPhysicalDeviceFeatures::* feature;
+    };
+}
+
+static const Capability CAPABILITIES[] = {
+        {9,    "Float16",                        nullptr},
+        {10,   "Float64",                        &VkPhysicalDeviceFeatures::shaderFloat64},
+        {11,   "Int64",                          &VkPhysicalDeviceFeatures::shaderInt64},
+        {12,   "Int64Atomics",                   nullptr},
+        {22,   "Int16",                          &VkPhysicalDeviceFeatures::shaderInt16},
+        {39,   "Int8",                           nullptr},
+        {49,   "StorageImageExtendedFormats",    &VkPhysicalDeviceFeatures::shaderStorageImageExtendedFormats},
+        {55,   "StorageImageReadWithoutFormat",  &VkPhysicalDeviceFeatures::shaderStorageImageReadWithoutFormat},
+        {56,   "StorageImageWriteWithoutFormat", &VkPhysicalDeviceFeatures::shaderStorageImageWriteWithoutFormat},
+        {61,   "GroupNonUniform",                nullptr},
+        {62,   "GroupNonUniformVote",            nullptr},
+        {63,   "GroupNonUniformArithmetic",      nullptr},
+        {64,   "GroupNonUniformBallot",          nullptr},
+        {65,   "GroupNonUniformShuffle",         nullptr},
+        {66,   "GroupNonUniformShuffleRelative", nullptr},
+        {67,   "GroupNonUniformClustered",       nullptr},
+        {68,   "GroupNonUniformQuad",            nullptr},
+        {4423, "SubgroupBallotKHR",              nullptr},
+        {4431, "SubgroupVoteKHR",                nullptr},
+        {4433, "StorageBuffer16BitAccess",       nullptr},
+        {4441, "VariablePointersStorageBuffer",  nullptr},
+        {4442, "VariablePointers",               nullptr},
+        {5345, "VulkanMemoryModel",              nullptr}
+};
+
+static void addDiagnostic(std::vector<Verifier::Diagnostic>& diagnostics, Verifier::DIAGNOSTIC_CODE code,
+                          const std::string& message, uint64_t value, uint64_t limit)
+{
+    Verifier::Diagnostic diagnostic = {code, message, value, limit};
+    diagnostics.push_back(diagnostic);
+}
+
+static std::string describeLimit(const char* what, uint64_t value, uint64_t limit)
+{
+    return std::string(what) + " " + std::to_string(value) + " exceeds limit " + std::to_string(limit);
+}
+
+Verifier::Verifier(const VkPhysicalDeviceLimits& limits, const VkPhysicalDeviceFeatures& enabledFeatures) :
+        m_vkLimits(limits), m_vkEnabledFeatures(enabledFeatures)
+{
+    init();
+}
+
+Verifier::~Verifier()
+{
+    release();
+}
+
+void Verifier::init()
+{
+
+}
+
+void Verifier::release()
+{
+
+}
+
+std::vector<Verifier::Diagnostic> Verifier::verify(const ShaderReflection& reflection,
+                                                   const std::map<uint32_t, uint32_t>& specializationConstants) const
+{
+    std::vector<Diagnostic> diagnostics;
+    if (!reflection.hasEntryPoint())
+    {
+        addDiagnostic(diagnostics, DIAGNOSTIC_MISSING_ENTRY_POINT, "Entry point is not found", 0, 0);
+        return diagnostics;
+    }
+    if (!reflection.isCompute())
+    {
+        addDiagnostic(diagnostics, DIAGNOSTIC_NOT_COMPUTE, "Entry point is not a compute shader", 0, 0);
+        return diagnostics;
+    }
+
+    uint64_t invocationCount = 1;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        uint32_t localSize = reflection.getLocalSize(i, specializationConstants);
+        invocationCount *= localSize;
+        if (localSize == 0 || localSize > m_vkLimits.maxComputeWorkGroupSize[i])
+            addDiagnostic(diagnostics, DIAGNOSTIC_WORKGROUP_SIZE,
+                          describeLimit(("Workgroup size in dimension " + std::to_string(i)).c_str(), localSize,
+                                        m_vkLimits.maxComputeWorkGroupSize[i]),
+                          localSize, m_vkLimits.maxComputeWorkGroupSize[i]);
+    }
+    if (invocationCount > m_vkLimits.maxComputeWorkGroupInvocations)
+        addDiagnostic(diagnostics, DIAGNOSTIC_WORKGROUP_INVOCATIONS,
+                      describeLimit("Number of invocations in workgroup", invocationCount,
+                                    m_vkLimits.maxComputeWorkGroupInvocations),
+                      invocationCount, m_vkLimits.maxComputeWorkGroupInvocations);
+    uint64_t sharedMemorySize = reflection.getSharedMemorySize(specializationConstants);
+    if (sharedMemorySize > m_vkLimits.maxComputeSharedMemorySize)
+        addDiagnostic(diagnostics, DIAGNOSTIC_SHARED_MEMORY,
+                      describeLimit("Shared memory size", sharedMemorySize, m_vkLimits.maxComputeSharedMemorySize),
+                      sharedMemorySize, m_vkLimits.maxComputeSharedMemorySize);
+    if (reflection.getPushConstantsSize() > m_vkLimits.maxPushConstantsSize)
+        addDiagnostic(diagnostics, DIAGNOSTIC_PUSH_CONSTANTS,
+                      describeLimit("Push constants size", reflection.getPushConstantsSize(),
+                                    m_vkLimits.maxPushConstantsSize),
+                      reflection.getPushConstantsSize(), m_vkLimits.maxPushConstantsSize);
+
+    uint64_t storageBufferCount = 0;
+    uint64_t uniformBufferCount = 0;
+    for (auto& binding : reflection.getBindings())
+    {
+        if (binding.set >= m_vkLimits.maxBoundDescriptorSets)
+            addDiagnostic(diagnostics, DIAGNOSTIC_DESCRIPTOR_SET,
+                          describeLimit("Descriptor set index", binding.set, m_vkLimits.maxBoundDescriptorSets - 1),
+                          binding.set, m_vkLimits.maxBoundDescriptorSets - 1);
+        //runtime arrays need at least one descriptor
+        uint32_t count = binding.count > 0 ? binding.count : 1;
+        if (binding.type == ShaderReflection::BINDING_STORAGE_BUFFER)
+            storageBufferCount += count;
+        else if (binding.type == ShaderReflection::BINDING_UNIFORM_BUFFER)
+            uniformBufferCount += count;
+    }
+    if (storageBufferCount > m_vkLimits.maxPerStageDescriptorStorageBuffers)
+        addDiagnostic(diagnostics, DIAGNOSTIC_STORAGE_BUFFERS,
+                      describeLimit("Number of storage buffers", storageBufferCount,
+                                    m_vkLimits.maxPerStageDescriptorStorageBuffers),
+                      storageBufferCount, m_vkLimits.maxPerStageDescriptorStorageBuffers);
+    if (uniformBufferCount > m_vkLimits.maxPerStageDescriptorUniformBuffers)
+        addDiagnostic(diagnostics, DIAGNOSTIC_UNIFORM_BUFFERS,
+                      describeLimit("Number of uniform buffers", uniformBufferCount,
+                                    m_vkLimits.maxPerStageDescriptorUniformBuffers),
+                      uniformBufferCount, m_vkLimits.maxPerStageDescriptorUniformBuffers);
+
+    for (uint32_t capability : reflection.getCapabilities())
+    {
+        for (const Capability& known : CAPABILITIES)
+        {
+            if (known.id != capability || (known.feature != nullptr && m_vkEnabledFeatures.*known.feature))
+                continue;
+            addDiagnostic(diagnostics, DIAGNOSTIC_CAPABILITY,
+                          std::string("Capability ") + known.name + (known.feature != nullptr ?
+                                                                     " requires feature, which is not enabled" :
+                                                                     " is not supported by Vulkan 1.0 device"),
+                          capability, 0);
+        }
+    }
+    return diagnostics;
+}
+
+std::vector<Verifier::Diagnostic> Verifier::verify(const Task& task) const
+{
+    if (task.getType() != Task::TYPE_DISPATCH)
+        return std::vector<Diagnostic>();
+
+    std::vector<Diagnostic> diagnostics = verify(task.getShader()->getReflection(),
+                                                 task.getSpecializationConstants());
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        if (task.getGroupCount(i) > m_vkLimits.maxComputeWorkGroupCount[i])
+            addDiagnostic(diagnostics, DIAGNOSTIC_GROUP_COUNT,
+                          describeLimit(("Number of workgroups in dimension " + std::to_string(i)).c_str(),
+                                        task.getGroupCount(i), m_vkLimits.maxComputeWorkGroupCount[i]),
+                          task.getGroupCount(i), m_vkLimits.maxComputeWorkGroupCount[i]);
+    }
+    //push constants are stored in Task, device limit is already checked
+    uint32_t pushConstantsSize = task.getShader()->getReflection().getPushConstantsSize();
+    if (pushConstantsSize > Task::MAX_PUSH_CONSTANTS_SIZE && pushConstantsSize <= m_vkLimits.maxPushConstantsSize)
+        addDiagnostic(diagnostics, DIAGNOSTIC_PUSH_CONSTANTS,
+                      describeLimit("Push constants size", pushConstantsSize, Task::MAX_PUSH_CONSTANTS_SIZE),
+                      pushConstantsSize, Task::MAX_PUSH_CONSTANTS_SIZE);
+    for (auto& binding : task.getShader()->getReflection().getBindings())
+    {
+        if (binding.set != 0 || binding.type != ShaderReflection::BINDING_STORAGE_BUFFER || binding.count != 1 ||
+            binding.binding >= task.getBuffers().size() || task.getBuffers()[binding.binding] == nullptr)
+            addDiagnostic(diagnostics, DIAGNOSTIC_UNBOUND_BINDING,
+                          "Binding " + std::to_string(binding.binding) + " of set " + std::to_string(binding.set) +
+                          " is not a storage buffer bound by Task",
+                          binding.binding, task.getBuffers().size());
+    }
+    return diagnostics;
+}
+
+std::string Verifier::describe(const std::vector<Diagnostic>& diagnostics)
+{
+    std::string description;
+    for (auto& diagnostic : diagnostics)
+        description += (description.empty() ? "" : "; ") + diagnostic.message;
+    return description;
+}
@@ -1,9 +1,301 @@
 /*!
  * \file VulkanInfo.cpp
- * \brief 
+ * \brief Contains VulkanInfo class implementation
  * \author whyami
  * \date 28.05.2017
  *
- * 
+ *
  */
 
+#include "include/VulkanInfo.hpp"
+#include "include/Utilities.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace Vulkalc;
+
+static const char SNAPSHOT_MAGIC[8] = {'V', 'K', 'L', 'C', 'I', 'N', 'F', 'O'};
+static const uint32_t SNAPSHOT_FORMAT_VERSION = 2;
+//guards against reading huge vectors from corrupted files
+static const uint32_t MAX_SNAPSHOT_ITEMS = 1 << 16;
+
+template<typename T>
+static void writeValue(std::ostream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readValue(std::istream& stream, T& value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template<typename T>
+static void writeVector(std::ostream& stream, const std::vector<T>& values)
+{
+    writeValue(stream, static_cast<uint32_t>(values.size()));
+    if (!values.empty())
+        stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template<typename T>
+static bool readVector(std::istream& stream, std::vector<T>& values)
+{
+    uint32_t count = 0;
+    if (!readValue(stream, count) || count > MAX_SNAPSHOT_ITEMS)
+        return false;
+    values.resize(count);
+    return count == 0 || stream.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+}
+
+template<typename T>
+static std::vector<T> enumerate(VkResult (* function)(const char*, uint32_t*, T*))
+{
+    std::vector<T> values;
+    uint32_t count = 0;
+    VkResult result = VK_INCOMPLETE;
+    //count may grow between calls, if layers are installed meanwhile
+    while (result == VK_INCOMPLETE)
+    {
+        if (function(nullptr, &count, nullptr) != VK_SUCCESS)
+            return std::vector<T>();
+        values.resize(count);
+        result = function(nullptr, &count, values.data());
+    }
+    values.resize(result == VK_SUCCESS ? count : 0);
+    return values;
+}
+
+static VkResult enumerateLayers(const char*, uint32_t* count, VkLayerProperties* layers)
+{
+    return vkEnumerateInstanceLayerProperties(count, layers);
+}
+
+/*
+ * Compares properties, which device key consists of
+ */
+static bool isSameDevice(const VkPhysicalDeviceProperties& first, const VkPhysicalDeviceProperties& second)
+{
+    return first.vendorID == second.vendorID && first.deviceID == second.deviceID &&
+           first.driverVersion == second.driverVersion &&
+           memcmp(first.pipelineCacheUUID, second.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool VulkanInfo::PhysicalDeviceInfo::isExtensionSupported(const char* extensionName) const
+{
+    for (auto& extension : extensions)
+    {
+        if (strcmp(extension.extensionName, extensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
+VulkanInfo::VulkanInfo()
+{
+
+}
+
+VulkanInfo::~VulkanInfo()
+{
+
+}
+
+VulkanInfo* const VulkanInfo::getInstance()
+{
+    static VulkanInfo instance;
+    return &instance;
+}
+
+const std::vector<VkExtensionProperties>& VulkanInfo::getInstanceExtensions()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isInstanceExtensionsQueried)
+    {
+        m_instanceExtensions = enumerate(vkEnumerateInstanceExtensionProperties);
+        m_isInstanceExtensionsQueried = true;
+        m_isModified = true;
+    }
+    return m_instanceExtensions;
+}
+
+const std::vector<VkLayerProperties>& VulkanInfo::getLayers()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isLayersQueried)
+    {
+        m_layers = enumerate(enumerateLayers);
+        m_isLayersQueried = true;
+        m_isModified = true;
+    }
+    return m_layers;
+}
+
+bool VulkanInfo::isInstanceExtensionSupported(const char* extensionName)
+{
+    for (auto& extension : getInstanceExtensions())
+    {
+        if (strcmp(extension.extensionName, extensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool VulkanInfo::isLayerSupported(const char* layerName)
+{
+    for (auto& layer : getLayers())
+    {
+        if (strcmp(layer.layerName, layerName) == 0)
+            return true;
+    }
+    return false;
+}
+
+const VulkanInfo::PhysicalDeviceInfo& VulkanInfo::getPhysicalDeviceInfo(VkPhysicalDevice physicalDevice)
+{
+    //properties identify saved device, they are cheap to query unlike extensions
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    //handle of device of destroyed instance may be reused for other device, so hit is checked by properties
+    auto foundHandle = m_devicesByHandle.find(physicalDevice);
+    if (foundHandle != m_devicesByHandle.end() && isSameDevice(foundHandle->second->properties, properties))
+        return *foundHandle->second;
+
+    std::string key = getDeviceKey(properties);
+    auto found = m_devices.find(key);
+    if (found == m_devices.end())
+    {
+        PhysicalDeviceInfo info;
+        info.properties = properties;
+        vkGetPhysicalDeviceFeatures(physicalDevice, &info.features);
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &info.memoryProperties);
+
+        uint32_t queueFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+        info.queueFamilies.resize(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, info.queueFamilies.data());
+
+        uint32_t extensionCount = 0;
+        if (vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr) == VK_SUCCESS)
+        {
+            info.extensions.resize(extensionCount);
+            VkResult result = vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount,
+                                                                   info.extensions.data());
+            info.extensions.resize(result == VK_SUCCESS || result == VK_INCOMPLETE ? extensionCount : 0);
+        }
+        found = m_devices.insert(std::make_pair(key, info)).first;
+        m_isModified = true;
+    }
+    m_devicesByHandle[physicalDevice] = &found->second;
+    return found->second;
+}
+
+bool VulkanInfo::load(const char* path)
+{
+    if (path == nullptr)
+        return false;
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    uint32_t formatVersion = 0;
+    std::vector<char> key;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, formatVersion) || formatVersion != SNAPSHOT_FORMAT_VERSION || !readVector(file, key) ||
+        std::string(key.begin(), key.end()) != getCacheKey())
+        return false;
+
+    std::vector<VkExtensionProperties> instanceExtensions;
+    std::vector<VkLayerProperties> layers;
+    uint32_t deviceCount = 0;
+    if (!readVector(file, instanceExtensions) || !readVector(file, layers) || !readValue(file, deviceCount) ||
+        deviceCount > MAX_SNAPSHOT_ITEMS)
+        return false;
+    std::vector<PhysicalDeviceInfo> devices(deviceCount);
+    for (auto& device : devices)
+    {
+        if (!readValue(file, device.properties) || !readValue(file, device.features) ||
+            !readValue(file, device.memoryProperties) || !readVector(file, device.queueFamilies) ||
+            !readVector(file, device.extensions))
+            return false;
+    }
+
+    //queried categories are kept, so references returned before stay valid
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isInstanceExtensionsQueried)
+    {
+        m_instanceExtensions = instanceExtensions;
+        m_isInstanceExtensionsQueried = true;
+    }
+    if (!m_isLayersQueried)
+    {
+        m_layers = layers;
+        m_isLayersQueried = true;
+    }
+    for (auto& device : devices)
+        m_devices.insert(std::make_pair(getDeviceKey(device.properties), device));
+    return true;
+}
+
+bool VulkanInfo::save(const char* path)
+{
+    if (path == nullptr)
+        return false;
+    getInstanceExtensions();
+    getLayers();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto write = [this](std::ostream& file)
+    {
+        std::string key = getCacheKey();
+        file.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        writeValue(file, SNAPSHOT_FORMAT_VERSION);
+        writeVector(file, std::vector<char>(key.begin(), key.end()));
+        writeVector(file, m_instanceExtensions);
+        writeVector(file, m_layers);
+        writeValue(file, static_cast<uint32_t>(m_devices.size()));
+        for (auto& device : m_devices)
+        {
+            writeValue(file, device.second.properties);
+            writeValue(file, device.second.features);
+            writeValue(file, device.second.memoryProperties);
+            writeVector(file, device.second.queueFamilies);
+            writeVector(file, device.second.extensions);
+        }
+    };
+    if (!replaceFile(path, true, write))
+        return false;
+    m_isModified = false;
+    return true;
+}
+
+std::string VulkanInfo::getCacheKey()
+{
+    //set of drivers and layers, which loader finds, is defined by these variables
+    static const char* const LOADER_VARIABLES[] = {"VK_ICD_FILENAMES", "VK_DRIVER_FILES", "VK_ADD_DRIVER_FILES",
+                                                   "VK_LAYER_PATH", "VK_ADD_LAYER_PATH", "VK_INSTANCE_LAYERS"};
+    std::string key = "headers=" + std::to_string(VK_HEADER_VERSION) + ";pointer=" +
+                      std::to_string(sizeof(void*));
+    for (const char* variable : LOADER_VARIABLES)
+    {
+        const char* value = getenv(variable);
+        key += std::string(";") + variable + "=" + (value ? value : "");
+    }
+    return key;
+}
+
+std::string VulkanInfo::getDeviceKey(const VkPhysicalDeviceProperties& properties)
+{
+    char key[64 + 2 * VK_UUID_SIZE];
+    int length = snprintf(key, sizeof(key), "%08x-%08x-%08x-", properties.vendorID, properties.deviceID,
+                          properties.driverVersion);
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+        length += snprintf(key + length, 3, "%02x", properties.pipelineCacheUUID[i]);
+    return key;
+}
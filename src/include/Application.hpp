@@ -40,9 +40,8 @@
 #define VULKALC_MINOR_VERSION @PROJECT_VRESION_MINOR@
 #define VULKALC_PATCH_VERSION @PROJECT_VERSION_PATCH@
 
-#include "RAII.hpp"
 #include "Export.hpp"
-#include "Configurator.hpp"
+#include "Context.hpp"
 #include "Exceptions.h"
 
 #include <vulkan/vulkan.hpp>
@@ -58,99 +57,44 @@ namespace Vulkalc
 {
     /*!
      * \class Application
-     * \extends RAII
+     * \extends Context
      * \brief Vulkalc entry point class
      *
-     * Application class is the entry point for Vulkalc library. It contains and gives access to all Vulkalc
-     * classes and functions.
+     * Application class is the entry point for Vulkalc library. It is a Context, which is available globally,
+     * for processes, which need only one device and Configuration. Create Contexts to use several of them.
      *
      * \note Application class uses RAII and Singleton patterns. Call \code getInstance() to get pointer,
-     * call \code init() before usage and \code release() after usage.
-     *
-     * \warning This class is not thread-safe.
+     * then \code configure() before usage. Deleted Application is replaced by new one on next getInstance().
      */
-    class VULKALC_API Application : private RAII
+    class VULKALC_API Application : public Context
     {
     public:
 
         /*!
-         * \brief Returns instance of Application.
+         * \brief Returns instance of Application. It is safe to call from several threads.
          * \return constant pointer to Application.
-         * \note Uses lazy initialization, but doesn't call \code Init().
+         * \note Uses lazy initialization, configure() must be called explicitly.
          * \throws HostMemoryAllocationException - is thrown if Application fails to allocate memory in heap
-         * for Configurator when calling internal init()
+         * for Configurator
          */
         static Application* const getInstance() throw(HostMemoryAllocationException);
 
         /*!
-         * \brief Checks if Application is initialized with init().
+         * \brief Checks if Application is initialized.
          * \return is initialized flag.
          */
-        inline bool isApplicationInitialized() { return m_isInitialized; };
+        inline bool isApplicationInitialized() { return isInitialized(); };
 
         /*!
          * \brief Checks if Application is configured.
          * \return is configured flag.
          */
-        inline bool isApplicationConfigured() { return m_isConfigured; };
-
-        /*!
-         * \brief Configures Application.
-         *
-         * Configures Application with Configuration, fetched from Configurator.
-         * \note You should explicitly call \code configure() after \code init() and before anything else.
-         * \note This method would use Configuration available at the moment. So you have to change your Configuration
-         * before-hand, otherwise default values will be used.
-         * \throws ApplicationNotInitializedException - thrown if Application instance is not initialized
-         * \throws HostMemoryAllocationException - thrown if failed to allocate memory in heap
-         */
-        void configure() throw(ApplicationNotInitializedException, HostMemoryAllocationException);
-
-        /*!
-         * \brief Enumeration for logging levels
-         */
-        enum LOG_LEVEL { LOG_INFO, LOG_WARN, LOG_ERROR };
-
-        /*!
-         * \brief Writes message to logging stream, which depends on logging level
-         * \param message message to write
-         * \param level logging level
-         * \throws ApplicationNotInitializedException - thrown if Application instance is not initialized
-         * \throws ApplicationNotConf0iguredException - thrown if Application is not explicitly configured by calling \code Application::configure()
-         */
-        void log(const char* message, LOG_LEVEL level);
-
-        /*!
-         * \brief Returns constant pointer to Configurator
-         *
-         * Returns constant pointer to Configurator, which should be used to acquire Configuration
-         * and configure Application before calling \code Application::configure()
-         * \return constant pointer to Configurator
-         */
-        Configurator* const getConfigurator() { return m_pConfigurator; }
+        inline bool isApplicationConfigured() { return isConfigured(); };
 
         ~Application();
 
     private:
-        virtual void init() override;
-        virtual void release() override;
-
-        void prepareVulkanApplicationInfo();
-
-        void prepareVulkanInstanceInfo();
-
-        bool m_isInitialized = false;
-        bool m_isConfigured = false;
-
         Application();
-
-        bool m_isLoggingEnabled;
-        bool m_isErrorLoggingEnabled;
-        Configurator* m_pConfigurator;
-        std::iostream* m_pLogStream;
-        std::iostream* m_pErrorStream;
-        VkApplicationInfo* m_pVkApplicationInfo;
-        VkInstanceCreateInfo* m_pVkInstanceCreateInfo;
     };
 }
 
@@ -0,0 +1,283 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Buffer.hpp
+ * \brief Contains Buffer classes declarations
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains BufferBase and Buffer classes, which hold data in device memory
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_BUFFER_H
+#define VULKALC_LIBRARY_BUFFER_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Expected.hpp"
+#include "Metrics.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <type_traits>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    class Runner;
+
+    /*!
+     * \class BufferBase
+     * \brief Untyped storage buffer in device memory
+     *
+     * BufferBase owns VkBuffer and VkDeviceMemory bound to it. Memory is host visible and persistently mapped,
+     * so reading and writing data doesn't require any Vulkan calls.
+     * \note Allocated size is rounded up to multiple of 4 bytes, so buffer can be viewed as array of uint in shaders.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API BufferBase
+    {
+    public:
+        /*!
+         * \brief BufferBase constructor
+         * \param runner Runner, which device is used to allocate buffer
+         * \param size size of buffer in bytes
+         * \throws InvalidArgumentException - thrown if runner is nullptr or size is 0
+         * \throws VulkanException - thrown if failed to create buffer or allocate memory for it
+         */
+        BufferBase(Runner* runner, VkDeviceSize size);
+
+        /*!
+         * \brief BufferBase destructor
+         */
+        virtual ~BufferBase();
+
+        /*!
+         * \brief Returns VkBuffer handle
+         * \return VkBuffer
+         */
+        VkBuffer getVkBuffer() const { return m_vkBuffer; }
+
+        /*!
+         * \brief Returns size of buffer in bytes, which was requested on construction
+         * \return size in bytes
+         */
+        VkDeviceSize getSize() const { return m_size; }
+
+        /*!
+         * \brief Returns size of buffer in bytes, which was actually allocated
+         * \return allocated size in bytes
+         */
+        VkDeviceSize getAllocatedSize() const { return m_allocatedSize; }
+
+        /*!
+         * \brief Returns Runner, which device holds this buffer
+         * \return pointer to Runner
+         */
+        Runner* getRunner() const { return m_pRunner; }
+
+        /*!
+         * \brief Writes data to buffer
+         * \param data pointer to data to write
+         * \param size size of data in bytes
+         * \param offset offset in buffer in bytes
+         * \throws InvalidArgumentException - thrown if data doesn't fit in buffer
+         */
+        void write(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+        /*!
+         * \brief Writes data to buffer without throwing exceptions
+         * \param data pointer to data to write
+         * \param size size of data in bytes
+         * \param offset offset in buffer in bytes
+         * \return ERROR_INVALID_ARGUMENT, if data doesn't fit in buffer
+         */
+        Expected<void> tryWrite(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+        /*!
+         * \brief Reads data from buffer
+         * \param data pointer to memory to read to
+         * \param size size of data in bytes
+         * \param offset offset in buffer in bytes
+         * \throws InvalidArgumentException - thrown if requested range is out of buffer
+         */
+        void read(void* data, VkDeviceSize size, VkDeviceSize offset = 0) const;
+
+        /*!
+         * \brief Reads data from buffer without throwing exceptions
+         * \param data pointer to memory to read to
+         * \param size size of data in bytes
+         * \param offset offset in buffer in bytes
+         * \return ERROR_INVALID_ARGUMENT, if requested range is out of buffer
+         */
+        Expected<void> tryRead(void* data, VkDeviceSize size, VkDeviceSize offset = 0) const;
+
+    protected:
+        /*!
+         * \brief Runner, which owns device of this buffer
+         */
+        Runner* m_pRunner;
+
+    private:
+        BufferBase(const BufferBase&);
+
+        void operator=(const BufferBase&);
+
+        VkDeviceSize m_size;
+        VkDeviceSize m_allocatedSize;
+        VkBuffer m_vkBuffer;
+        VkDeviceMemory m_vkDeviceMemory;
+        void* m_pMappedMemory;
+        //memory usage is tracked by InformationProvider of Runner
+        uint32_t m_memoryTypeIndex;
+        VkDeviceSize m_memorySize;
+        //size is subtracted from the same gauge it was added to, even if Metrics of Runner change
+        Gauge* m_pBufferBytes;
+    };
+
+    /*!
+     * \class Buffer
+     * \extends BufferBase
+     * \brief Typed storage buffer in device memory
+     * \tparam T type of elements. Only arithmetic types are allowed
+     * \warning This class is not thread-safe.
+     */
+    template<typename T>
+    class Buffer : public BufferBase
+    {
+        static_assert(std::is_arithmetic<T>::value, "Buffer can hold only arithmetic types");
+
+    public:
+        /*!
+         * \brief Buffer constructor
+         * \param runner Runner, which device is used to allocate buffer
+         * \param count number of elements in buffer
+         * \throws InvalidArgumentException - thrown if runner is nullptr or count is 0
+         * \throws VulkanException - thrown if failed to create buffer or allocate memory for it
+         */
+        Buffer(Runner* runner, size_t count) : BufferBase(runner, count * sizeof(T)), m_count(count) {};
+
+        /*!
+         * \brief Evaluates element-wise expression into this buffer with single fused kernel
+         *
+         * Expressions are built with arithmetic operators over buffers and scalars, see Expression.hpp.
+         * \param expression expression to evaluate
+         * \return reference to this buffer
+         * \throws InvalidArgumentException - thrown if expression is too complex or its buffers are too small
+         * \throws VulkanException - thrown if failed to execute evaluation
+         */
+        template<typename E, typename = typename std::enable_if<E::IS_EXPRESSION>::type>
+        Buffer& operator=(const E& expression)
+        {
+            evaluate(*this, expression);
+            return *this;
+        }
+
+        /*!
+         * \brief Returns number of elements in buffer
+         * \return number of elements
+         */
+        size_t getCount() const { return m_count; }
+
+        /*!
+         * \brief Uploads elements to buffer
+         * \param data pointer to elements
+         * \param count number of elements to upload
+         * \param offset index of first element in buffer to write to
+         * \throws InvalidArgumentException - thrown if elements don't fit in buffer
+         */
+        void upload(const T* data, size_t count, size_t offset = 0)
+        {
+            write(data, count * sizeof(T), offset * sizeof(T));
+        }
+
+        /*!
+         * \brief Uploads elements to buffer without throwing exceptions
+         * \param data pointer to elements
+         * \param count number of elements to upload
+         * \param offset index of first element in buffer to write to
+         * \return ERROR_INVALID_ARGUMENT, if elements don't fit in buffer
+         */
+        Expected<void> tryUpload(const T* data, size_t count, size_t offset = 0)
+        {
+            return tryWrite(data, count * sizeof(T), offset * sizeof(T));
+        }
+
+        /*!
+         * \brief Uploads vector of elements to the beginning of buffer
+         * \param data vector of elements
+         * \throws InvalidArgumentException - thrown if elements don't fit in buffer
+         */
+        void upload(const std::vector<T>& data)
+        {
+            if (!data.empty())
+                upload(data.data(), data.size());
+        }
+
+        /*!
+         * \brief Downloads elements from buffer
+         * \param data pointer to memory to download to
+         * \param count number of elements to download
+         * \param offset index of first element in buffer to read from
+         * \throws InvalidArgumentException - thrown if requested range is out of buffer
+         */
+        void download(T* data, size_t count, size_t offset = 0) const
+        {
+            read(data, count * sizeof(T), offset * sizeof(T));
+        }
+
+        /*!
+         * \brief Downloads elements from buffer without throwing exceptions
+         * \param data pointer to memory to download to
+         * \param count number of elements to download
+         * \param offset index of first element in buffer to read from
+         * \return ERROR_INVALID_ARGUMENT, if requested range is out of buffer
+         */
+        Expected<void> tryDownload(T* data, size_t count, size_t offset = 0) const
+        {
+            return tryRead(data, count * sizeof(T), offset * sizeof(T));
+        }
+
+        /*!
+         * \brief Downloads all elements from buffer
+         * \return vector of elements
+         */
+        std::vector<T> download() const
+        {
+            std::vector<T> data(m_count);
+            download(data.data(), m_count);
+            return data;
+        }
+
+    private:
+        size_t m_count;
+    };
+}
+
+#endif //VULKALC_LIBRARY_BUFFER_H
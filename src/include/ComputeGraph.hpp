@@ -0,0 +1,211 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ComputeGraph.hpp
+ * \brief Contains ComputeGraph class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_COMPUTEGRAPH_H
+#define VULKALC_LIBRARY_COMPUTEGRAPH_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Task.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <map>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class ComputeGraph
+     * \brief Graph of Tasks, ordered by their accesses to buffers
+     *
+     * Task depends on earlier Tasks, which write buffers it reads or writes, and on earlier Tasks, which read
+     * buffers it writes. ComputeGraph turns these dependencies into schedules, which Runner records:
+     * Tasks without dependencies between them are recorded without barriers, every dependency is satisfied by
+     * VkBufferMemoryBarrier for its buffer only, and independent branches of graph get separate queues.
+     * Tasks, which access buffer in the same way, are not ordered, so Task order only matters for conflicting
+     * accesses.
+     * \note Buffer accesses are declared by Task::bind().
+     * \see Runner::execute(ComputeGraph&)
+     */
+    class VULKALC_API ComputeGraph
+    {
+    public:
+        /*!
+         * \brief Barrier for single buffer
+         */
+        struct BufferBarrier
+        {
+            /*!
+             * \brief Synchronized buffer
+             */
+            const BufferBase* buffer;
+            /*!
+             * \brief Accesses, which are made available
+             */
+            VkAccessFlags srcAccessMask;
+            /*!
+             * \brief Accesses, which are made visible
+             */
+            VkAccessFlags dstAccessMask;
+        };
+
+        /*!
+         * \brief Tasks, which run without barriers between them, and barrier preceding them
+         */
+        struct Step
+        {
+            /*!
+             * \brief Stages to wait for, 0 if step doesn't need barrier
+             */
+            VkPipelineStageFlags srcStageMask;
+            /*!
+             * \brief Stages, which wait
+             */
+            VkPipelineStageFlags dstStageMask;
+            /*!
+             * \brief Buffer barriers, empty if barrier is only execution dependency
+             */
+            std::vector<BufferBarrier> bufferBarriers;
+            /*!
+             * \brief Indices of Tasks in graph
+             */
+            std::vector<size_t> tasks;
+        };
+
+        /*!
+         * \brief Steps recorded into one command buffer one after another
+         */
+        typedef std::vector<Step> Schedule;
+
+        /*!
+         * \brief ComputeGraph constructor
+         */
+        ComputeGraph();
+
+        /*!
+         * \brief Adds Task to graph
+         * \param task Task to add
+         * \return index of Task in graph
+         */
+        size_t add(const Task& task);
+
+        /*!
+         * \brief Returns all Tasks of graph
+         * \return vector of Tasks in order they were added
+         */
+        const std::vector<Task>& getTasks() const { return m_tasks; }
+
+        /*!
+         * \brief Returns indices of Tasks, which Task directly depends on
+         * \param task index of Task
+         * \return indices of Tasks
+         */
+        const std::vector<size_t>& getDependencies(size_t task) const { return m_dependencies[task].tasks; }
+
+        /*!
+         * \brief Splits graph into schedules for queues
+         *
+         * Independent branches are distributed between queues, branches on the same queue share steps.
+         * Result is cached until next add().
+         * \param queueCount number of available queues
+         * \return schedule for every used queue
+         * \throws InvalidArgumentException - thrown if queueCount is 0
+         */
+        const std::vector<Schedule>& compile(uint32_t queueCount);
+
+        /*!
+         * \brief Returns number of independent branches
+         * \return number of branches
+         */
+        size_t getBranchCount() const { return m_branchCount; }
+
+        /*!
+         * \brief Returns length of the longest chain of dependent Tasks
+         * \return number of levels
+         */
+        size_t getLevelCount() const { return m_levelCount; }
+
+        /*!
+         * \brief Returns number of pipeline barriers in schedules of last compile()
+         * \return number of pipeline barriers
+         */
+        size_t getPipelineBarrierCount() const;
+
+        /*!
+         * \brief Returns number of buffer barriers in schedules of last compile()
+         * \return number of buffer barriers
+         */
+        size_t getBufferBarrierCount() const;
+
+    private:
+        //dependency on single buffer, execution only if both access masks are 0
+        struct Edge
+        {
+            size_t task;
+            const BufferBase* buffer;
+            VkAccessFlags srcAccessMask;
+            VkAccessFlags dstAccessMask;
+        };
+
+        struct Dependencies
+        {
+            std::vector<size_t> tasks;
+            std::vector<Edge> edges;
+        };
+
+        struct BufferState
+        {
+            size_t writer;
+            std::vector<size_t> readers;
+        };
+
+        void addDependency(size_t task, const Edge& edge);
+
+        size_t findBranch(size_t task);
+
+        std::vector<Task> m_tasks;
+        std::vector<Dependencies> m_dependencies;
+        std::map<const BufferBase*, BufferState> m_bufferStates;
+        std::vector<size_t> m_levels;
+        std::vector<size_t> m_branches;
+        size_t m_branchCount;
+        size_t m_levelCount;
+        uint32_t m_compiledQueueCount;
+        std::vector<Schedule> m_schedules;
+    };
+}
+
+#endif //VULKALC_LIBRARY_COMPUTEGRAPH_H
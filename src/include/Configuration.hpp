@@ -42,6 +42,10 @@
 #include <iostream>
 #include <memory>
 
+#ifndef VULKALC_SHADERS_DIR
+#define VULKALC_SHADERS_DIR "shaders"
+#endif
+
 /*!
  * \copydoc Vulkalc
  */
@@ -52,10 +56,34 @@ namespace Vulkalc
      * \brief Configuration class contains various information for Application.
      *
      * Configuration class is a container of various information used to configure VkInstance.
+     * Configurator publishes copies of it as immutable snapshots, which are read after configure().
      */
     class VULKALC_API Configuration
     {
     public:
+        /*!
+         * \brief Sets of instance layers and extensions, which Context enables
+         */
+        enum PROFILE
+        {
+            /*!
+             * \brief enabledLayersNames and enabledExtensionsNames are enabled as they are
+             */
+            PROFILE_CUSTOM,
+            /*!
+             * \brief Release set plus validation layer and available enabledLayersNames
+             */
+            PROFILE_DEBUG,
+            /*!
+             * \brief No layers, only available enabledExtensionsNames and extensions used by Runner
+             */
+            PROFILE_RELEASE,
+            /*!
+             * \brief Release set with profiling of Runner enabled
+             */
+            PROFILE_PROFILING
+        };
+
         /*!
          * \brief Name of the application, which uses Vulkalc library. Feel free to change.
          */
@@ -85,20 +113,92 @@ namespace Vulkalc
          * \brief Vector of names of enabled Vulkan extensions. Feel free to add or remove them.
          */
         std::vector<const char*> enabledExtensionsNames = std::vector<const char*>();
+        /*!
+         * \brief Profile, which selects instance layers and extensions. Custom by default.
+         * \note Every profile but custom skips unavailable layers and extensions instead of failing
+         * to create VkInstance.
+         * \see Context::selectInstanceProfile()
+         */
+        PROFILE profile = PROFILE_CUSTOM;
         /*!
          * \brief Index number of physical device to use. First device by default.
          * \note Enumeration starts from 0.
          * \note Either index number of device or devicePointer should be specified.
-         * \warning If deviceSetting is set, it overrides this setting.
+         * \warning If deviceSetting or isDeviceAutoSelected is set, it overrides this setting.
          */
         uint32_t deviceToUse = 0;
+        /*!
+         * \brief Boolean flag for selecting the fastest physical device instead of deviceToUse. Disabled by default.
+         * \warning If devicePointer is set, it overrides this setting.
+         * \see DeviceSelector
+         */
+        bool isDeviceAutoSelected = false;
+        /*!
+         * \brief Boolean flag for ordering devices by measured copy bandwidth on automatic selection.
+         * Disabled by default.
+         * \note Every device is measured once, bandwidth is cached in tuningFile, if it's set.
+         */
+        bool isDeviceBenchmarkEnabled = false;
         /*!
          * \brief Pointer to VkPhysicalDevice to use.
          * \warning If set, this setting overrides deviceToUse.
          */
         VkPhysicalDevice* devicePointer = nullptr;
+        /*!
+         * \brief Maximum number of compute queues to create. It is limited by queue family of selected device.
+         * \note Independent branches of ComputeGraph run on separate queues.
+         */
+        uint32_t computeQueueCount = 4;
+        /*!
+         * \brief Number of descriptor sets in one descriptor pool of DescriptorAllocator. 64 by default.
+         * \note Bigger pools are created less often, but hold more memory in long-running executions.
+         */
+        uint32_t descriptorSetsPerPool = 64;
+        /*!
+         * \brief Boolean flag for pushing descriptors of dispatches with VK_KHR_push_descriptor instead of
+         * allocating descriptor sets, if device supports it. Enabled by default.
+         * \see Runner::setPushDescriptorEnabled()
+         */
+        bool isPushDescriptorEnabled = true;
+        /*!
+         * \brief Boolean flag for measuring device time of every executed Task with timestamp queries.
+         * Disabled by default.
+         * \note It is ignored, if compute queue family of selected device doesn't support timestamps.
+         * \see Runner::setProfilingEnabled()
+         */
+        bool isProfilingEnabled = false;
+        /*!
+         * \brief Path to file to write trace of host and device activity in Chrome trace event format.
+         * Tracing is disabled by default.
+         * \note Device activity is traced with timestamp queries, like profiling. If VK_EXT_calibrated_timestamps
+         * is supported and VK_KHR_get_physical_device_properties2 is enabled, both are on the same clock.
+         * Statistics of Profiler are collected only if isProfilingEnabled is set as well.
+         * \see TraceWriter
+         */
+        const char* traceFile = nullptr;
+        /*!
+         * \brief Boolean flag for counting transfers, dispatches and submissions in Metrics. Enabled by default.
+         * \note Every counted event costs an uncontended atomic increment.
+         * \see Application::getMetrics()
+         */
+        bool isMetricsEnabled = true;
+        /*!
+         * \brief Path to tuning database with parameters of built-in kernels, written by autotune command
+         * of vulkalc-tools. Parameters of selected device are loaded on configure(), missing file is ignored.
+         * Disabled by default, so default parameters are used.
+         * \note Malformed file makes configure() throw InvalidArgumentException.
+         * \see TuningDatabase
+         */
+        const char* tuningFile = nullptr;
+        /*!
+         * \brief Path to file to cache VulkanInfo snapshot in, so next starts skip querying of instance and
+         * device capabilities. Disabled by default.
+         * \note Snapshot is invalidated by update of Vulkan headers, loader environment variables or drivers.
+         */
+        const char* vulkanInfoFile = nullptr;
         /*!
          * \brief Boolean flag for general logging. Enabled by default.
+         * \note Can be changed after configure() with Context::reconfigure(), if it was enabled on configure().
          */
         bool isLoggingEnabled = true;
         /*!
@@ -106,6 +206,13 @@ namespace Vulkalc
          * \note This setting is ignored if isLoggingEnabled set to false.
          */
         bool isErrorLoggingEnabled = true;
+        /*!
+         * \brief Minimum level of messages written by Context::log(), one of Context::LOG_LEVEL values.
+         * All levels are logged by default.
+         * \note Can be changed after configure() with Context::reconfigure(). Levels below VULKALC_MIN_LOG_LEVEL
+         * are skipped at compile time regardless of this setting.
+         */
+        unsigned minLogLevel = 0;
         /*!
          * \brief Output stream for general logging.
          */
@@ -114,6 +221,16 @@ namespace Vulkalc
          * \brief Output stream for error logging.
          */
         std::iostream* errorStream = nullptr;
+        /*!
+         * \brief Path to directory with compiled built-in shaders.
+         * \note By default points to directory, where shaders were compiled to during build.
+         */
+        const char* shadersDirectory = VULKALC_SHADERS_DIR;
+        /*!
+         * \brief Path to existing directory to cache shaders compiled at runtime in. Disk cache is disabled by default.
+         * \see ShaderLoader::compile()
+         */
+        const char* shaderCacheDirectory = nullptr;
 
         /*!
          * \brief Configuration constructor
@@ -126,7 +243,11 @@ namespace Vulkalc
         ~Configuration();
 
     private:
-        Configuration(const Configuration&);
+        friend class Configurator;
+        friend class Context;
+
+        //only Configurator copies Configuration into snapshots, pointers in it are borrowed, not owned
+        Configuration(const Configuration&) = default;
 
         void operator=(const Configuration&);
     };
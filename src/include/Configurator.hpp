@@ -37,6 +37,12 @@
 #include "Export.hpp"
 #include "Configuration.hpp"
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <vector>
+
 /*!
  * \copydoc Vulkalc
  */
@@ -44,17 +50,126 @@ namespace Vulkalc
 {
     /*!
      * \class Configurator
-     * \extends RAII
      * \brief Configurator class for configuring Application with Configuration.
-     * \warning This class is not thread-safe.
+     *
+     * Configuration returned by getConfiguration() is a draft, which is edited by user. publish() copies draft
+     * into immutable snapshot and atomically replaces previous one, so Readers on other threads never wait.
+     * Replaced snapshots are deleted by publish() or by the last Reader, which could see them, on its destruction.
+     *
+     * On construction draft is filled from settings file and then from VULKALC_* environment variables, so
+     * settings can be tuned per machine without rebuilds. File has lines `key = value`, lines starting with
+     * `#` or `;` and `[section]` headers are skipped. Environment variable of key is VULKALC_ followed by key in
+     * upper case, e.g. VULKALC_COMPUTE_QUEUE_COUNT. Keys are:
+     * - application_name, shaders_directory, shader_cache_directory, trace_file, tuning_file, vulkan_info_file:
+     * strings, empty value means nullptr
+     * - enabled_layers, enabled_extensions: comma-separated names
+     * - device: unsigned integer or auto for automatic selection
+     * - compute_queue_count, descriptor_sets_per_pool: unsigned integers
+     * - profiling, metrics, logging, error_logging, push_descriptors, device_benchmark: true/false, on/off,
+     * yes/no or 1/0
+     * - min_log_level: info, warn, error or 0 to 2
+     * - profile: custom, debug, release or profiling
+     * \warning Draft is not thread-safe, edit it and call publish() from one thread at a time.
      */
     class VULKALC_API Configurator
     {
     public:
+        /*!
+         * \brief Name of settings file, which is loaded, if VULKALC_CONFIG_FILE is not set
+         */
+        static const char* const DEFAULT_SETTINGS_FILE;
+
+        /*!
+         * \class Reader
+         * \brief Keeps current snapshot of Configuration alive while it's read
+         *
+         * Reader costs two atomic operations on shared counter and blocks only to delete replaced snapshots,
+         * if it's the last one. Keep it only for the duration of read.
+         */
+        class VULKALC_API Reader
+        {
+        public:
+            /*!
+             * \brief Acquires current snapshot
+             * \param configurator Configurator to read snapshot of
+             */
+            explicit Reader(const Configurator& configurator);
+
+            /*!
+             * \brief Releases snapshot and deletes replaced snapshots, if there are no other Readers
+             */
+            ~Reader();
+
+            /*!
+             * \brief Returns acquired snapshot
+             * \return snapshot or nullptr, if nothing is published yet
+             */
+            const Configuration* get() const { return m_pSnapshot; }
+
+            /*!
+             * \brief Gives access to fields of acquired snapshot
+             * \return snapshot
+             */
+            const Configuration* operator->() const { return m_pSnapshot; }
+
+        private:
+            Reader(const Reader&);
+
+            void operator=(const Reader&);
+
+            const Configurator& m_configurator;
+            const Configuration* m_pSnapshot;
+        };
+
+        /*!
+         * \brief Returns draft Configuration, which is edited before configure() or reconfigure()
+         * \return pointer to draft
+         */
         Configuration* const getConfiguration() { return m_spConfiguration; };
 
         /*!
-         * \brief Configurator constructor
+         * \brief Copies draft into new snapshot and makes it current
+         * \return published snapshot, which caller may read without Reader until next publish()
+         * \throws HostMemoryAllocationException - thrown if failed to allocate memory in heap for snapshot
+         */
+        const Configuration* publish();
+
+        /*!
+         * \brief Sets draft setting by key
+         * \param key key of setting, as in settings file
+         * \param value value of setting, it is copied
+         * \return false, if key is unknown or value is invalid, in which case draft isn't changed
+         */
+        bool set(const char* key, const char* value);
+
+        /*!
+         * \brief Sets draft settings from file
+         *
+         * Invalid lines are skipped and reported by getLoadErrors().
+         * \param path path to settings file
+         * \return false, if file can't be opened
+         */
+        bool load(const char* path);
+
+        /*!
+         * \brief Sets draft settings from VULKALC_* environment variables
+         *
+         * Invalid values are skipped and reported by getLoadErrors().
+         */
+        void loadEnvironment();
+
+        /*!
+         * \brief Returns descriptions of settings, which were skipped by load() or loadEnvironment()
+         * \note Context logs them as warnings on configure().
+         * \return descriptions of errors
+         */
+        const std::vector<std::string>& getLoadErrors() const { return m_loadErrors; }
+
+        /*!
+         * \brief Configurator constructor. Loads settings file and environment variables
+         *
+         * Settings file is taken from VULKALC_CONFIG_FILE environment variable or is DEFAULT_SETTINGS_FILE
+         * in working directory. Missing file is ignored.
          * \throws HostHostMemoryAllocationException - thrown if failed to allocate memory in heap for Configuration
          */
         Configurator();
@@ -62,7 +177,22 @@ namespace Vulkalc
         ~Configurator();
 
     private:
+        Configurator(const Configurator&);
+
+        void operator=(const Configurator&);
+
+        void deleteRetiredSnapshots() const;
+
         Configuration* m_spConfiguration;
+        //strings pointed to by loaded settings of draft and snapshots, list never moves them
+        std::list<std::string> m_strings;
+        std::vector<std::string> m_loadErrors;
+        std::atomic<const Configuration*> m_pSnapshot;
+        mutable std::atomic<uint32_t> m_readerCount;
+        //Readers delete retired snapshots too, so they are guarded by mutex and flagged for lock-free check
+        mutable std::mutex m_publishMutex;
+        mutable std::vector<const Configuration*> m_retiredSnapshots;
+        mutable std::atomic<bool> m_hasRetiredSnapshots;
     };
 }
 
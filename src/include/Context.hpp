@@ -0,0 +1,227 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Context.hpp
+ * \brief Contains Context class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains Context class, which owns Configuration, VkInstance and Runner of one tenant of Vulkalc
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_CONTEXT_H
+#define VULKALC_LIBRARY_CONTEXT_H
+
+#include "RAII.hpp"
+#include "Export.hpp"
+#include "Configurator.hpp"
+#include "Exceptions.h"
+#include "Runner.hpp"
+#include "Logger.hpp"
+#include "Metrics.hpp"
+#include "VulkanInfo.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <atomic>
+#include <mutex>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Context
+     * \extends RAII
+     * \brief Isolated set of Vulkalc state: Configuration, VkInstance, Runner with its device, queues and caches,
+     * Logger and Metrics
+     *
+     * Any number of Contexts may exist in one process. Contexts share nothing but the VulkanInfo cache, so
+     * they can be configured and used from different threads without synchronization between them.
+     * Application is a Context, which is available globally.
+     *
+     * \note Configure Context from one thread, then log() and getRunner() may be called from any thread.
+     * Runner of Context is not thread-safe itself.
+     */
+    class VULKALC_API Context : private RAII
+    {
+    public:
+        /*!
+         * \brief Enumeration for logging levels
+         */
+        enum LOG_LEVEL { LOG_INFO, LOG_WARN, LOG_ERROR };
+
+        /*!
+         * \brief Constructs initialized, but not configured Context
+         * \throws HostMemoryAllocationException - thrown if failed to allocate Configurator
+         */
+        Context();
+
+        /*!
+         * \brief Destroys Runner and VkInstance of Context
+         */
+        virtual ~Context();
+
+        /*!
+         * \brief Checks if Context is initialized
+         * \return is initialized flag
+         */
+        bool isInitialized() const { return m_isInitialized; }
+
+        /*!
+         * \brief Checks if Context is configured
+         * \return is configured flag
+         */
+        bool isConfigured() const { return m_isConfigured; }
+
+        /*!
+         * \brief Creates VkInstance, Runner, Logger and Metrics with Configuration, fetched from Configurator
+         *
+         * If configuration fails, everything created is released, so configure() may be called again.
+         * \throws ApplicationNotInitializedException - thrown if Context is not initialized
+         * \throws HostMemoryAllocationException - thrown if failed to allocate memory in heap
+         * \throws VulkanException - thrown if failed to create VkInstance or device
+         * \throws InvalidArgumentException - thrown if configured device doesn't exist or tuning file is malformed
+         */
+        void configure() throw(ApplicationNotInitializedException, HostMemoryAllocationException, VulkanException,
+                               InvalidArgumentException);
+
+        /*!
+         * \brief Publishes edited Configuration and applies settings, which can change at runtime
+         *
+         * Logging settings and profiling flag of Runner are applied, other settings are used only by configure().
+         * Threads, which log meanwhile, aren't blocked, they see either previous or new snapshot of Configuration.
+         * \throws ApplicationNotInitializedException - thrown if Context is not initialized
+         * \throws ApplicationNotConfiguredException - thrown if Context is not configured
+         * \throws HostMemoryAllocationException - thrown if failed to allocate memory in heap
+         */
+        void reconfigure();
+
+        /*!
+         * \brief Selects instance layers and extensions of Configuration::profile
+         *
+         * Availability is checked with VulkanInfo, so after the first call selection doesn't query the loader.
+         * If VkInstance can't be created with layers or extensions selected from snapshot, which was loaded from
+         * Configuration::vulkanInfoFile, configure() selects them again with fresh VulkanInfo.
+         * \param configuration Configuration with profile and requested layers and extensions
+         * \param layers filled with names of layers to enable
+         * \param extensions filled with names of instance extensions to enable
+         */
+        static void selectInstanceProfile(const Configuration& configuration, std::vector<const char*>& layers,
+                                          std::vector<const char*>& extensions);
+
+        /*!
+         * \brief Selects instance layers and extensions of Configuration::profile, which are available in vulkanInfo
+         * \param configuration Configuration with profile and requested layers and extensions
+         * \param vulkanInfo VulkanInfo to check availability with
+         * \param layers filled with names of layers to enable
+         * \param extensions filled with names of instance extensions to enable
+         */
+        static void selectInstanceProfile(const Configuration& configuration, VulkanInfo& vulkanInfo,
+                                          std::vector<const char*>& layers, std::vector<const char*>& extensions);
+
+        /*!
+         * \brief Returns time, which vkCreateInstance took with layers and extensions of selected profile
+         * \note It's also exported to Metrics as vulkalc_instance_creation_microseconds gauge.
+         * \return time in milliseconds, 0 if Context is not configured
+         */
+        double getInstanceCreationTime() const { return m_instanceCreationTime; }
+
+        /*!
+         * \brief Writes message to logging stream, which depends on logging level
+         *
+         * Message is copied to Logger queue and written to stream on background thread, so it returns immediately.
+         * Messages with level below VULKALC_MIN_LOG_LEVEL or Configuration::minLogLevel are skipped.
+         * \param message message to write
+         * \param level logging level
+         * \throws ApplicationNotInitializedException - thrown if Context is not initialized
+         * \throws ApplicationNotConfiguredException - thrown if Context is not configured
+         */
+        void log(const char* message, LOG_LEVEL level);
+
+        /*!
+         * \brief Returns Logger, which writes to configured streams
+         * \return pointer to Logger or nullptr, if Context is not configured or logging is disabled
+         */
+        Logger* getLogger() const { return m_pLogger; }
+
+        /*!
+         * \brief Returns Metrics of Runner of this Context
+         * \return pointer to Metrics or nullptr, if Context is not configured or metrics are disabled
+         */
+        Metrics* getMetrics() const { return m_pMetrics; }
+
+        /*!
+         * \brief Returns Configurator, which should be used to change Configuration before configure()
+         * \return constant pointer to Configurator
+         */
+        Configurator* const getConfigurator() { return m_pConfigurator; }
+
+        /*!
+         * \brief Returns Runner, which owns Vulkan device of this Context and executes Tasks on it
+         * \return constant pointer to Runner
+         * \throws ApplicationNotInitializedException - thrown if Context is not initialized
+         * \throws ApplicationNotConfiguredException - thrown if Context is not configured
+         */
+        Runner* const getRunner();
+
+    private:
+        Context(const Context&);
+
+        void operator=(const Context&);
+
+        virtual void init() override;
+        virtual void release() override;
+
+        void releaseConfiguration();
+
+        void prepareVulkanApplicationInfo(const Configuration* configuration);
+
+        void prepareVulkanInstanceInfo(const Configuration* configuration);
+
+        void createVulkanInstance();
+
+        //guards configure(), reconfigure() and release(), readers check m_isConfigured only
+        std::mutex m_mutex;
+        std::atomic<bool> m_isInitialized;
+        std::atomic<bool> m_isConfigured;
+        Configurator* m_pConfigurator;
+        std::iostream* m_pLogStream;
+        std::iostream* m_pErrorStream;
+        VkApplicationInfo* m_pVkApplicationInfo;
+        VkInstanceCreateInfo* m_pVkInstanceCreateInfo;
+        //copy of published Configuration with layers and extensions of profile, Runner reads it
+        Configuration* m_pInstanceConfiguration;
+        VkInstance m_vkInstance;
+        double m_instanceCreationTime;
+        Runner* m_pRunner;
+        Logger* m_pLogger;
+        Metrics* m_pMetrics;
+    };
+}
+
+#endif //VULKALC_LIBRARY_CONTEXT_H
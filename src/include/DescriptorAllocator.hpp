@@ -0,0 +1,139 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file DescriptorAllocator.hpp
+ * \brief Contains DescriptorAllocator class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_DESCRIPTORALLOCATOR_H
+#define VULKALC_LIBRARY_DESCRIPTORALLOCATOR_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <map>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class DescriptorAllocator
+     * \brief Allocates descriptor sets of storage buffers from pools, which are reused after reset
+     *
+     * Every layout, which is identified by number of bindings, has its own pools, sized exactly for it, so pools
+     * never get fragmented. Pools are created on demand and kept until destruction, reset() returns all sets
+     * at once, after commands using them have completed.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API DescriptorAllocator
+    {
+    public:
+        /*!
+         * \brief Default number of descriptor sets in one pool
+         */
+        static const uint32_t SETS_PER_POOL = 64;
+
+        /*!
+         * \brief Counters of allocations
+         */
+        struct Statistics
+        {
+            /*!
+             * \brief Number of allocated descriptor sets
+             */
+            uint64_t allocationCount;
+            /*!
+             * \brief Number of created descriptor pools
+             */
+            uint64_t poolCount;
+            /*!
+             * \brief Number of reset() calls
+             */
+            uint64_t resetCount;
+        };
+
+        /*!
+         * \brief DescriptorAllocator constructor
+         * \param device device to create descriptor pools on
+         * \param setsPerPool number of descriptor sets in one pool
+         * \throws InvalidArgumentException - thrown if setsPerPool is 0
+         */
+        explicit DescriptorAllocator(VkDevice device, uint32_t setsPerPool = SETS_PER_POOL);
+
+        /*!
+         * \brief DescriptorAllocator destructor. Destroys all pools with their descriptor sets
+         */
+        ~DescriptorAllocator();
+
+        /*!
+         * \brief Allocates descriptor set
+         * \param layout layout of descriptor set
+         * \param bindingCount number of storage buffer bindings in layout
+         * \return allocated descriptor set
+         * \throws VulkanException - thrown if failed to create pool or allocate descriptor set
+         */
+        VkDescriptorSet allocate(VkDescriptorSetLayout layout, uint32_t bindingCount);
+
+        /*!
+         * \brief Returns all allocated descriptor sets to their pools
+         * \warning Descriptor sets must not be used by pending commands.
+         * \throws VulkanException - thrown if failed to reset pool
+         */
+        void reset();
+
+        /*!
+         * \brief Returns counters of allocations
+         * \return Statistics
+         */
+        const Statistics& getStatistics() const { return m_statistics; }
+
+    private:
+        DescriptorAllocator(const DescriptorAllocator&);
+
+        void operator=(const DescriptorAllocator&);
+
+        struct Pools
+        {
+            std::vector<VkDescriptorPool> pools;
+            size_t currentPool;
+            uint32_t allocatedSetCount;
+        };
+
+        VkDevice m_vkDevice;
+        uint32_t m_setsPerPool;
+        std::map<uint32_t, Pools> m_pools;
+        Statistics m_statistics;
+    };
+}
+
+#endif //VULKALC_LIBRARY_DESCRIPTORALLOCATOR_H
@@ -0,0 +1,106 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file DeviceSelector.hpp
+ * \brief Contains DeviceSelector class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_DEVICESELECTOR_H
+#define VULKALC_LIBRARY_DEVICESELECTOR_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "TuningDatabase.hpp"
+#include "VulkanInfo.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class DeviceSelector
+     * \brief Selects the fastest physical device for compute
+     *
+     * Devices are ordered by score, which is computed from properties cached in VulkanInfo: device type first,
+     * then size of device local memory and compute limits. Optionally devices are ordered by bandwidth of
+     * device local copy, measured by short benchmark, first. Measured bandwidth is cached in TuningDatabase under
+     * key of device as parameter copyBandwidth of kernel device, so every device is measured only once per driver.
+     *
+     * Selection without benchmark only reads VulkanInfo, so it is much cheaper than creation of VkInstance.
+     */
+    class VULKALC_API DeviceSelector
+    {
+    public:
+        /*!
+         * \brief Kernel name in TuningDatabase, which parameters describe device itself
+         */
+        static const char* const DEVICE_KERNEL;
+        /*!
+         * \brief Parameter of DEVICE_KERNEL with bandwidth of device local copy in MiB/s
+         */
+        static const char* const COPY_BANDWIDTH_PARAMETER;
+
+        /*!
+         * \brief Returns score of physical device, device with greater score is expected to be faster
+         * \param info information about physical device
+         * \return score of device, 0 if device doesn't support compute
+         */
+        static uint64_t getScore(const VulkanInfo::PhysicalDeviceInfo& info);
+
+        /*!
+         * \brief Measures bandwidth of copy between two device local buffers
+         *
+         * Benchmark creates its own VkDevice and takes a few milliseconds on discrete devices.
+         * \param physicalDevice physical device to measure
+         * \return bandwidth in MiB/s, 0 if device couldn't be measured
+         */
+        static uint32_t measureCopyBandwidth(VkPhysicalDevice physicalDevice);
+
+        /*!
+         * \brief Selects physical device with the greatest score
+         * \param instance VkInstance to enumerate physical devices of
+         * \param tuningFile path to TuningDatabase with cached bandwidth of devices, can be nullptr
+         * \param isBenchmarkEnabled true to measure bandwidth of devices, which are not in tuningFile yet,
+         * and save it there
+         * \return selected physical device
+         * \throws InvalidArgumentException - thrown if there is no device with compute support
+         * \throws VulkanException - thrown if failed to enumerate physical devices
+         */
+        static VkPhysicalDevice select(VkInstance instance, const char* tuningFile, bool isBenchmarkEnabled);
+
+    private:
+        DeviceSelector();
+    };
+}
+
+#endif //VULKALC_LIBRARY_DEVICESELECTOR_H
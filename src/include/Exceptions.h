@@ -35,23 +35,83 @@
 #define VULKALC_LIBRARY_EXCEPTIONS_H
 
 #include "Export.hpp"
-#include <string>
+#include <cstddef>
+#include <vulkan/vulkan.h>
 
 namespace Vulkalc
 {
+    /*!
+     * \brief Enumeration for kinds of errors, every kind corresponds to exception class
+     */
+    enum ErrorCode
+    {
+        ERROR_NONE,
+        ERROR_UNKNOWN,
+        ERROR_APPLICATION_NOT_INITIALIZED,
+        ERROR_APPLICATION_NOT_CONFIGURED,
+        ERROR_HOST_MEMORY_ALLOCATION,
+        ERROR_VULKAN,
+        ERROR_INVALID_ARGUMENT,
+        ERROR_SHADER_LOADING,
+        ERROR_SHADER_COMPILATION,
+        ERROR_SHADER_VERIFICATION
+    };
+
+    /*!
+     * \brief Error returned by functions, which don't throw exceptions
+     * \see Expected
+     */
+    struct VULKALC_API Error
+    {
+        /*!
+         * \brief Kind of error, ERROR_NONE for success
+         */
+        ErrorCode code;
+        /*!
+         * \brief VkResult of failed Vulkan call, VK_SUCCESS if error is not caused by Vulkan
+         */
+        VkResult result;
+        /*!
+         * \brief Static error message, nullptr for success
+         */
+        const char* message;
+
+        /*!
+         * \brief Constructs success
+         */
+        Error() : code(ERROR_NONE), result(VK_SUCCESS), message(nullptr) {}
+
+        /*!
+         * \brief Constructs error
+         * \param code kind of error
+         * \param message static error message, it is not copied
+         * \param result VkResult of failed Vulkan call
+         */
+        Error(ErrorCode code, const char* message, VkResult result = VK_SUCCESS) : code(code), result(result),
+                                                                                  message(message) {}
+    };
+
     class VULKALC_API Exception
     {
     public:
+        /*!
+         * \brief Maximum length of exception message including terminating zero, longer messages are truncated
+         */
+        static const size_t MAX_MESSAGE_LENGTH = 512;
+
         /*!
          * \brief Exception constructor
          */
-        Exception() {};
+        Exception();
 
         /*!
          * \brief Exception constructor with exception message
+         *
+         * Message is copied into exception object, so nothing is allocated on failure path.
          * \param message message of exception
+         * \param code kind of error
          */
-        explicit Exception(const char* message);
+        explicit Exception(const char* message, ErrorCode code = ERROR_UNKNOWN);
 
         ~Exception() {};
 
@@ -61,9 +121,15 @@ namespace Vulkalc
         */
         virtual const char* what() const;
 
+        /*!
+         * \brief Returns kind of error
+         * \return ErrorCode
+         */
+        ErrorCode getErrorCode() const { return m_errorCode; }
+
     protected:
-        const char* m_message;
-        std::string m_exception_message = "Exception in Vulkalc Application";
+        ErrorCode m_errorCode;
+        char m_exceptionMessage[MAX_MESSAGE_LENGTH];
     };
 
     /*!
@@ -79,10 +145,8 @@ namespace Vulkalc
          * \brief ApplicationNotInitializedException constructor
          */
         ApplicationNotInitializedException() : Exception("An instance of Application is not initialized. "
-                                                                 "Call Application::init() first") {};
-
-    private:
-        std::string m_exception_message = "ApplicationNotInitializedException in Vulkalc Application";
+                                                                 "Call Application::init() first",
+                                                         ERROR_APPLICATION_NOT_INITIALIZED) {};
     };
 
     /*!
@@ -100,9 +164,8 @@ namespace Vulkalc
          */
         ApplicationNotConfiguredException() : Exception("An instance of Application is not configured. "
                                                                 "Edit Configuration instance, then call "
-                                                                "Application::configure()") {};
-    private:
-        std::string m_exception_message = "ApplicationNotConfiguredException in Vulkalc Application";
+                                                                "Application::configure()",
+                                                        ERROR_APPLICATION_NOT_CONFIGURED) {};
     };
 
     /*!
@@ -115,17 +178,111 @@ namespace Vulkalc
         /*!
          * \brief HostMemoryAllocationException constructor
          */
-        HostMemoryAllocationException() {};
+        HostMemoryAllocationException() : Exception("Failed to allocate memory in host application",
+                                                    ERROR_HOST_MEMORY_ALLOCATION) {};
 
         /*!
          * \brief HostMemoryAllocationException constructor with message parameter
          * \param message exception message
          */
-        explicit HostMemoryAllocationException(const char* message) : Exception(message) {};
+        explicit HostMemoryAllocationException(const char* message) : Exception(message,
+                                                                                ERROR_HOST_MEMORY_ALLOCATION) {};
+    };
+
+    /*!
+     * \brief This exception is thrown, when Vulkan call returns an error
+     * \extends Exception
+     *
+     * Keeps VkResult returned by failed Vulkan call.
+     */
+    class VULKALC_API VulkanException : public Exception
+    {
+    public:
+        /*!
+         * \brief VulkanException constructor
+         * \param result VkResult returned by failed Vulkan call
+         * \param message exception message
+         */
+        VulkanException(VkResult result, const char* message) : Exception(message, ERROR_VULKAN),
+                                                                 m_result(result) {};
+
+        /*!
+         * \brief Returns VkResult of failed Vulkan call
+         * \return VkResult
+         */
+        VkResult getResult() const { return m_result; }
 
     private:
-        std::string m_exception_message = "Failed to allocate memory in host application";
+        VkResult m_result;
+    };
+
+    /*!
+     * \brief This exception is thrown, when invalid argument is passed to Vulkalc function
+     * \extends Exception
+     */
+    class VULKALC_API InvalidArgumentException : public Exception
+    {
+    public:
+        /*!
+         * \brief InvalidArgumentException constructor with message parameter
+         * \param message exception message
+         */
+        explicit InvalidArgumentException(const char* message) : Exception(message, ERROR_INVALID_ARGUMENT) {};
     };
+
+    /*!
+     * \brief This exception is thrown, when failed to load shader
+     * \extends Exception
+     */
+    class VULKALC_API ShaderLoadingException : public Exception
+    {
+    public:
+        /*!
+         * \brief ShaderLoadingException constructor with message parameter
+         * \param message exception message
+         */
+        explicit ShaderLoadingException(const char* message) : Exception(message, ERROR_SHADER_LOADING) {};
+
+    protected:
+        ShaderLoadingException(const char* message, ErrorCode code) : Exception(message, code) {};
+    };
+
+    /*!
+     * \brief This exception is thrown, when failed to compile shader from source
+     * \extends ShaderLoadingException
+     */
+    class VULKALC_API ShaderCompilationException : public ShaderLoadingException
+    {
+    public:
+        /*!
+         * \brief ShaderCompilationException constructor with message parameter
+         * \param message exception message, contains compiler log
+         */
+        explicit ShaderCompilationException(const char* message) : ShaderLoadingException(message,
+                                                                                            ERROR_SHADER_COMPILATION) {};
+    };
+
+    /*!
+     * \brief This exception is thrown, when shader exceeds limits or features of device
+     * \extends ShaderLoadingException
+     * \see Verifier
+     */
+    class VULKALC_API ShaderVerificationException : public ShaderLoadingException
+    {
+    public:
+        /*!
+         * \brief ShaderVerificationException constructor with message parameter
+         * \param message exception message, contains diagnostics of Verifier
+         */
+        explicit ShaderVerificationException(const char* message) :
+                ShaderLoadingException(message, ERROR_SHADER_VERIFICATION) {};
+    };
+
+    /*!
+     * \brief Throws exception, which corresponds to error
+     * \param error error to throw, its code must not be ERROR_NONE
+     */
+    [[noreturn]] VULKALC_API void throwError(const Error& error);
 }
 
 #endif //VULKALC_LIBRARY_EXCEPTIONS_H
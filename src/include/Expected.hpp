@@ -0,0 +1,158 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Expected.hpp
+ * \brief Contains Expected class template declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_EXPECTED_H
+#define VULKALC_LIBRARY_EXPECTED_H
+
+#include "Exceptions.h"
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Expected
+     * \brief Either value or Error, returned by hot functions instead of throwing exceptions
+     *
+     * Nothing is allocated on failure path, error message is static and VkResult of failed Vulkan call is kept.
+     * valueOrThrow() turns Error into exception, so throwing functions are thin wrappers over non-throwing ones.
+     * \tparam T type of value, must be default constructible
+     */
+    template<typename T>
+    class Expected
+    {
+    public:
+        /*!
+         * \brief Constructs Expected with value
+         * \param value value
+         */
+        Expected(const T& value) : m_value(value) {}
+
+        /*!
+         * \brief Constructs Expected with error
+         * \param error error, its code must not be ERROR_NONE
+         */
+        Expected(const Error& error) : m_value(), m_error(error) {}
+
+        /*!
+         * \brief Checks whether Expected contains value
+         * \return true, if there is no error
+         */
+        bool hasValue() const { return m_error.code == ERROR_NONE; }
+
+        /*!
+         * \copydoc hasValue()
+         */
+        explicit operator bool() const { return hasValue(); }
+
+        /*!
+         * \brief Returns value without checking for error
+         * \return value or default constructed T, if there is error
+         */
+        const T& getValue() const { return m_value; }
+
+        /*!
+         * \brief Returns error
+         * \return error, its code is ERROR_NONE if there is value
+         */
+        const Error& getError() const { return m_error; }
+
+        /*!
+         * \brief Returns value or throws exception, which corresponds to error
+         * \return value
+         * \throws Exception - subclass of Exception, which corresponds to error code
+         */
+        const T& valueOrThrow() const
+        {
+            if (!hasValue())
+                throwError(m_error);
+            return m_value;
+        }
+
+    private:
+        T m_value;
+        Error m_error;
+    };
+
+    /*!
+     * \brief Either success or Error
+     */
+    template<>
+    class Expected<void>
+    {
+    public:
+        /*!
+         * \brief Constructs success
+         */
+        Expected() {}
+
+        /*!
+         * \brief Constructs Expected with error
+         * \param error error
+         */
+        Expected(const Error& error) : m_error(error) {}
+
+        /*!
+         * \brief Checks whether call succeeded
+         * \return true, if there is no error
+         */
+        bool hasValue() const { return m_error.code == ERROR_NONE; }
+
+        /*!
+         * \copydoc hasValue()
+         */
+        explicit operator bool() const { return hasValue(); }
+
+        /*!
+         * \brief Returns error
+         * \return error, its code is ERROR_NONE on success
+         */
+        const Error& getError() const { return m_error; }
+
+        /*!
+         * \brief Throws exception, which corresponds to error, if there is one
+         * \throws Exception - subclass of Exception, which corresponds to error code
+         */
+        void valueOrThrow() const
+        {
+            if (!hasValue())
+                throwError(m_error);
+        }
+
+    private:
+        Error m_error;
+    };
+}
+
+#endif //VULKALC_LIBRARY_EXPECTED_H
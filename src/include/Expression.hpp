@@ -0,0 +1,435 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Expression.hpp
+ * \brief Contains expression templates for fused element-wise operations on buffers
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains expression templates, which let to write element-wise arithmetic over buffers like
+ * \code c = a * b + d * e - f; \endcode
+ * Such expression doesn't create temporary buffers. It's compiled to small program, which is evaluated by single
+ * kernel in one pass over memory.
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_EXPRESSION_H
+#define VULKALC_LIBRARY_EXPRESSION_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Buffer.hpp"
+#include "Runner.hpp"
+#include "Task.hpp"
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class ExpressionProgram
+     * \brief Stack program, which evaluates expression for one element
+     *
+     * Program is passed to fused kernel as specialization constants, so driver compiles separate pipeline for every
+     * shape of expression and Runner caches it. Values of scalar constants are passed as push constants, so changing
+     * them doesn't require new pipeline.
+     */
+    class VULKALC_API ExpressionProgram
+    {
+    public:
+        /*!
+         * \brief Maximum number of distinct buffers in expression
+         */
+        static const uint32_t MAX_OPERANDS = 8;
+        /*!
+         * \brief Maximum number of scalar constants in expression
+         */
+        static const uint32_t MAX_CONSTANTS = 16;
+        /*!
+         * \brief Maximum number of instructions in program
+         */
+        static const uint32_t MAX_INSTRUCTIONS = 32;
+        /*!
+         * \brief Maximum depth of evaluation stack
+         */
+        static const uint32_t MAX_STACK_DEPTH = 8;
+
+        /*!
+         * \brief Enumeration for program operations. Must match fused.comp
+         */
+        enum OPCODE
+        {
+            OPCODE_LOAD, OPCODE_CONSTANT, OPCODE_NEGATE, OPCODE_ADD, OPCODE_SUBTRACT, OPCODE_MULTIPLY, OPCODE_DIVIDE
+        };
+
+        /*!
+         * \brief ExpressionProgram constructor
+         */
+        ExpressionProgram() : m_stackDepth(0), m_minOperandCount(static_cast<size_t>(-1)) {};
+
+        /*!
+         * \brief Appends loading of buffer element. The same buffer is bound only once
+         * \param buffer buffer to load from
+         * \param count number of elements in buffer
+         * \throws InvalidArgumentException - thrown if program exceeds limits
+         */
+        void pushOperand(const BufferBase* buffer, size_t count);
+
+        /*!
+         * \brief Appends scalar constant
+         * \param bits 4 bytes of constant value
+         * \throws InvalidArgumentException - thrown if program exceeds limits
+         */
+        void pushConstant(uint32_t bits);
+
+        /*!
+         * \brief Appends operation on top values of stack
+         * \param opcode operation
+         * \throws InvalidArgumentException - thrown if program exceeds limits
+         */
+        void pushOperation(OPCODE opcode);
+
+        /*!
+         * \brief Creates Task, which evaluates program for every element of output
+         * \param shaderName name of built-in fused shader for type of elements
+         * \param output buffer to write results to
+         * \param count number of elements to evaluate
+         * \return dispatch Task
+         * \throws InvalidArgumentException - thrown if program is incomplete or operands are smaller than output
+         */
+        Task createTask(const char* shaderName, const BufferBase& output, size_t count) const;
+
+        /*!
+         * \brief Returns instructions of program
+         * \return vector of instructions, opcode in high 4 bits and argument in low 4 bits
+         */
+        const std::vector<uint8_t>& getInstructions() const { return m_instructions; }
+
+        /*!
+         * \brief Returns buffers used by program in order of their bindings
+         * \return vector of buffers
+         */
+        const std::vector<const BufferBase*>& getOperands() const { return m_operands; }
+
+        /*!
+         * \brief Returns values of scalar constants
+         * \return vector of constants
+         */
+        const std::vector<uint32_t>& getConstants() const { return m_constants; }
+
+    private:
+        void pushInstruction(OPCODE opcode, uint32_t argument, int stackChange);
+
+        std::vector<uint8_t> m_instructions;
+        std::vector<const BufferBase*> m_operands;
+        std::vector<uint32_t> m_constants;
+        uint32_t m_stackDepth;
+        size_t m_minOperandCount;
+    };
+
+    /*!
+     * \brief Maps type of elements to name of built-in fused shader
+     */
+    template<typename T>
+    struct ExpressionShader;
+
+    template<>
+    struct ExpressionShader<float>
+    {
+        static const char* getName() { return "fused_float"; }
+    };
+
+    template<>
+    struct ExpressionShader<int32_t>
+    {
+        static const char* getName() { return "fused_int"; }
+    };
+
+    template<>
+    struct ExpressionShader<uint32_t>
+    {
+        static const char* getName() { return "fused_uint"; }
+    };
+
+    /*!
+     * \brief Base of all expression nodes
+     * \tparam T type of elements
+     */
+    template<typename T>
+    struct ExpressionNode
+    {
+        /*!
+         * \brief Marks expression nodes for Buffer::operator=
+         */
+        static const bool IS_EXPRESSION = true;
+        /*!
+         * \brief Type of elements
+         */
+        typedef T ValueType;
+    };
+
+    /*!
+     * \brief Expression node, which loads elements of buffer
+     */
+    template<typename T>
+    class BufferExpression : public ExpressionNode<T>
+    {
+    public:
+        explicit BufferExpression(const Buffer<T>& buffer) : m_buffer(buffer) {};
+
+        void compile(ExpressionProgram& program) const { program.pushOperand(&m_buffer, m_buffer.getCount()); }
+
+    private:
+        const Buffer<T>& m_buffer;
+    };
+
+    /*!
+     * \brief Expression node with scalar constant
+     */
+    template<typename T>
+    class ConstantExpression : public ExpressionNode<T>
+    {
+    public:
+        explicit ConstantExpression(T value) : m_value(value) {};
+
+        void compile(ExpressionProgram& program) const
+        {
+            uint32_t bits;
+            memcpy(&bits, &m_value, sizeof(bits));
+            program.pushConstant(bits);
+        }
+
+    private:
+        T m_value;
+    };
+
+    /*!
+     * \brief Expression node, which negates its operand
+     */
+    template<typename T, typename E>
+    class NegateExpression : public ExpressionNode<T>
+    {
+    public:
+        explicit NegateExpression(const E& operand) : m_operand(operand) {};
+
+        void compile(ExpressionProgram& program) const
+        {
+            m_operand.compile(program);
+            program.pushOperation(ExpressionProgram::OPCODE_NEGATE);
+        }
+
+    private:
+        E m_operand;
+    };
+
+    /*!
+     * \brief Expression node with binary arithmetic operation
+     */
+    template<typename T, ExpressionProgram::OPCODE OPCODE, typename L, typename R>
+    class BinaryExpression : public ExpressionNode<T>
+    {
+    public:
+        BinaryExpression(const L& left, const R& right) : m_left(left), m_right(right) {};
+
+        void compile(ExpressionProgram& program) const
+        {
+            m_left.compile(program);
+            m_right.compile(program);
+            program.pushOperation(OPCODE);
+        }
+
+    private:
+        L m_left;
+        R m_right;
+    };
+
+    /*!
+     * \brief Describes what can be an operand of expression: buffers and expression nodes
+     */
+    template<typename X, typename = void>
+    struct ExpressionOperand
+    {
+        static const bool IS_OPERAND = false;
+    };
+
+    template<typename T>
+    struct ExpressionOperand<Buffer<T>, void>
+    {
+        static const bool IS_OPERAND = true;
+        typedef T ValueType;
+        typedef BufferExpression<T> NodeType;
+
+        static NodeType toNode(const Buffer<T>& buffer) { return NodeType(buffer); }
+    };
+
+    template<typename X>
+    struct ExpressionOperand<X, typename std::enable_if<X::IS_EXPRESSION>::type>
+    {
+        static const bool IS_OPERAND = true;
+        typedef typename X::ValueType ValueType;
+        typedef X NodeType;
+
+        static const NodeType& toNode(const X& node) { return node; }
+    };
+
+    /*!
+     * \brief Resolves type of binary expression node, if both operands are valid and have the same type of elements
+     */
+    template<ExpressionProgram::OPCODE OPCODE, typename L, typename R, typename = void>
+    struct BinaryExpressionOf
+    {
+    };
+
+    template<ExpressionProgram::OPCODE OPCODE, typename L, typename R>
+    struct BinaryExpressionOf<OPCODE, L, R, typename std::enable_if<
+            ExpressionOperand<L>::IS_OPERAND && ExpressionOperand<R>::IS_OPERAND &&
+            std::is_same<typename ExpressionOperand<L>::ValueType,
+                    typename ExpressionOperand<R>::ValueType>::value>::type>
+    {
+        typedef BinaryExpression<typename ExpressionOperand<L>::ValueType, OPCODE,
+                typename ExpressionOperand<L>::NodeType, typename ExpressionOperand<R>::NodeType> Type;
+    };
+
+    /*!
+     * \brief Resolves type of binary expression node, where one of operands is scalar
+     */
+    template<ExpressionProgram::OPCODE OPCODE, typename X, bool IS_LEFT, typename = void>
+    struct ScalarExpressionOf
+    {
+    };
+
+    template<ExpressionProgram::OPCODE OPCODE, typename X>
+    struct ScalarExpressionOf<OPCODE, X, true, typename std::enable_if<ExpressionOperand<X>::IS_OPERAND>::type>
+    {
+        typedef typename ExpressionOperand<X>::ValueType ValueType;
+        typedef BinaryExpression<ValueType, OPCODE, typename ExpressionOperand<X>::NodeType,
+                ConstantExpression<ValueType>> Type;
+    };
+
+    template<ExpressionProgram::OPCODE OPCODE, typename X>
+    struct ScalarExpressionOf<OPCODE, X, false, typename std::enable_if<ExpressionOperand<X>::IS_OPERAND>::type>
+    {
+        typedef typename ExpressionOperand<X>::ValueType ValueType;
+        typedef BinaryExpression<ValueType, OPCODE, ConstantExpression<ValueType>,
+                typename ExpressionOperand<X>::NodeType> Type;
+    };
+
+#define VULKALC_EXPRESSION_OPERATOR(OPERATOR, OPCODE) \
+    template<typename L, typename R> \
+    typename BinaryExpressionOf<OPCODE, L, R>::Type OPERATOR(const L& left, const R& right) \
+    { \
+        return typename BinaryExpressionOf<OPCODE, L, R>::Type(ExpressionOperand<L>::toNode(left), \
+                                                               ExpressionOperand<R>::toNode(right)); \
+    } \
+    template<typename L> \
+    typename ScalarExpressionOf<OPCODE, L, true>::Type OPERATOR( \
+            const L& left, typename ScalarExpressionOf<OPCODE, L, true>::ValueType right) \
+    { \
+        typedef typename ScalarExpressionOf<OPCODE, L, true>::ValueType ValueType; \
+        return typename ScalarExpressionOf<OPCODE, L, true>::Type(ExpressionOperand<L>::toNode(left), \
+                                                                  ConstantExpression<ValueType>(right)); \
+    } \
+    template<typename R> \
+    typename ScalarExpressionOf<OPCODE, R, false>::Type OPERATOR( \
+            typename ScalarExpressionOf<OPCODE, R, false>::ValueType left, const R& right) \
+    { \
+        typedef typename ScalarExpressionOf<OPCODE, R, false>::ValueType ValueType; \
+        return typename ScalarExpressionOf<OPCODE, R, false>::Type(ConstantExpression<ValueType>(left), \
+                                                                   ExpressionOperand<R>::toNode(right)); \
+    }
+
+    VULKALC_EXPRESSION_OPERATOR(operator+, ExpressionProgram::OPCODE_ADD)
+
+    VULKALC_EXPRESSION_OPERATOR(operator-, ExpressionProgram::OPCODE_SUBTRACT)
+
+    VULKALC_EXPRESSION_OPERATOR(operator*, ExpressionProgram::OPCODE_MULTIPLY)
+
+    VULKALC_EXPRESSION_OPERATOR(operator/, ExpressionProgram::OPCODE_DIVIDE)
+
+#undef VULKALC_EXPRESSION_OPERATOR
+
+    /*!
+     * \brief Negates buffer or expression
+     */
+    template<typename X>
+    NegateExpression<typename ExpressionOperand<X>::ValueType, typename ExpressionOperand<X>::NodeType>
+    operator-(const X& operand)
+    {
+        return NegateExpression<typename ExpressionOperand<X>::ValueType, typename ExpressionOperand<X>::NodeType>(
+                ExpressionOperand<X>::toNode(operand));
+    }
+
+    /*!
+     * \brief Compiles expression to ExpressionProgram
+     * \param expression buffer or expression node
+     * \return compiled program
+     * \throws InvalidArgumentException - thrown if expression exceeds program limits
+     */
+    template<typename E>
+    ExpressionProgram compileExpression(const E& expression)
+    {
+        ExpressionProgram program;
+        ExpressionOperand<E>::toNode(expression).compile(program);
+        return program;
+    }
+
+    /*!
+     * \brief Creates Task, which evaluates expression into output buffer
+     *
+     * Useful to put evaluation into a sequence of Tasks, executed with one submission.
+     * \param output buffer to write results to
+     * \param expression expression to evaluate
+     * \return dispatch Task
+     * \throws InvalidArgumentException - thrown if expression is too complex or its buffers are too small
+     */
+    template<typename T, typename E>
+    Task createExpressionTask(Buffer<T>& output, const E& expression)
+    {
+        static_assert(std::is_same<T, typename ExpressionOperand<E>::ValueType>::value,
+                      "Expression and output buffer must have the same type of elements");
+        return compileExpression(expression).createTask(ExpressionShader<T>::getName(), output, output.getCount());
+    }
+
+    /*!
+     * \brief Evaluates expression into output buffer with single fused kernel and waits for completion
+     * \param output buffer to write results to
+     * \param expression expression to evaluate
+     * \throws InvalidArgumentException - thrown if expression is too complex or its buffers are too small
+     * \throws VulkanException - thrown if failed to execute evaluation
+     */
+    template<typename T, typename E>
+    void evaluate(Buffer<T>& output, const E& expression)
+    {
+        output.getRunner()->execute(createExpressionTask(output, expression));
+    }
+}
+
+#endif //VULKALC_LIBRARY_EXPRESSION_H
@@ -0,0 +1,143 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Histogram.hpp
+ * \brief Contains Histogram class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains Histogram class, which computes histograms of buffers on device
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_HISTOGRAM_H
+#define VULKALC_LIBRARY_HISTOGRAM_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Buffer.hpp"
+#include "Runner.hpp"
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Histogram
+     * \brief Computes histograms of buffers on device
+     *
+     * Values in range [minValue, maxValue) are split into binCount bins of equal width, values out of range
+     * and NaNs are not counted. Every workgroup counts its part of values in its own copy of bins in shared memory,
+     * then adds it to the resulting bins, so contention on global atomics doesn't depend on distribution of values.
+     * If bins don't fit in shared memory, values are counted directly in resulting bins.
+     *
+     * \note Values are converted to float before binning, so integer values bigger than 2^24 lose precision.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API Histogram
+    {
+    public:
+        /*!
+         * \brief Number of bins in byte histogram
+         */
+        static const uint32_t BYTE_BIN_COUNT = 256;
+
+        /*!
+         * \brief Histogram constructor
+         * \param runner Runner to compute histogram with
+         * \param binCount number of bins
+         * \param minValue lower bound of first bin, inclusive
+         * \param maxValue upper bound of last bin, exclusive
+         * \throws InvalidArgumentException - thrown if runner is nullptr, binCount is 0 or range is empty
+         */
+        Histogram(Runner* runner, uint32_t binCount, float minValue, float maxValue);
+
+        /*!
+         * \brief Computes histogram of float values
+         * \param input buffer with values
+         * \param bins buffer to write counts of values in bins to. Previous content is overwritten
+         * \throws InvalidArgumentException - thrown if bins buffer has less than binCount elements
+         * \throws VulkanException - thrown if failed to execute computation
+         */
+        void compute(const Buffer<float>& input, Buffer<uint32_t>& bins);
+
+        /*!
+         * \copydoc compute(const Buffer<float>&, Buffer<uint32_t>&)
+         */
+        void compute(const Buffer<int32_t>& input, Buffer<uint32_t>& bins);
+
+        /*!
+         * \copydoc compute(const Buffer<float>&, Buffer<uint32_t>&)
+         */
+        void compute(const Buffer<uint32_t>& input, Buffer<uint32_t>& bins);
+
+        /*!
+         * \brief Computes 256-bin histogram of bytes
+         *
+         * Fast path for byte histograms. Every workgroup keeps several copies of bins in shared memory, so threads,
+         * counting the same byte value, rarely collide on the same atomic.
+         * \param runner Runner to compute histogram with
+         * \param input buffer with bytes
+         * \param bins buffer to write counts of bytes to. Previous content is overwritten
+         * \throws InvalidArgumentException - thrown if runner is nullptr or bins buffer has less than 256 elements
+         * \throws VulkanException - thrown if failed to execute computation
+         */
+        static void computeBytes(Runner* runner, const Buffer<uint8_t>& input, Buffer<uint32_t>& bins);
+
+        /*!
+         * \brief Returns number of bins
+         * \return number of bins
+         */
+        uint32_t getBinCount() const { return m_binCount; }
+
+        /*!
+         * \brief Checks if bins are counted in shared memory
+         * \return is privatized flag
+         */
+        bool isPrivatized() const { return m_isPrivatized; }
+
+        /*!
+         * \brief Enables or disables counting bins in shared memory
+         *
+         * Privatization is enabled by default, if bins fit in shared memory. Disabling it is useful only
+         * to measure its effect.
+         * \param enabled enable flag
+         */
+        void setPrivatizationEnabled(bool enabled);
+
+    private:
+        void compute(const BufferBase& input, size_t count, const char* shaderName, Buffer<uint32_t>& bins);
+
+        Runner* m_pRunner;
+        uint32_t m_binCount;
+        float m_minValue;
+        float m_maxValue;
+        bool m_isPrivatized;
+    };
+}
+
+#endif //VULKALC_LIBRARY_HISTOGRAM_H
@@ -28,24 +28,174 @@
  * \author Lev Sizov
  * \date 28.05.17
  *
- * This file contains InformationProvider class which provides information about system and Vulkan installation
+ * This file contains InformationProvider class which provides live information about device memory budget
  *
  */
 
+#pragma once
+
 #ifndef VULKALC_LIBRARY_INFORMATIONPROVIDER_H
 #define VULKALC_LIBRARY_INFORMATIONPROVIDER_H
 
-#include "RAII.hpp"
 #include "Export.hpp"
+#include "Exceptions.h"
+
+#include <vulkan/vulkan.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 /*!
  * \copydoc Vulkalc
  */
 namespace Vulkalc
 {
+    /*!
+     * \class InformationProvider
+     * \brief Tracks budget and usage of every memory heap of device
+     *
+     * With VK_EXT_memory_budget budget and usage of the whole process are reported by driver on refresh(),
+     * allocations made since then are added to reported usage. Otherwise usage is tracked by allocations
+     * of Vulkalc and budget is size of heap.
+     * \note Polling and tracking are lock-free and thread-safe.
+     */
     class VULKALC_API InformationProvider
     {
+    public:
+        /*!
+         * \brief Budget and usage of one memory heap
+         */
+        struct HeapBudget
+        {
+            /*!
+             * \brief Number of bytes, which process can allocate from heap without degrading performance
+             */
+            VkDeviceSize budget;
+            /*!
+             * \brief Estimated number of bytes allocated from heap by process
+             */
+            VkDeviceSize usage;
+            /*!
+             * \brief Number of bytes allocated from heap by Vulkalc
+             */
+            VkDeviceSize trackedUsage;
+            /*!
+             * \brief Flag of heap in device local memory
+             */
+            bool isDeviceLocal;
+        };
+
+        /*!
+         * \brief Function called when usage of heap crosses watermark upwards
+         */
+        typedef std::function<void(uint32_t heapIndex, const HeapBudget& budget)> WatermarkCallback;
+
+        /*!
+         * \brief InformationProvider constructor
+         * \param instance instance, which physical device belongs to
+         * \param physicalDevice device to track heaps of
+         * \param isMemoryBudgetEnabled true, if VK_EXT_memory_budget is enabled on device
+         * and VK_KHR_get_physical_device_properties2 is enabled on instance
+         */
+        InformationProvider(VkInstance instance, VkPhysicalDevice physicalDevice, bool isMemoryBudgetEnabled);
+
+        /*!
+         * \brief InformationProvider destructor
+         */
+        ~InformationProvider();
+
+        /*!
+         * \brief Checks if budget and usage are reported by driver
+         * \return true, if VK_EXT_memory_budget is used
+         */
+        bool isMemoryBudgetSupported() const { return m_vkGetMemoryProperties2 != nullptr; }
+
+        /*!
+         * \brief Returns number of memory heaps of device
+         * \return number of heaps
+         */
+        uint32_t getHeapCount() const { return m_heapCount; }
+
+        /*!
+         * \brief Returns budget and usage of heap without calling driver
+         * \param heapIndex index of heap
+         * \return budget and usage of heap
+         * \throws InvalidArgumentException - thrown if heap doesn't exist
+         */
+        HeapBudget getHeapBudget(uint32_t heapIndex) const;
+
+        /*!
+         * \brief Returns budgets and usages of all heaps without calling driver
+         * \return budgets and usages indexed by heap
+         */
+        std::vector<HeapBudget> getHeapBudgets() const;
+
+        /*!
+         * \brief Queries budget and usage of heaps from driver, if VK_EXT_memory_budget is supported
+         * \note Budget changes, when other processes allocate memory, so it should be refreshed periodically,
+         * e.g. before scheduling of big allocations.
+         */
+        void refresh();
+
+        /*!
+         * \brief Sets watermark, crossing of which calls callback
+         * \param fraction fraction of budget of heap, e.g. 0.9
+         * \param callback function to call, when usage of any heap crosses fraction of its budget upwards.
+         * It is called once per crossing by thread, which allocated memory or refreshed budget.
+         * Empty function disables watermark
+         * \throws InvalidArgumentException - thrown if fraction isn't in (0, 1]
+         */
+        void setWatermark(double fraction, WatermarkCallback callback);
+
+        /*!
+         * \brief Adds allocation to tracked usage
+         * \param memoryTypeIndex memory type of allocation
+         * \param size size of allocation in bytes
+         */
+        void trackAllocation(uint32_t memoryTypeIndex, VkDeviceSize size);
+
+        /*!
+         * \brief Removes freed allocation from tracked usage
+         * \param memoryTypeIndex memory type of allocation
+         * \param size size of allocation in bytes
+         */
+        void trackFree(uint32_t memoryTypeIndex, VkDeviceSize size);
+
+    private:
+        InformationProvider(const InformationProvider&);
+
+        void operator=(const InformationProvider&);
+
+        struct Heap
+        {
+            VkDeviceSize size;
+            bool isDeviceLocal;
+            std::atomic<uint64_t> budget;
+            std::atomic<uint64_t> reportedUsage;
+            std::atomic<uint64_t> trackedUsage;
+            //tracked usage at the moment of last refresh, which is already included in reported usage
+            std::atomic<uint64_t> trackedUsageAtRefresh;
+            std::atomic<uint64_t> watermark;
+            std::atomic<bool> isAboveWatermark;
+        };
+
+        HeapBudget getHeapBudget(const Heap& heap) const;
+
+        void updateWatermark(Heap& heap);
+
+        void checkWatermark(uint32_t heapIndex);
 
+        VkPhysicalDevice m_vkPhysicalDevice;
+        VkPhysicalDeviceMemoryProperties m_vkMemoryProperties;
+        PFN_vkVoidFunction m_vkGetMemoryProperties2;
+        //heaps are never reallocated, so atomics are accessed without locks
+        std::unique_ptr<Heap[]> m_heaps;
+        uint32_t m_heapCount;
+        std::mutex m_watermarkMutex;
+        double m_watermarkFraction;
+        WatermarkCallback m_watermarkCallback;
     };
 }
 
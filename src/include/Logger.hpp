@@ -0,0 +1,302 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Logger.hpp
+ * \brief Contains Logger class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_LOGGER_H
+#define VULKALC_LIBRARY_LOGGER_H
+
+#include "Export.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief Minimal level of messages, which are compiled in. Messages with lower level are skipped at compile time
+ * \note Define it to 0 for all messages, 1 to skip INFO, 2 to skip INFO and WARN.
+ */
+#ifndef VULKALC_MIN_LOG_LEVEL
+#define VULKALC_MIN_LOG_LEVEL 0
+#endif
+
+/*!
+ * \brief Queues INFO message with up to Logger::MAX_FIELDS fields to Logger, if logger is not nullptr
+ *
+ * Usage: \code VULKALC_LOG_INFO(logger, "dispatch", {"kernel", name}, {"size", bytes}); \endcode
+ * If INFO messages are not compiled in, expands to nothing and arguments are not evaluated.
+ */
+#if VULKALC_MIN_LOG_LEVEL <= 0
+#define VULKALC_LOG_INFO(logger, ...) VULKALC_LOG(logger, Vulkalc::Logger::LEVEL_INFO, __VA_ARGS__)
+#else
+#define VULKALC_LOG_INFO(logger, ...) do {} while (false)
+#endif
+
+/*!
+ * \brief Queues WARN message with fields to Logger, if logger is not nullptr
+ * \see VULKALC_LOG_INFO
+ */
+#if VULKALC_MIN_LOG_LEVEL <= 1
+#define VULKALC_LOG_WARN(logger, ...) VULKALC_LOG(logger, Vulkalc::Logger::LEVEL_WARN, __VA_ARGS__)
+#else
+#define VULKALC_LOG_WARN(logger, ...) do {} while (false)
+#endif
+
+/*!
+ * \brief Queues ERROR message with fields to Logger, if logger is not nullptr
+ * \see VULKALC_LOG_INFO
+ */
+#if VULKALC_MIN_LOG_LEVEL <= 2
+#define VULKALC_LOG_ERROR(logger, ...) VULKALC_LOG(logger, Vulkalc::Logger::LEVEL_ERROR, __VA_ARGS__)
+#else
+#define VULKALC_LOG_ERROR(logger, ...) do {} while (false)
+#endif
+
+/*!
+ * \brief Common part of VULKALC_LOG_INFO, VULKALC_LOG_WARN and VULKALC_LOG_ERROR, logger is evaluated once
+ */
+#define VULKALC_LOG(logger, level, ...) \
+    do \
+    { \
+        Vulkalc::Logger* vulkalcLogger = (logger); \
+        if (vulkalcLogger) \
+            vulkalcLogger->log(level, __VA_ARGS__); \
+    } while (false)
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Logger
+     * \brief Asynchronous logger, which writes messages to streams on background thread
+     *
+     * Calling thread only copies message with its level and monotonic timestamp into lock-free ring buffer.
+     * Background thread formats records and writes them to streams. If ring buffer is full, message is dropped
+     * and counted instead of blocking calling thread.
+     * \note log() may be called from any number of threads.
+     */
+    class VULKALC_API Logger
+    {
+    public:
+        /*!
+         * \brief Enumeration for logging levels
+         */
+        enum LEVEL { LEVEL_INFO, LEVEL_WARN, LEVEL_ERROR };
+
+        /*!
+         * \brief Maximum length of message, longer messages are truncated
+         */
+        static const uint32_t MAX_MESSAGE_LENGTH = 240;
+
+        /*!
+         * \brief Default number of records in ring buffer
+         */
+        static const size_t DEFAULT_CAPACITY = 4096;
+
+        /*!
+         * \brief Maximum number of fields of one message, extra fields are ignored
+         */
+        static const uint32_t MAX_FIELDS = 4;
+
+        /*!
+         * \brief Key-value pair, which is attached to message and formatted on background thread as key=value
+         * \warning Key is not copied, so it must be string literal. String values are copied with message and share
+         * MAX_MESSAGE_LENGTH limit with it.
+         */
+        struct VULKALC_API Field
+        {
+            /*!
+             * \brief Enumeration for types of field values
+             */
+            enum TYPE { TYPE_NONE, TYPE_INTEGER, TYPE_UNSIGNED, TYPE_REAL, TYPE_STRING };
+
+            /*!
+             * \brief Key of field, nullptr for absent field
+             */
+            const char* key;
+            /*!
+             * \brief Type of value
+             */
+            TYPE type;
+
+            /*!
+             * \brief Value of field
+             */
+            union
+            {
+                int64_t integer;
+                uint64_t unsignedInteger;
+                double real;
+                const char* string;
+            } value;
+
+            /*!
+             * \brief Constructs absent field
+             */
+            Field() : key(nullptr), type(TYPE_NONE) { value.integer = 0; }
+
+            Field(const char* key, int value) : Field(key, static_cast<long long>(value)) {}
+
+            Field(const char* key, long value) : Field(key, static_cast<long long>(value)) {}
+
+            Field(const char* key, long long value) : key(key), type(TYPE_INTEGER) { this->value.integer = value; }
+
+            Field(const char* key, unsigned value) : Field(key, static_cast<unsigned long long>(value)) {}
+
+            Field(const char* key, unsigned long value) : Field(key, static_cast<unsigned long long>(value)) {}
+
+            Field(const char* key, unsigned long long value) : key(key), type(TYPE_UNSIGNED)
+            {
+                this->value.unsignedInteger = value;
+            }
+
+            Field(const char* key, double value) : key(key), type(TYPE_REAL) { this->value.real = value; }
+
+            Field(const char* key, const char* value) : key(key), type(TYPE_STRING) { this->value.string = value; }
+
+            Field(const char* key, const std::string& value) : Field(key, value.c_str()) {}
+        };
+
+        /*!
+         * \brief Logger constructor. Starts background thread
+         * \param prefix text written before every message
+         * \param logStream stream for INFO and WARN messages, nullptr to skip them
+         * \param errorStream stream for ERROR messages, nullptr to skip them
+         * \param capacity number of records in ring buffer, rounded up to power of 2
+         */
+        Logger(const std::string& prefix, std::ostream* logStream, std::ostream* errorStream,
+               size_t capacity = DEFAULT_CAPACITY);
+
+        /*!
+         * \brief Logger destructor. Writes all queued messages and stops background thread
+         */
+        ~Logger();
+
+        /*!
+         * \brief Queues message with fields
+         *
+         * Message, values of fields and timestamp are copied, everything else happens on background thread.
+         * \param level level of message
+         * \param message message to write
+         * \param field0 first field, absent by default
+         * \param field1 second field, absent by default
+         * \param field2 third field, absent by default
+         * \param field3 fourth field, absent by default
+         * \return false, if message was dropped because ring buffer is full
+         */
+        bool log(LEVEL level, const char* message, const Field& field0 = Field(), const Field& field1 = Field(),
+                 const Field& field2 = Field(), const Field& field3 = Field());
+
+        /*!
+         * \brief Queues message with fields, if its level is compiled in
+         * \tparam level level of message
+         * \see log(LEVEL, const char*, const Field&, const Field&, const Field&, const Field&)
+         */
+        template<LEVEL level>
+        bool log(const char* message, const Field& field0 = Field(), const Field& field1 = Field(),
+                 const Field& field2 = Field(), const Field& field3 = Field())
+        {
+            return level < VULKALC_MIN_LOG_LEVEL || log(level, message, field0, field1, field2, field3);
+        }
+
+        /*!
+         * \brief Waits until all messages queued before the call are written and streams are flushed
+         *
+         * Streams are written and flushed by background thread, after return it doesn't touch them until
+         * next message is queued.
+         */
+        void flush();
+
+        /*!
+         * \brief Returns number of messages dropped because ring buffer was full
+         * \return number of dropped messages
+         */
+        uint64_t getDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+
+        /*!
+         * \brief Returns number of messages written to streams
+         * \return number of written messages
+         */
+        uint64_t getWrittenCount() const { return m_dequeuePosition.load(std::memory_order_acquire); }
+
+    private:
+        Logger(const Logger&);
+
+        void operator=(const Logger&);
+
+        struct Record
+        {
+            uint64_t timestamp;
+            LEVEL level;
+            uint32_t length;
+            uint32_t fieldCount;
+            Field fields[MAX_FIELDS];
+            //string values of fields are stored in text after message
+            uint32_t stringOffsets[MAX_FIELDS];
+            uint32_t stringLengths[MAX_FIELDS];
+            char text[MAX_MESSAGE_LENGTH];
+        };
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            Record record;
+        };
+
+        bool drain();
+
+        void write(const Record& record);
+
+        void run();
+
+        std::string m_prefix;
+        std::ostream* m_pLogStream;
+        std::ostream* m_pErrorStream;
+        std::chrono::steady_clock::time_point m_startTime;
+        std::vector<Slot> m_slots;
+        size_t m_mask;
+        std::atomic<size_t> m_enqueuePosition;
+        std::atomic<size_t> m_dequeuePosition;
+        //position, up to which messages are written and streams are flushed
+        std::atomic<size_t> m_flushedPosition;
+        std::atomic<uint64_t> m_droppedCount;
+        std::atomic<bool> m_isStopping;
+        std::thread m_thread;
+    };
+}
+
+#endif //VULKALC_LIBRARY_LOGGER_H
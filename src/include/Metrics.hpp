@@ -0,0 +1,381 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Metrics.hpp
+ * \brief Contains Metrics registry and metric classes declarations
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_METRICS_H
+#define VULKALC_LIBRARY_METRICS_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Counter
+     * \brief Monotonic counter, which is incremented without contention from any number of threads
+     *
+     * Counter is split into shards on separate cache lines. Every thread increments its own shard, value is sum
+     * of all shards.
+     */
+    class VULKALC_API Counter
+    {
+    public:
+        /*!
+         * \brief Number of shards
+         */
+        static const size_t SHARD_COUNT = 16;
+
+        /*!
+         * \brief Counter constructor
+         */
+        Counter();
+
+        /*!
+         * \brief Adds value to counter
+         * \param value value to add
+         */
+        void add(uint64_t value = 1)
+        {
+            m_shards[getShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        /*!
+         * \brief Returns current value
+         * \return sum of all shards
+         */
+        uint64_t get() const;
+
+        /*!
+         * \brief Returns shard of calling thread
+         * \return index of shard
+         */
+        static size_t getShardIndex();
+
+    private:
+        Counter(const Counter&);
+
+        void operator=(const Counter&);
+
+        //shards are padded to cache line, so threads don't invalidate cache lines of each other
+        struct Shard
+        {
+            std::atomic<uint64_t> value;
+            char padding[64 - sizeof(std::atomic<uint64_t>)];
+        };
+
+        Shard m_shards[SHARD_COUNT];
+    };
+
+    /*!
+     * \class Gauge
+     * \brief Value, which may go up and down, like number of allocated pools
+     */
+    class VULKALC_API Gauge
+    {
+    public:
+        /*!
+         * \brief Gauge constructor
+         */
+        Gauge() : m_value(0) {}
+
+        /*!
+         * \brief Sets value
+         * \param value new value
+         */
+        void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+
+        /*!
+         * \brief Adds value, which may be negative
+         * \param value value to add
+         */
+        void add(int64_t value) { m_value.fetch_add(value, std::memory_order_relaxed); }
+
+        /*!
+         * \brief Returns current value
+         * \return value
+         */
+        int64_t get() const { return m_value.load(std::memory_order_relaxed); }
+
+    private:
+        Gauge(const Gauge&);
+
+        void operator=(const Gauge&);
+
+        std::atomic<int64_t> m_value;
+    };
+
+    /*!
+     * \class LatencyHistogram
+     * \brief Histogram of durations in nanoseconds with logarithmic buckets
+     *
+     * Like HdrHistogram, every power of 2 is split into SUB_BUCKET_COUNT linear buckets, so relative error
+     * of percentiles is at most 1 / SUB_BUCKET_COUNT over the whole range of uint64_t. Recording is one relaxed
+     * atomic increment per bucket, count and sum.
+     */
+    class VULKALC_API LatencyHistogram
+    {
+    public:
+        /*!
+         * \brief Number of bits of value, which select linear bucket in power of 2
+         */
+        static const uint32_t SUB_BUCKET_BITS = 4;
+
+        /*!
+         * \brief Number of linear buckets in every power of 2
+         */
+        static const uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+
+        /*!
+         * \brief Total number of buckets
+         */
+        static const uint32_t BUCKET_COUNT = SUB_BUCKET_COUNT + (64 - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+        /*!
+         * \brief Copy of histogram at some moment
+         */
+        struct VULKALC_API Snapshot
+        {
+            /*!
+             * \brief Number of recorded values
+             */
+            uint64_t count;
+            /*!
+             * \brief Sum of recorded values in nanoseconds
+             */
+            uint64_t sum;
+            /*!
+             * \brief Number of values in every bucket
+             */
+            std::vector<uint64_t> buckets;
+
+            /*!
+             * \brief Returns percentile of recorded values
+             * \param percentile percentile from 0 to 100
+             * \return highest value of bucket, which contains percentile, in nanoseconds, or 0 if histogram is empty
+             */
+            uint64_t getPercentile(double percentile) const;
+        };
+
+        /*!
+         * \brief LatencyHistogram constructor
+         */
+        LatencyHistogram();
+
+        /*!
+         * \brief Records duration
+         * \param nanoseconds duration in nanoseconds
+         */
+        void record(uint64_t nanoseconds)
+        {
+            m_buckets[getBucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+        }
+
+        /*!
+         * \brief Returns copy of histogram
+         * \return snapshot
+         */
+        Snapshot getSnapshot() const;
+
+        /*!
+         * \brief Returns index of bucket for value
+         * \param value value in nanoseconds
+         * \return index of bucket
+         */
+        static uint32_t getBucketIndex(uint64_t value);
+
+        /*!
+         * \brief Returns smallest value, which doesn't fit in bucket
+         * \param index index of bucket
+         * \return exclusive upper bound of bucket in nanoseconds
+         */
+        static uint64_t getBucketUpperBound(uint32_t index);
+
+    private:
+        LatencyHistogram(const LatencyHistogram&);
+
+        void operator=(const LatencyHistogram&);
+
+        std::atomic<uint64_t> m_buckets[BUCKET_COUNT];
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_sum;
+    };
+
+    /*!
+     * \class Metrics
+     * \brief Registry of named counters, gauges and latency histograms
+     *
+     * Metrics are registered once by name and then updated through returned reference without any lock.
+     * Snapshot of all metrics can be written in Prometheus text exposition format.
+     * \note Registration and snapshots may be called from any thread.
+     */
+    class VULKALC_API Metrics
+    {
+    public:
+        /*!
+         * \brief Value of counter or gauge in snapshot
+         */
+        struct Value
+        {
+            /*!
+             * \brief Name of metric
+             */
+            std::string name;
+            /*!
+             * \brief Description of metric
+             */
+            std::string help;
+            /*!
+             * \brief Value of metric
+             */
+            double value;
+        };
+
+        /*!
+         * \brief Latency histogram in snapshot
+         */
+        struct Distribution
+        {
+            /*!
+             * \brief Name of metric
+             */
+            std::string name;
+            /*!
+             * \brief Description of metric
+             */
+            std::string help;
+            /*!
+             * \brief Copy of histogram
+             */
+            LatencyHistogram::Snapshot histogram;
+        };
+
+        /*!
+         * \brief Copy of all metrics at some moment
+         */
+        struct Snapshot
+        {
+            /*!
+             * \brief Values of counters
+             */
+            std::vector<Value> counters;
+            /*!
+             * \brief Values of gauges
+             */
+            std::vector<Value> gauges;
+            /*!
+             * \brief Copies of latency histograms
+             */
+            std::vector<Distribution> histograms;
+        };
+
+        /*!
+         * \brief Metrics constructor
+         */
+        Metrics() {}
+
+        /*!
+         * \brief Returns counter with name, registers it on first call
+         * \param name name of counter in Prometheus format, like vulkalc_submits_total
+         * \param help description of counter
+         * \return reference to counter, valid while Metrics exists
+         * \throws InvalidArgumentException - thrown if name is invalid or used by metric of other type
+         */
+        Counter& getCounter(const std::string& name, const std::string& help = "");
+
+        /*!
+         * \brief Returns gauge with name, registers it on first call
+         * \param name name of gauge in Prometheus format
+         * \param help description of gauge
+         * \return reference to gauge, valid while Metrics exists
+         * \throws InvalidArgumentException - thrown if name is invalid or used by metric of other type
+         */
+        Gauge& getGauge(const std::string& name, const std::string& help = "");
+
+        /*!
+         * \brief Returns latency histogram with name, registers it on first call
+         * \param name name of histogram in Prometheus format, like vulkalc_queue_wait_seconds
+         * \param help description of histogram
+         * \return reference to histogram, valid while Metrics exists
+         * \throws InvalidArgumentException - thrown if name is invalid or used by metric of other type
+         */
+        LatencyHistogram& getHistogram(const std::string& name, const std::string& help = "");
+
+        /*!
+         * \brief Returns copy of all metrics
+         * \return snapshot sorted by name
+         */
+        Snapshot getSnapshot() const;
+
+        /*!
+         * \brief Writes all metrics in Prometheus text exposition format
+         *
+         * Histograms are written in seconds with bucket boundaries at powers of 2 nanoseconds from 1 us to 17 s.
+         * \param stream stream to write to
+         */
+        void writePrometheus(std::ostream& stream) const;
+
+        /*!
+         * \brief Writes all metrics in Prometheus text exposition format to file, replacing it
+         * \param path path to file
+         * \throws InvalidArgumentException - thrown if failed to write file
+         */
+        void writePrometheus(const char* path) const;
+
+    private:
+        Metrics(const Metrics&);
+
+        void operator=(const Metrics&);
+
+        void checkName(const std::string& name, const void* registry) const;
+
+        mutable std::mutex m_mutex;
+        std::map<std::string, std::pair<std::string, std::unique_ptr<Counter>>> m_counters;
+        std::map<std::string, std::pair<std::string, std::unique_ptr<Gauge>>> m_gauges;
+        std::map<std::string, std::pair<std::string, std::unique_ptr<LatencyHistogram>>> m_histograms;
+    };
+}
+
+#endif //VULKALC_LIBRARY_METRICS_H
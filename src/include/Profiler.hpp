@@ -0,0 +1,218 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Profiler.hpp
+ * \brief Contains Profiler class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_PROFILER_H
+#define VULKALC_LIBRARY_PROFILER_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <vulkan/vulkan.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Profiler
+     * \brief Measures device time of every executed dispatch, fill and copy with timestamp queries
+     *
+     * Every command is surrounded by pair of vkCmdWriteTimestamp. Queries come from pools, which are reused after
+     * results of every execution are collected. Durations are aggregated per kernel name.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API Profiler
+    {
+    public:
+        /*!
+         * \brief Number of queries in one VkQueryPool
+         */
+        static const uint32_t QUERIES_PER_POOL = 256;
+
+        /*!
+         * \brief Number of latest durations of every kernel, which percentiles are computed from
+         */
+        static const size_t SAMPLE_WINDOW = 4096;
+
+        /*!
+         * \brief Aggregated durations of one kernel
+         */
+        struct KernelStatistics
+        {
+            /*!
+             * \brief Number of measured executions
+             */
+            uint64_t count;
+            /*!
+             * \brief Shortest duration in microseconds
+             */
+            double minMicroseconds;
+            /*!
+             * \brief Mean duration in microseconds
+             */
+            double meanMicroseconds;
+            /*!
+             * \brief 99th percentile of latest SAMPLE_WINDOW durations in microseconds
+             */
+            double p99Microseconds;
+            /*!
+             * \brief Sum of all durations in microseconds
+             */
+            double totalMicroseconds;
+        };
+
+        /*!
+         * \brief Measured command, which results are already collected
+         */
+        struct Sample
+        {
+            /*!
+             * \brief Name of kernel
+             */
+            const char* name;
+            /*!
+             * \brief Index of queue, which executed command
+             */
+            uint32_t queue;
+            /*!
+             * \brief Device timestamp of beginning in nanoseconds
+             */
+            double beginNanoseconds;
+            /*!
+             * \brief Device timestamp of end in nanoseconds
+             */
+            double endNanoseconds;
+        };
+
+        /*!
+         * \brief Profiler constructor
+         * \param device device to create query pools on
+         * \param timestampPeriod number of nanoseconds per timestamp tick, VkPhysicalDeviceLimits::timestampPeriod
+         * \param timestampValidBits number of valid bits of timestamps written by compute queue family
+         */
+        Profiler(VkDevice device, float timestampPeriod, uint32_t timestampValidBits);
+
+        /*!
+         * \brief Profiler destructor. Destroys query pools
+         */
+        ~Profiler();
+
+        /*!
+         * \brief Sets index of queue, which will execute commands recorded after the call
+         * \param queue index of queue
+         */
+        void setQueue(uint32_t queue) { m_queue = queue; }
+
+        /*!
+         * \brief Records timestamp before measured command
+         * \param commandBuffer command buffer being recorded
+         * \param name name of kernel, must live until results are collected
+         * \throws VulkanException - thrown if failed to create VkQueryPool
+         */
+        void begin(VkCommandBuffer commandBuffer, const char* name);
+
+        /*!
+         * \brief Records timestamp after measured command
+         * \param commandBuffer command buffer being recorded
+         */
+        void end(VkCommandBuffer commandBuffer);
+
+        /*!
+         * \brief Reads timestamps of all measured commands and aggregates them. Queries become free for reuse
+         * \param isAggregated false to only fill last samples, e.g. for trace, without changing statistics
+         * \warning Command buffers with measured commands must be completed.
+         * \throws VulkanException - thrown if failed to get query results
+         */
+        void collect(bool isAggregated = true);
+
+        /*!
+         * \brief Frees queries of measured commands without reading them, used when submission failed
+         */
+        void discard();
+
+        /*!
+         * \brief Returns aggregated durations
+         * \return map of kernel names to their statistics
+         */
+        std::map<std::string, KernelStatistics> getStatistics() const;
+
+        /*!
+         * \brief Returns commands measured by last collect()
+         * \return vector of samples in order of recording
+         */
+        const std::vector<Sample>& getLastSamples() const { return m_lastSamples; }
+
+        /*!
+         * \brief Clears aggregated durations
+         */
+        void reset() { m_kernels.clear(); }
+
+    private:
+        Profiler(const Profiler&);
+
+        void operator=(const Profiler&);
+
+        struct Scope
+        {
+            const char* name;
+            uint32_t queue;
+            uint32_t query;
+        };
+
+        struct Kernel
+        {
+            uint64_t count;
+            double minMicroseconds;
+            double totalMicroseconds;
+            std::vector<double> window;
+            size_t nextSample;
+        };
+
+        VkDevice m_vkDevice;
+        double m_timestampPeriod;
+        uint64_t m_timestampMask;
+        std::vector<VkQueryPool> m_vkQueryPools;
+        uint32_t m_usedQueryCount;
+        uint32_t m_queue;
+        std::vector<Scope> m_scopes;
+        std::vector<uint64_t> m_timestamps;
+        std::vector<Sample> m_lastSamples;
+        std::map<std::string, Kernel> m_kernels;
+    };
+}
+
+#endif //VULKALC_LIBRARY_PROFILER_H
@@ -0,0 +1,129 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Recording.hpp
+ * \brief Contains Recording class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_RECORDING_H
+#define VULKALC_LIBRARY_RECORDING_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Task.hpp"
+#include "ComputeGraph.hpp"
+#include "DescriptorAllocator.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <set>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    class Runner;
+
+    /*!
+     * \class Recording
+     * \brief Tasks recorded once into reusable command buffers
+     *
+     * Recording is made for workloads, which run the same Tasks many times with different data.
+     * Submitting it with Runner::execute(const Recording&) costs the same for any number of Tasks.
+     * Data may be changed by writing to bound buffers between executions. Dispatches access buffers through
+     * descriptor sets, so their buffers can also be replaced with rebind() without recording Tasks again.
+     * \note Push constants, specialization constants and workgroup counts are recorded and can't be changed.
+     * \warning Recording must be destroyed before its Runner and bound buffers must outlive it.
+     */
+    class VULKALC_API Recording
+    {
+    public:
+        /*!
+         * \brief Records Tasks, which run one after another
+         * \param runner Runner to execute Tasks on
+         * \param tasks Tasks to record
+         * \throws InvalidArgumentException - thrown if runner is nullptr
+         * \throws VulkanException - thrown if failed to record Tasks
+         * \see Runner::execute(const std::vector<Task>&)
+         */
+        Recording(Runner* runner, const std::vector<Task>& tasks);
+
+        /*!
+         * \brief Records Tasks of ComputeGraph
+         * \param runner Runner to execute Tasks on
+         * \param graph graph to record
+         * \throws InvalidArgumentException - thrown if runner is nullptr
+         * \throws VulkanException - thrown if failed to record Tasks
+         * \see Runner::execute(ComputeGraph&)
+         */
+        Recording(Runner* runner, ComputeGraph& graph);
+
+        /*!
+         * \brief Recording destructor
+         */
+        ~Recording();
+
+        /*!
+         * \brief Replaces buffer in all recorded dispatches
+         * \param buffer buffer bound to recorded dispatches
+         * \param replacement buffer to bind instead
+         * \throws InvalidArgumentException - thrown if buffer isn't bound, is used by fill, copy or barrier,
+         * replacement is smaller than buffer or is already used by recorded Tasks
+         */
+        void rebind(const BufferBase& buffer, const BufferBase& replacement);
+
+        /*!
+         * \brief Returns number of recorded command buffers, one for every used queue
+         * \return number of command buffers
+         */
+        size_t getCommandBufferCount() const { return m_vkCommandBuffers.size(); }
+
+    private:
+        friend class Runner;
+
+        Recording(const Recording&);
+
+        void operator=(const Recording&);
+
+        void prepare(const std::vector<Task>& tasks);
+
+        void release();
+
+        Runner* m_pRunner;
+        DescriptorAllocator* m_pDescriptorAllocator;
+        std::vector<VkDescriptorSet> m_vkDescriptorSets;
+        std::vector<VkCommandBuffer> m_vkCommandBuffers;
+        std::vector<std::vector<const BufferBase*>> m_bindings;
+        std::set<const BufferBase*> m_directlyUsedBuffers;
+        uint64_t m_dispatchCount;
+    };
+}
+
+#endif //VULKALC_LIBRARY_RECORDING_H
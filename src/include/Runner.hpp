@@ -0,0 +1,508 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Runner.hpp
+ * \brief Contains Runner class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains Runner class, which owns Vulkan device and executes Tasks on it
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_RUNNER_H
+#define VULKALC_LIBRARY_RUNNER_H
+
+#include "RAII.hpp"
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Expected.hpp"
+#include "Configuration.hpp"
+#include "Shader.hpp"
+#include "Task.hpp"
+#include "ComputeGraph.hpp"
+#include "Recording.hpp"
+#include "DescriptorAllocator.hpp"
+#include "Logger.hpp"
+#include "Profiler.hpp"
+#include "TraceWriter.hpp"
+#include "Metrics.hpp"
+#include "TuningDatabase.hpp"
+#include "DeviceSelector.hpp"
+#include "VulkanInfo.hpp"
+#include "InformationProvider.hpp"
+#include "Verifier.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <atomic>
+#include <vector>
+#include <map>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Runner
+     * \extends RAII
+     * \brief Owns Vulkan device and executes Tasks on it
+     *
+     * Runner selects physical device according to Configuration, creates logical device with compute queues
+     * and executes Tasks on them. Compute pipelines are created on first use and cached.
+     * Descriptor sets of executed Tasks come from pools, which are reset after every execution. If device supports
+     * VK_KHR_push_descriptor and VK_KHR_get_physical_device_properties2 is enabled in Configuration, descriptors
+     * of dispatches are pushed to command buffer instead, without any allocation.
+     * If profiling is enabled, device time of every executed Task is measured by Profiler.
+     *
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API Runner final : private RAII
+    {
+    public:
+        /*!
+         * \brief Maximum number of bindings of dispatch, which descriptors are pushed, guaranteed by Vulkan
+         */
+        static const uint32_t MAX_PUSH_DESCRIPTORS = 32;
+
+        /*!
+         * \brief Runner constructor
+         * \param instance VkInstance to select physical device from
+         * \param configuration Configuration with device settings, which is read only by constructor
+         * \throws InvalidArgumentException - thrown if configured device doesn't exist or doesn't support compute,
+         * or if automatic selection found no device with compute support
+         * \throws VulkanException - thrown if failed to create device or its objects
+         */
+        Runner(VkInstance instance, const Configuration* configuration);
+
+        /*!
+         * \brief Runner destructor
+         */
+        ~Runner();
+
+        /*!
+         * \brief Executes Task and waits for its completion
+         * \param task Task to execute
+         * \throws VulkanException - thrown if failed to execute Task
+         */
+        void execute(const Task& task);
+
+        /*!
+         * \brief Executes Tasks one after another in single submission and waits for their completion
+         *
+         * Every Task waits for results of previous Tasks.
+         * \param tasks Tasks to execute
+         * \throws VulkanException - thrown if failed to execute Tasks
+         * \see execute(ComputeGraph&) for execution synchronized by real dependencies
+         */
+        void execute(const std::vector<Task>& tasks);
+
+        /*!
+         * \brief Executes Tasks of ComputeGraph and waits for their completion
+         *
+         * Tasks wait only for Tasks they depend on. Independent branches of graph run on separate queues.
+         * \param graph graph to execute
+         * \throws VulkanException - thrown if failed to execute Tasks
+         */
+        void execute(ComputeGraph& graph);
+
+        /*!
+         * \brief Submits previously recorded Tasks and waits for their completion
+         *
+         * Nothing is recorded, so CPU cost doesn't depend on number of Tasks.
+         * \param recording Recording made by this Runner
+         * \throws InvalidArgumentException - thrown if recording was made by another Runner
+         * \throws VulkanException - thrown if failed to execute Tasks
+         */
+        void execute(const Recording& recording);
+
+        /*!
+         * \brief Submits previously recorded Tasks and waits for their completion without throwing exceptions
+         * \param recording Recording made by this Runner
+         * \return ERROR_INVALID_ARGUMENT, if recording was made by another Runner, or ERROR_VULKAN with VkResult,
+         * if failed to execute Tasks
+         * \see execute(const Recording&)
+         */
+        Expected<void> tryExecute(const Recording& recording);
+
+        /*!
+         * \brief Returns number of created compute queues
+         * \return number of compute queues
+         */
+        uint32_t getComputeQueueCount() const { return static_cast<uint32_t>(m_vkComputeQueues.size()); }
+
+        /*!
+         * \brief Returns ShaderLoader, which loads shaders to device of this Runner
+         * \return pointer to ShaderLoader
+         */
+        ShaderLoader* getShaderLoader() { return m_pShaderLoader; }
+
+        /*!
+         * \brief Returns used VkPhysicalDevice
+         * \return VkPhysicalDevice
+         */
+        VkPhysicalDevice getVkPhysicalDevice() const { return m_vkPhysicalDevice; }
+
+        /*!
+         * \brief Returns VkDevice handle
+         * \return VkDevice
+         */
+        VkDevice getVkDevice() const { return m_vkDevice; }
+
+        /*!
+         * \brief Returns properties of used physical device
+         * \return VkPhysicalDeviceProperties
+         */
+        const VkPhysicalDeviceProperties& getPhysicalDeviceProperties() const { return m_vkPhysicalDeviceProperties; }
+
+        /*!
+         * \brief Finds index of memory type with required properties
+         * \param memoryTypeBits bitmask of allowed memory types
+         * \param properties required properties
+         * \return index of memory type
+         * \throws VulkanException - thrown if there is no suitable memory type
+         */
+        uint32_t findMemoryTypeIndex(uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
+        /*!
+         * \brief Returns size of one-dimensional workgroup, supported by device
+         * \param preferredSize preferred number of invocations in workgroup
+         * \return preferredSize, limited by device limits
+         */
+        uint32_t getWorkgroupSize(uint32_t preferredSize = 256) const;
+
+        /*!
+         * \brief Returns tuned parameter of built-in kernel
+         * \param kernel name of kernel
+         * \param parameter name of parameter
+         * \param defaultValue value to return, if parameter is not tuned for device
+         * \return value of parameter
+         */
+        uint32_t getKernelParameter(const char* kernel, const char* parameter, uint32_t defaultValue) const;
+
+        /*!
+         * \brief Returns size of one-dimensional workgroup of built-in kernel, tuned or default one
+         * \param kernel name of kernel
+         * \return tuned workgroupSize parameter of kernel or 256, limited by device limits
+         */
+        uint32_t getKernelWorkgroupSize(const char* kernel) const
+        {
+            return getWorkgroupSize(getKernelParameter(kernel, "workgroupSize", 256));
+        }
+
+        /*!
+         * \brief Returns tuned parameters of built-in kernels, loaded from Configuration::tuningFile
+         * \return parameters of kernels
+         */
+        const TuningDatabase::KernelParameters& getKernelParameters() const { return m_kernelParameters; }
+
+        /*!
+         * \brief Replaces tuned parameters of built-in kernels
+         * \param parameters parameters of kernels, values must be greater than 0
+         * \throws InvalidArgumentException - thrown if any value is 0
+         */
+        void setKernelParameters(const TuningDatabase::KernelParameters& parameters);
+
+        /*!
+         * \brief Returns key of selected device in TuningDatabase
+         * \return key of device
+         */
+        std::string getDeviceKey() const { return TuningDatabase::getDeviceKey(m_vkPhysicalDeviceProperties); }
+
+        /*!
+         * \brief Returns number of one-dimensional workgroups for shader, which loops over items
+         * \param itemCount number of items
+         * \param workgroupSize size of workgroup
+         * \param itemsPerInvocation minimal number of items, processed by every invocation
+         * \return number of workgroups, at least 1 and not more than supported by device
+         */
+        uint32_t getGroupCount(size_t itemCount, uint32_t workgroupSize, uint32_t itemsPerInvocation) const;
+
+        /*!
+         * \brief Returns true, if device supports pushing descriptors
+         * \return true, if VK_KHR_push_descriptor is enabled on device
+         */
+        bool isPushDescriptorSupported() const { return m_isPushDescriptorSupported; }
+
+        /*!
+         * \brief Returns true, if descriptors of executed dispatches are pushed
+         * \return true, if push descriptors are supported and enabled
+         */
+        bool isPushDescriptorEnabled() const { return m_isPushDescriptorSupported && m_isPushDescriptorEnabled; }
+
+        /*!
+         * \brief Enables or disables pushing descriptors of executed dispatches. Enabled by default
+         * \note Recording always uses descriptor sets, so its buffers can be rebound.
+         * \param isEnabled true to push descriptors, if device supports it
+         */
+        void setPushDescriptorEnabled(bool isEnabled) { m_isPushDescriptorEnabled = isEnabled; }
+
+        /*!
+         * \brief Returns counters of descriptor sets allocated for executed Tasks
+         * \return DescriptorAllocator::Statistics
+         */
+        const DescriptorAllocator::Statistics& getDescriptorStatistics() const
+        {
+            return m_pDescriptorAllocator->getStatistics();
+        }
+
+        /*!
+         * \brief Returns number of descriptor sets pushed to command buffers
+         * \return number of pushed descriptor sets
+         */
+        uint64_t getPushedDescriptorSetCount() const { return m_pushedDescriptorSetCount; }
+
+        /*!
+         * \brief Checks whether compute queue family supports timestamps, which Profiler requires
+         * \return true, if profiling is supported
+         */
+        bool isProfilingSupported() const { return m_pProfiler != nullptr; }
+
+        /*!
+         * \brief Checks whether executed Tasks are measured by Profiler
+         * \return true, if profiling is supported and enabled
+         */
+        bool isProfilingEnabled() const { return m_pProfiler != nullptr && m_isProfilingEnabled; }
+
+        /*!
+         * \brief Enables or disables profiling. Initial value is taken from Configuration
+         * \note It is safe to call while other thread executes Tasks, change applies to next execution.
+         * \param isEnabled whether executed Tasks should be measured, if profiling is supported
+         */
+        void setProfilingEnabled(bool isEnabled) { m_isProfilingEnabled = isEnabled; }
+
+        /*!
+         * \brief Returns Profiler, which measures device time of executed Tasks
+         *
+         * Tasks executed from Recording are not measured.
+         * \return pointer to Profiler or nullptr, if profiling is not supported
+         */
+        Profiler* getProfiler() const { return m_pProfiler; }
+
+        /*!
+         * \brief Returns TraceWriter, which receives host and device spans of executions
+         *
+         * Host spans are recording, submission and waiting for completion. Device spans of Tasks come from
+         * Profiler, so they are written only if profiling is supported.
+         * \return pointer to TraceWriter or nullptr, if trace file is not set in Configuration
+         */
+        TraceWriter* getTraceWriter() const { return m_pTraceWriter; }
+
+        /*!
+         * \brief Returns InformationProvider, which tracks budget and usage of memory heaps of device
+         *
+         * Budget is reported by driver, if device supports VK_EXT_memory_budget and
+         * VK_KHR_get_physical_device_properties2 is enabled in Configuration.
+         * \return pointer to InformationProvider
+         */
+        InformationProvider* getInformationProvider() const { return m_pInformationProvider; }
+
+        /*!
+         * \brief Returns Verifier, which checks every dispatch Task before its pipeline is created
+         *
+         * Features, which shaders may require, are enabled on device if supported: shaderFloat64, shaderInt64
+         * and shaderInt16.
+         * \return pointer to Verifier
+         */
+        Verifier* getVerifier() const { return m_pVerifier; }
+
+        /*!
+         * \brief Checks whether device timestamps are converted to host time with VK_EXT_calibrated_timestamps
+         *
+         * Otherwise offset between clocks is estimated from completion of executions.
+         * \return true, if device supports calibrated timestamps
+         */
+        bool isTimestampCalibrationSupported() const { return m_vkGetCalibratedTimestamps != nullptr; }
+
+        /*!
+         * \brief Sets Logger, which receives messages about executions with their fields
+         * \param logger Logger, which outlives Runner, or nullptr to disable logging
+         */
+        void setLogger(Logger* logger) { m_pLogger = logger; }
+
+        /*!
+         * \brief Returns Logger of Runner
+         * \return pointer to Logger or nullptr, if logging is disabled
+         */
+        Logger* getLogger() const { return m_pLogger; }
+
+        /*!
+         * \brief Sets Metrics, which receive counters and latencies of Runner and its Buffers
+         *
+         * Registered metrics are bytes written to and read from Buffers, size of Buffers, submitted dispatches and
+         * command buffers, hits and misses of pipeline cache, descriptor pools and sets, and latencies of executions
+         * and waiting for queues.
+         * \param metrics Metrics, which outlive Runner, or nullptr to disable metrics
+         */
+        void setMetrics(Metrics* metrics);
+
+        /*!
+         * \brief Returns Metrics of Runner
+         * \return pointer to Metrics or nullptr, if metrics are disabled
+         */
+        Metrics* getMetrics() const { return m_pMetrics; }
+
+    private:
+        friend class Recording;
+
+        friend class BufferBase;
+
+        //registered metrics, all of them are nullptr, if metrics are disabled
+        struct Instruments
+        {
+            Counter* uploadedBytes;
+            Counter* downloadedBytes;
+            Counter* dispatches;
+            Counter* submits;
+            Counter* pipelineCacheHits;
+            Counter* pipelineCacheMisses;
+            Counter* descriptorSets;
+            Gauge* bufferBytes;
+            Gauge* descriptorPools;
+            LatencyHistogram* executionLatency;
+            LatencyHistogram* queueWaitLatency;
+        };
+
+        virtual void init() override;
+
+        virtual void release() override;
+
+        void selectPhysicalDevice();
+
+        void createDevice();
+
+        bool isDeviceExtensionSupported(const char* extensionName) const;
+
+        bool isInstanceExtensionEnabled(const char* extensionName) const;
+
+        bool calibrateTimestamps();
+
+        void traceSamples(const Profiler* profiler);
+
+        //interface of shader, shaders with the same interface share layouts
+        struct LayoutKey
+        {
+            std::vector<uint32_t> bindings;
+            bool usesPushDescriptors;
+            uint32_t pushConstantsSize;
+
+            bool operator<(const LayoutKey& other) const;
+        };
+
+        struct Layout
+        {
+            std::vector<uint32_t> bindings;
+            uint32_t pushConstantsSize;
+            VkDescriptorSetLayout descriptorSetLayout;
+            VkPipelineLayout pipelineLayout;
+        };
+
+        struct PipelineKey
+        {
+            VkShaderModule shaderModule;
+            VkPipelineLayout layout;
+            std::map<uint32_t, uint32_t> specializationConstants;
+
+            bool operator<(const PipelineKey& other) const;
+        };
+
+        bool usesPushDescriptors(const Task& task) const;
+
+        const Layout& getLayout(const Shader* shader, bool usesPushDescriptors);
+
+        void writeDescriptors(const Task& task, const Layout& layout, VkDescriptorSet descriptorSet,
+                              VkDescriptorBufferInfo* bufferInfos, VkWriteDescriptorSet* writes) const;
+
+        VkPipeline getPipeline(const Task& task, bool usesPushDescriptors);
+
+        void recordTask(VkCommandBuffer commandBuffer, const Task& task, VkDescriptorSet descriptorSet);
+
+        void pushDescriptorSet(VkCommandBuffer commandBuffer, const Task& task, const Layout& layout);
+
+        void resetDescriptorAllocator();
+
+        void recordTasks(VkCommandBuffer commandBuffer, const std::vector<Task>& tasks,
+                         const std::vector<VkDescriptorSet>& descriptorSets, Profiler* profiler);
+
+        void recordSchedule(VkCommandBuffer commandBuffer, const ComputeGraph::Schedule& schedule,
+                            const std::vector<Task>& tasks, const std::vector<VkDescriptorSet>& descriptorSets,
+                            Profiler* profiler);
+
+        void recordProfiledTask(VkCommandBuffer commandBuffer, const Task& task, VkDescriptorSet descriptorSet,
+                                Profiler* profiler);
+
+        void prepareTasks(const std::vector<Task>& tasks, DescriptorAllocator* descriptorAllocator,
+                          bool allowsPushDescriptors, std::vector<VkDescriptorSet>& descriptorSets);
+
+        VkCommandBuffer beginCommandBuffer(VkCommandBufferUsageFlags flags);
+
+        void endCommandBuffer(VkCommandBuffer commandBuffer);
+
+        void submit(const std::vector<VkCommandBuffer>& commandBuffers);
+
+        Expected<void> trySubmit(const std::vector<VkCommandBuffer>& commandBuffers);
+
+        VkInstance m_vkInstance;
+        const Configuration* m_pConfiguration;
+        VkPhysicalDevice m_vkPhysicalDevice;
+        VkPhysicalDeviceProperties m_vkPhysicalDeviceProperties;
+        VkPhysicalDeviceMemoryProperties m_vkPhysicalDeviceMemoryProperties;
+        uint32_t m_computeQueueFamilyIndex;
+        uint32_t m_computeQueueFamilyQueueCount;
+        uint32_t m_computeQueueFamilyTimestampValidBits;
+        VkDevice m_vkDevice;
+        std::vector<VkQueue> m_vkComputeQueues;
+        VkCommandPool m_vkCommandPool;
+        std::vector<VkFence> m_vkFences;
+        ShaderLoader* m_pShaderLoader;
+        DescriptorAllocator* m_pDescriptorAllocator;
+        bool m_isPushDescriptorSupported;
+        bool m_isPushDescriptorEnabled;
+        uint32_t m_descriptorSetsPerPool;
+        PFN_vkVoidFunction m_vkCmdPushDescriptorSet;
+        uint64_t m_pushedDescriptorSetCount;
+        Logger* m_pLogger;
+        Metrics* m_pMetrics;
+        Instruments m_instruments;
+        uint64_t m_countedDescriptorSetCount;
+        Profiler* m_pProfiler;
+        std::atomic<bool> m_isProfilingEnabled;
+        TraceWriter* m_pTraceWriter;
+        InformationProvider* m_pInformationProvider;
+        Verifier* m_pVerifier;
+        VkPhysicalDeviceFeatures m_vkEnabledFeatures;
+        PFN_vkVoidFunction m_vkGetCalibratedTimestamps;
+        //trace time in microseconds is device time in microseconds plus offset
+        double m_deviceClockOffset;
+        double m_lastWaitEnd;
+        std::map<LayoutKey, Layout> m_layouts;
+        std::map<std::pair<VkShaderModule, bool>, const Layout*> m_shaderLayouts;
+        std::map<PipelineKey, VkPipeline> m_pipelines;
+        TuningDatabase::KernelParameters m_kernelParameters;
+    };
+}
+
+#endif //VULKALC_LIBRARY_RUNNER_H
@@ -0,0 +1,187 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Shader.hpp
+ * \brief Contains Shader and ShaderLoader classes declarations
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_SHADER_H
+#define VULKALC_LIBRARY_SHADER_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "ShaderCompiler.hpp"
+#include "ShaderReflection.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <string>
+#include <vector>
+#include <map>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Shader
+     * \brief Compute shader, loaded to device
+     *
+     * Shader owns VkShaderModule, created from SPIR-V code, and reflection of its entry point.
+     */
+    class VULKALC_API Shader
+    {
+    public:
+        /*!
+         * \brief Shader constructor
+         * \param device device to create VkShaderModule on
+         * \param code SPIR-V code
+         * \param entryPoint name of entry point function
+         * \param name name of shader used in profiling results and logs
+         * \throws ShaderLoadingException - thrown if code is empty or is not valid SPIR-V
+         * \throws VulkanException - thrown if failed to create VkShaderModule
+         */
+        Shader(VkDevice device, const std::vector<uint32_t>& code, const char* entryPoint = "main",
+               const char* name = "kernel");
+
+        /*!
+         * \brief Shader destructor
+         */
+        ~Shader();
+
+        /*!
+         * \brief Returns VkShaderModule handle
+         * \return VkShaderModule
+         */
+        VkShaderModule getVkShaderModule() const { return m_vkShaderModule; }
+
+        /*!
+         * \brief Returns name of entry point function
+         * \return name of entry point
+         */
+        const char* getEntryPoint() const { return m_entryPoint.c_str(); }
+
+        /*!
+         * \brief Returns name of shader
+         * \return name of SPIR-V file without extension or name given to ShaderLoader::compile()
+         */
+        const char* getName() const { return m_name.c_str(); }
+
+        /*!
+         * \brief Returns resources and requirements of entry point, parsed from SPIR-V code
+         * \return ShaderReflection
+         */
+        const ShaderReflection& getReflection() const { return m_reflection; }
+
+    private:
+        Shader(const Shader&);
+
+        void operator=(const Shader&);
+
+        VkDevice m_vkDevice;
+        VkShaderModule m_vkShaderModule;
+        std::string m_entryPoint;
+        std::string m_name;
+        ShaderReflection m_reflection;
+    };
+
+    /*!
+     * \class ShaderLoader
+     * \brief Loads shaders from SPIR-V files and compiles them from GLSL source
+     *
+     * ShaderLoader owns all loaded shaders and caches them by path or by source, so every file is read
+     * and every source is compiled only once.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API ShaderLoader
+    {
+    public:
+        /*!
+         * \brief ShaderLoader constructor
+         * \param device device to load shaders to
+         * \param shadersDirectory directory with built-in shaders
+         * \param cacheDirectory directory to cache shaders compiled from source in, nullptr to disable disk cache
+         */
+        ShaderLoader(VkDevice device, const char* shadersDirectory, const char* cacheDirectory = nullptr);
+
+        /*!
+         * \brief ShaderLoader destructor. Destroys all loaded shaders
+         */
+        ~ShaderLoader();
+
+        /*!
+         * \brief Loads shader from SPIR-V file
+         * \param path path to SPIR-V file
+         * \return pointer to loaded Shader, owned by ShaderLoader
+         * \throws ShaderLoadingException - thrown if failed to read file
+         * \throws VulkanException - thrown if failed to create VkShaderModule
+         */
+        Shader* load(const char* path);
+
+        /*!
+         * \brief Loads built-in shader by name
+         * \param name name of built-in shader
+         * \return pointer to loaded Shader, owned by ShaderLoader
+         * \throws ShaderLoadingException - thrown if failed to read file
+         * \throws VulkanException - thrown if failed to create VkShaderModule
+         */
+        Shader* loadBuiltin(const char* name);
+
+        /*!
+         * \brief Compiles shader from GLSL compute source
+         * \param source GLSL source of compute shader
+         * \param defines preprocessor definitions in form "NAME" or "NAME=VALUE"
+         * \param name name of shader used in error messages
+         * \return pointer to compiled Shader, owned by ShaderLoader
+         * \throws ShaderCompilationException - thrown if compilation failed or runtime compilation is disabled
+         * \throws VulkanException - thrown if failed to create VkShaderModule
+         * \see ShaderCompiler
+         */
+        Shader* compile(const std::string& source, const std::vector<std::string>& defines = std::vector<std::string>(),
+                        const char* name = "kernel");
+
+        /*!
+         * \brief Returns ShaderCompiler used by compile()
+         * \return reference to ShaderCompiler
+         */
+        const ShaderCompiler& getCompiler() const { return m_compiler; }
+
+    private:
+        ShaderLoader(const ShaderLoader&);
+
+        void operator=(const ShaderLoader&);
+
+        VkDevice m_vkDevice;
+        std::string m_shadersDirectory;
+        ShaderCompiler m_compiler;
+        std::map<std::string, Shader*> m_shaders;
+    };
+}
+
+#endif //VULKALC_LIBRARY_SHADER_H
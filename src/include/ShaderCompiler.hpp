@@ -0,0 +1,150 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ShaderCompiler.hpp
+ * \brief Contains ShaderCompiler class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_SHADERCOMPILER_H
+#define VULKALC_LIBRARY_SHADERCOMPILER_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class ShaderCompiler
+     * \brief Compiles GLSL compute shaders to SPIR-V at runtime
+     *
+     * Compiled SPIR-V is cached on disk in a file named by hash of source, defines, compile options and version
+     * of Vulkan SDK, which provides shaderc, so shader is compiled again only when one of them changes.
+     * Cached code is followed by its word count, so truncated files are compiled again.
+     * Compilation itself is available only if Vulkalc is built with VULKALC_RUNTIME_COMPILER option,
+     * which links shaderc from Vulkan SDK. Without it only previously cached shaders can be loaded.
+     * \warning This class is not thread-safe.
+     */
+    class VULKALC_API ShaderCompiler
+    {
+    public:
+        /*!
+         * \brief Counters of compilation requests
+         */
+        struct Statistics
+        {
+            /*!
+             * \brief Number of compile() calls
+             */
+            uint64_t requestCount;
+            /*!
+             * \brief Number of requests served from disk cache
+             */
+            uint64_t cacheHitCount;
+            /*!
+             * \brief Number of shaders actually compiled
+             */
+            uint64_t compileCount;
+            /*!
+             * \brief Total time spent in compilation, in milliseconds
+             */
+            double compileMilliseconds;
+            /*!
+             * \brief Total time spent in reading disk cache, in milliseconds
+             */
+            double cacheMilliseconds;
+        };
+
+        /*!
+         * \brief ShaderCompiler constructor
+         * \param cacheDirectory existing directory to keep compiled shaders in, nullptr to disable disk cache
+         */
+        explicit ShaderCompiler(const char* cacheDirectory);
+
+        /*!
+         * \brief Returns SPIR-V code of GLSL compute shader, compiling it if it is not cached
+         * \param source GLSL source of compute shader
+         * \param defines preprocessor definitions in form "NAME" or "NAME=VALUE"
+         * \param name name of shader used in error messages
+         * \return SPIR-V code
+         * \throws ShaderCompilationException - thrown if compilation failed or runtime compilation is disabled
+         */
+        std::vector<uint32_t> compile(const std::string& source, const std::vector<std::string>& defines,
+                                      const char* name = "kernel");
+
+        /*!
+         * \brief Returns cache key of shader, which is also name of its file in cache directory
+         * \param source GLSL source of compute shader
+         * \param defines preprocessor definitions
+         * \return hexadecimal hash of source, defines, compile options and Vulkan SDK headers version
+         */
+        static std::string getCacheKey(const std::string& source, const std::vector<std::string>& defines);
+
+        /*!
+         * \brief Returns true, if Vulkalc was built with runtime compiler
+         * \return true, if compile() can compile shaders, which are not cached
+         */
+        static bool isCompilationSupported();
+
+        /*!
+         * \brief Returns counters of compilation requests
+         * \return Statistics
+         */
+        const Statistics& getStatistics() const { return m_statistics; }
+
+        /*!
+         * \brief Returns path to cache directory
+         * \return path to cache directory, empty if disk cache is disabled
+         */
+        const std::string& getCacheDirectory() const { return m_cacheDirectory; }
+
+    private:
+        ShaderCompiler(const ShaderCompiler&);
+
+        void operator=(const ShaderCompiler&);
+
+        bool readCache(const std::string& path, std::vector<uint32_t>& code) const;
+
+        void writeCache(const std::string& path, const std::vector<uint32_t>& code) const;
+
+        std::vector<uint32_t> compileSource(const std::string& source, const std::vector<std::string>& defines,
+                                            const char* name) const;
+
+        std::string m_cacheDirectory;
+        Statistics m_statistics;
+    };
+}
+
+#endif //VULKALC_LIBRARY_SHADERCOMPILER_H
@@ -0,0 +1,206 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file ShaderReflection.hpp
+ * \brief Contains ShaderReflection class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_SHADERREFLECTION_H
+#define VULKALC_LIBRARY_SHADERREFLECTION_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <vulkan/vulkan.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class ShaderReflection
+     * \brief Resources and requirements of compute entry point, parsed from SPIR-V module
+     *
+     * Only instructions, which describe interface of kernel, are parsed: entry points, execution modes,
+     * capabilities, types, constants, decorations and global variables. Bodies of functions are skipped.
+     */
+    class VULKALC_API ShaderReflection
+    {
+    public:
+        /*!
+         * \brief Specialization constant ID of dimension of workgroup, which is not specialized
+         */
+        static const uint32_t NO_SPECIALIZATION = 0xFFFFFFFF;
+
+        /*!
+         * \brief Kinds of descriptors
+         */
+        enum BINDING_TYPE
+        {
+            BINDING_STORAGE_BUFFER,
+            BINDING_UNIFORM_BUFFER,
+            BINDING_OTHER
+        };
+
+        /*!
+         * \brief Descriptor used by shader
+         */
+        struct Binding
+        {
+            /*!
+             * \brief Index of descriptor set
+             */
+            uint32_t set;
+            /*!
+             * \brief Binding number in descriptor set
+             */
+            uint32_t binding;
+            /*!
+             * \brief Kind of descriptor
+             */
+            BINDING_TYPE type;
+            /*!
+             * \brief Number of descriptors in array, 1 for single descriptor, 0 for runtime array
+             */
+            uint32_t count;
+            /*!
+             * \brief Name of variable or, for anonymous block instance, name of block
+             * \note Names are absent, if module was compiled without debug information.
+             */
+            std::string name;
+        };
+
+        /*!
+         * \brief Constructs reflection of module without entry point
+         */
+        ShaderReflection();
+
+        /*!
+         * \brief Parses SPIR-V module
+         * \param code SPIR-V code
+         * \param entryPoint name of entry point to reflect
+         * \throws ShaderLoadingException - thrown if code is not valid SPIR-V
+         */
+        explicit ShaderReflection(const std::vector<uint32_t>& code, const char* entryPoint = "main");
+
+        /*!
+         * \brief Checks if module has entry point with given name
+         * \return true, if entry point is found
+         */
+        bool hasEntryPoint() const { return m_hasEntryPoint; }
+
+        /*!
+         * \brief Checks if entry point is compute shader
+         * \return true, if execution model of entry point is GLCompute
+         */
+        bool isCompute() const { return m_isCompute; }
+
+        /*!
+         * \brief Returns size of workgroup in dimension
+         * \param dimension index of dimension, 0 to 2
+         * \param specializationConstants values of specialization constants by IDs
+         * \return specialized size or default one
+         */
+        uint32_t getLocalSize(uint32_t dimension,
+                              const std::map<uint32_t, uint32_t>& specializationConstants) const;
+
+        /*!
+         * \brief Returns ID of specialization constant, which sets size of workgroup in dimension
+         * \param dimension index of dimension, 0 to 2
+         * \return ID or NO_SPECIALIZATION
+         */
+        uint32_t getLocalSizeSpecializationId(uint32_t dimension) const { return m_localSizeIds[dimension]; }
+
+        /*!
+         * \brief Returns size of workgroup shared variables
+         * \note Shared memory has no explicit layout, so size is sum of sizes of variables with scalar alignment.
+         * Only lengths of outer arrays of variables are specialized, arrays nested in structs have default lengths.
+         * \param specializationConstants values of specialization constants by IDs
+         * \return specialized size in bytes
+         */
+        uint64_t getSharedMemorySize(const std::map<uint32_t, uint32_t>& specializationConstants) const;
+
+        /*!
+         * \brief Returns descriptors used by module
+         * \return descriptors sorted by set and binding
+         */
+        const std::vector<Binding>& getBindings() const { return m_bindings; }
+
+        /*!
+         * \brief Finds descriptor by name
+         * \param name name of variable or block
+         * \return descriptor or nullptr, if module has no descriptor with such name
+         */
+        const Binding* findBinding(const char* name) const;
+
+        /*!
+         * \brief Returns size of push constants block
+         * \return size in bytes, 0 if shader has no push constants
+         */
+        uint32_t getPushConstantsSize() const { return m_pushConstantsSize; }
+
+        /*!
+         * \brief Returns specialization constants declared by module
+         * \note Boolean constants have default values 0 and 1.
+         * \return default values of scalar specialization constants by IDs
+         */
+        const std::map<uint32_t, uint32_t>& getSpecializationConstants() const { return m_specializationConstants; }
+
+        /*!
+         * \brief Returns capabilities declared by module
+         * \return SPIR-V capabilities
+         */
+        const std::vector<uint32_t>& getCapabilities() const { return m_capabilities; }
+
+    private:
+        //size of shared variable is size of element multiplied by lengths of its arrays
+        struct SharedVariable
+        {
+            uint32_t elementSize;
+            //default lengths of arrays and IDs of specialization constants, which set them, or NO_SPECIALIZATION
+            std::vector<std::pair<uint32_t, uint32_t>> lengths;
+        };
+
+        bool m_hasEntryPoint;
+        bool m_isCompute;
+        uint32_t m_localSize[3];
+        uint32_t m_localSizeIds[3];
+        std::vector<SharedVariable> m_sharedVariables;
+        std::vector<Binding> m_bindings;
+        uint32_t m_pushConstantsSize;
+        std::map<uint32_t, uint32_t> m_specializationConstants;
+        std::vector<uint32_t> m_capabilities;
+    };
+}
+
+#endif //VULKALC_LIBRARY_SHADERREFLECTION_H
@@ -0,0 +1,231 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Task.hpp
+ * \brief Contains Task class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * This file contains Task class, which describes single unit of work for Runner
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_TASK_H
+#define VULKALC_LIBRARY_TASK_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+#include "Buffer.hpp"
+#include "Shader.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <map>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class Task
+     * \brief Describes single unit of work for Runner
+     *
+     * Task is either a compute shader dispatch, filling of buffer with value or copying of buffer.
+     * Buffers bound to dispatch are available in shader as storage buffers in descriptor set 0 with bindings
+     * in the order they were bound, or with bindings of variables they were bound to by name.
+     */
+    class VULKALC_API Task
+    {
+    public:
+        /*!
+         * \brief Maximum size of push constants in bytes, guaranteed by Vulkan
+         */
+        static const uint32_t MAX_PUSH_CONSTANTS_SIZE = 128;
+
+        /*!
+         * \brief Enumeration for task types
+         */
+        enum TYPE { TYPE_DISPATCH, TYPE_FILL, TYPE_COPY };
+
+        /*!
+         * \brief Enumeration for kinds of access to bound buffer
+         */
+        enum ACCESS { ACCESS_READ = 1, ACCESS_WRITE = 2, ACCESS_READ_WRITE = ACCESS_READ | ACCESS_WRITE };
+
+        /*!
+         * \brief Constructs dispatch Task
+         * \param shader shader to dispatch
+         * \param groupCountX number of workgroups in X dimension
+         * \param groupCountY number of workgroups in Y dimension
+         * \param groupCountZ number of workgroups in Z dimension
+         * \throws InvalidArgumentException - thrown if shader is nullptr
+         */
+        Task(Shader* shader, uint32_t groupCountX, uint32_t groupCountY = 1, uint32_t groupCountZ = 1);
+
+        /*!
+         * \brief Constructs Task, which fills whole buffer with value
+         * \param buffer buffer to fill
+         * \param value 4-byte word to fill buffer with
+         * \return fill Task
+         */
+        static Task fill(const BufferBase& buffer, uint32_t value);
+
+        /*!
+         * \brief Constructs Task, which copies data from one buffer to another
+         * \param source buffer to copy from
+         * \param destination buffer to copy to
+         * \return copy Task
+         * \throws InvalidArgumentException - thrown if source is bigger than destination
+         */
+        static Task copy(const BufferBase& source, const BufferBase& destination);
+
+        /*!
+         * \brief Binds buffer to next binding of dispatch
+         *
+         * Declared access lets ComputeGraph synchronize only Tasks, which really depend on each other.
+         * \param buffer buffer to bind
+         * \param access how shader accesses buffer
+         * \return reference to this Task
+         */
+        Task& bind(const BufferBase& buffer, ACCESS access = ACCESS_READ_WRITE);
+
+        /*!
+         * \brief Binds buffer to storage buffer of dispatched shader with given name
+         *
+         * Binding number is taken from ShaderReflection, so shader may declare bindings in any order.
+         * Bindings, which are skipped, stay unbound until buffers are bound to them.
+         * \param name name of buffer variable or block in shader
+         * \param buffer buffer to bind
+         * \param access how shader accesses buffer
+         * \return reference to this Task
+         * \throws InvalidArgumentException - thrown if Task is not a dispatch or shader has no storage buffer
+         * with such name in descriptor set 0
+         */
+        Task& bind(const char* name, const BufferBase& buffer, ACCESS access = ACCESS_READ_WRITE);
+
+        /*!
+         * \brief Sets push constants of dispatch
+         * \param data pointer to push constants
+         * \param size size of push constants in bytes
+         * \return reference to this Task
+         * \throws InvalidArgumentException - thrown if size exceeds MAX_PUSH_CONSTANTS_SIZE or is not multiple of 4
+         */
+        Task& setPushConstants(const void* data, uint32_t size);
+
+        /*!
+         * \brief Sets push constants of dispatch from structure
+         * \param pushConstants structure with push constants
+         * \return reference to this Task
+         */
+        template<typename P>
+        Task& setPushConstants(const P& pushConstants)
+        {
+            return setPushConstants(&pushConstants, static_cast<uint32_t>(sizeof(P)));
+        }
+
+        /*!
+         * \brief Sets value of specialization constant of dispatched shader
+         * \param constantId id of specialization constant
+         * \param value 4-byte value of constant
+         * \return reference to this Task
+         */
+        Task& setSpecializationConstant(uint32_t constantId, uint32_t value);
+
+        /*!
+         * \brief Returns type of task
+         * \return type of task
+         */
+        TYPE getType() const { return m_type; }
+
+        /*!
+         * \brief Returns dispatched shader
+         * \return shader or nullptr if task is not a dispatch
+         */
+        Shader* getShader() const { return m_pShader; }
+
+        /*!
+         * \brief Returns number of workgroups in dimension
+         * \param dimension index of dimension from 0 to 2
+         * \return number of workgroups
+         */
+        uint32_t getGroupCount(uint32_t dimension) const { return m_groupCount[dimension]; }
+
+        /*!
+         * \brief Returns bound buffers
+         *
+         * For fill task it contains filled buffer, for copy task it contains source and destination buffers.
+         * For dispatch buffers are indexed by binding, bindings skipped by binding by name are nullptr.
+         * \return vector of buffers
+         */
+        const std::vector<const BufferBase*>& getBuffers() const { return m_buffers; }
+
+        /*!
+         * \brief Returns kinds of access to bound buffers in the same order as getBuffers()
+         * \return vector of accesses
+         */
+        const std::vector<ACCESS>& getAccesses() const { return m_accesses; }
+
+        /*!
+         * \brief Returns pointer to push constants
+         * \return pointer to push constants
+         */
+        const void* getPushConstants() const { return m_pushConstants; }
+
+        /*!
+         * \brief Returns size of push constants
+         * \return size of push constants in bytes
+         */
+        uint32_t getPushConstantsSize() const { return m_pushConstantsSize; }
+
+        /*!
+         * \brief Returns specialization constants values by their ids
+         * \return map of specialization constants
+         */
+        const std::map<uint32_t, uint32_t>& getSpecializationConstants() const { return m_specializationConstants; }
+
+        /*!
+         * \brief Returns value to fill buffer with
+         * \return fill value
+         */
+        uint32_t getFillValue() const { return m_fillValue; }
+
+    private:
+        explicit Task(TYPE type);
+
+        TYPE m_type;
+        Shader* m_pShader;
+        uint32_t m_groupCount[3];
+        std::vector<const BufferBase*> m_buffers;
+        std::vector<ACCESS> m_accesses;
+        uint8_t m_pushConstants[MAX_PUSH_CONSTANTS_SIZE];
+        uint32_t m_pushConstantsSize;
+        std::map<uint32_t, uint32_t> m_specializationConstants;
+        uint32_t m_fillValue;
+    };
+}
+
+#endif //VULKALC_LIBRARY_TASK_H
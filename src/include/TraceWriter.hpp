@@ -0,0 +1,165 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file TraceWriter.hpp
+ * \brief Contains TraceWriter class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_TRACE_WRITER_H
+#define VULKALC_LIBRARY_TRACE_WRITER_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class TraceWriter
+     * \brief Writes spans to file in Chrome trace event format, which can be opened in chrome://tracing or Perfetto
+     *
+     * Spans are buffered in memory and written to file by background thread. Every span belongs to track,
+     * which is shown as separate thread of timeline. Timestamps are microseconds of steady_clock since creation
+     * of TraceWriter.
+     * \note addSpan() may be called from any number of threads.
+     */
+    class VULKALC_API TraceWriter
+    {
+    public:
+        /*!
+         * \brief Number of buffered spans, which wakes background thread before its regular interval
+         */
+        static const size_t FLUSH_THRESHOLD = 4096;
+
+        /*!
+         * \brief TraceWriter constructor. Creates file and starts background thread
+         * \param path path to trace file
+         * \throws InvalidArgumentException - thrown if failed to create file
+         */
+        explicit TraceWriter(const char* path);
+
+        /*!
+         * \brief TraceWriter destructor. Writes all buffered spans and closes file
+         */
+        ~TraceWriter();
+
+        /*!
+         * \brief Returns current time of trace
+         * \return microseconds since creation of TraceWriter
+         */
+        double now() const
+        {
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_startTime).count();
+        }
+
+        /*!
+         * \brief Returns time of trace, which corresponds to time_since_epoch() of steady_clock
+         * \param nanoseconds nanoseconds since epoch of steady_clock
+         * \return microseconds since creation of TraceWriter
+         */
+        double fromSteadyClock(int64_t nanoseconds) const;
+
+        /*!
+         * \brief Names track
+         * \param track index of track
+         * \param name name of track
+         */
+        void setTrackName(uint32_t track, const char* name);
+
+        /*!
+         * \brief Buffers span
+         * \param name name of span, which is copied
+         * \param category category of span, must be string literal
+         * \param beginMicroseconds time of beginning
+         * \param endMicroseconds time of end
+         * \param track index of track
+         */
+        void addSpan(const char* name, const char* category, double beginMicroseconds, double endMicroseconds,
+                     uint32_t track);
+
+        /*!
+         * \brief Waits until all buffered spans are written to file
+         */
+        void flush();
+
+        /*!
+         * \brief Returns number of spans written to file
+         * \return number of written spans
+         */
+        uint64_t getWrittenCount() const;
+
+    private:
+        TraceWriter(const TraceWriter&);
+
+        void operator=(const TraceWriter&);
+
+        struct Event
+        {
+            //names of user shaders may be freed before background thread writes them
+            std::string name;
+            const char* category;
+            double timestamp;
+            double duration;
+            uint32_t track;
+        };
+
+        void push(Event event);
+
+        void write(const std::vector<Event>& events);
+
+        void run();
+
+        std::ofstream m_file;
+        std::chrono::steady_clock::time_point m_startTime;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wakeCondition;
+        std::condition_variable m_writtenCondition;
+        std::vector<Event> m_pendingEvents;
+        std::map<uint32_t, std::string> m_trackNames;
+        uint64_t m_pushedCount;
+        uint64_t m_writtenCount;
+        bool m_isStopping;
+        bool m_isFirstEvent;
+        std::thread m_thread;
+    };
+}
+
+#endif //VULKALC_LIBRARY_TRACE_WRITER_H
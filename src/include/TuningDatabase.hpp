@@ -0,0 +1,119 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file TuningDatabase.hpp
+ * \brief Contains TuningDatabase class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_LIBRARY_TUNINGDATABASE_H
+#define VULKALC_LIBRARY_TUNINGDATABASE_H
+
+#include "Export.hpp"
+#include "Exceptions.h"
+
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/*!
+ * \copydoc Vulkalc
+ */
+namespace Vulkalc
+{
+    /*!
+     * \class TuningDatabase
+     * \brief Parameters of built-in kernels, which are tuned for every device and driver
+     *
+     * Database is a text file with one parameter per line: device key, kernel name, parameter name and value,
+     * separated by spaces. Lines starting with # are comments. Database is written by autotune command
+     * of vulkalc-tools and loaded by Runner from Configuration::tuningFile.
+     *
+     * Known parameters of built-in kernels are workgroupSize and itemsPerInvocation.
+     */
+    class VULKALC_API TuningDatabase
+    {
+    public:
+        /*!
+         * \brief Values of parameters by kernel name and parameter name
+         */
+        typedef std::map<std::string, std::map<std::string, uint32_t>> KernelParameters;
+
+        /*!
+         * \brief TuningDatabase constructor, creates empty database
+         */
+        TuningDatabase() {}
+
+        /*!
+         * \brief Returns key of device in database
+         *
+         * Key consists of pipeline cache UUID and driver version, so parameters are tuned again after driver
+         * update. Pipeline cache UUID identifies device and driver build, VkPhysicalDeviceIDProperties are not
+         * available in Vulkan 1.0.
+         * \param properties properties of physical device
+         * \return key of device
+         */
+        static std::string getDeviceKey(const VkPhysicalDeviceProperties& properties);
+
+        /*!
+         * \brief Adds parameters from file, replacing already loaded ones
+         * \param path path to file
+         * \return false, if file doesn't exist
+         * \throws InvalidArgumentException - thrown if file is malformed
+         */
+        bool load(const char* path);
+
+        /*!
+         * \brief Writes all parameters to file, replacing it
+         * \param path path to file
+         * \throws InvalidArgumentException - thrown if failed to write file
+         */
+        void save(const char* path) const;
+
+        /*!
+         * \brief Returns parameters of device
+         * \param deviceKey key of device
+         * \return parameters of kernels, empty if device is not tuned
+         */
+        KernelParameters getKernelParameters(const std::string& deviceKey) const;
+
+        /*!
+         * \brief Replaces all parameters of device
+         * \param deviceKey key of device
+         * \param parameters parameters of kernels, values must be greater than 0
+         * \throws InvalidArgumentException - thrown if names contain whitespace or value is 0
+         */
+        void setKernelParameters(const std::string& deviceKey, const KernelParameters& parameters);
+
+    private:
+        std::map<std::string, KernelParameters> m_devices;
+    };
+}
+
+#endif //VULKALC_LIBRARY_TUNINGDATABASE_H
@@ -34,10 +34,11 @@
 
 #include "Export.hpp"
 #include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
 #include <time.h>
 
-using namespace std;
-
 /*!
  * \copydoc Vulkalc
  */
@@ -47,10 +48,10 @@ namespace Vulkalc
      * Returns string representation of current date and time
      * \return current date and time as C string.
      */
-    VULKALC_API const char* getCurrentTimeString()
+    inline const char* getCurrentTimeString()
     {
-        auto now = chrono::system_clock::now();
-        auto now_time_t = chrono::system_clock::to_time_t(now);
+        auto now = std::chrono::system_clock::now();
+        auto now_time_t = std::chrono::system_clock::to_time_t(now);
 #ifdef _MSC_VER
         char time[26];
         ctime_s(time, sizeof(time), &now_time_t);
@@ -59,6 +60,23 @@ namespace Vulkalc
         return ctime(&now_time_t);
 #endif
     }
+
+    /*!
+     * Escapes quotes, backslashes and control characters of text for JSON string
+     * \param text text to escape
+     * \return escaped text without surrounding quotes
+     */
+    VULKALC_API std::string escapeJson(const std::string& text);
+
+    /*!
+     * Replaces file at once with content written to temporary file, so other processes never read partially
+     * written file. Temporary file name is unique per process and call, so concurrent writers don't mix content.
+     * \param path path to file
+     * \param isBinary true to write file in binary mode
+     * \param write writes content to stream, failures are detected by state of stream
+     * \return false, if failed to write or replace file, file is left unchanged then
+     */
+    VULKALC_API bool replaceFile(const char* path, bool isBinary, const std::function<void(std::ostream&)>& write);
 }
 
 #endif //VULKALC_LIBRARY_UTILITIES_H
@@ -32,11 +32,19 @@
  *
  */
 
+#pragma once
+
 #ifndef VULKALC_LIBRARY_VERIFIER_H
 #define VULKALC_LIBRARY_VERIFIER_H
 
 #include "RAII.hpp"
 #include "Export.hpp"
+#include "ShaderReflection.hpp"
+#include "Task.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <string>
+#include <vector>
 
 /*!
  * \copydoc Vulkalc
@@ -45,16 +53,109 @@ namespace Vulkalc
 {
     /*!
      * \class Verifier
-     * \brief Provides interface for specific verifiers
+     * \brief Checks compute shaders against limits and enabled features of device
      * \extends RAII
      *
-     * \note Verifier class uses RAII pattern. Call \code init() before usage and \code release() after usage
+     * Shaders are checked by their ShaderReflection, so kernels, which would fail or be undefined on device,
+     * are rejected with diagnostics before vkCreateComputePipelines is called.
+     * \note Verifier class uses RAII pattern. It's initialized on construction and released on destruction.
      *
      * \warning This class is not thread-safe.
      */
-    class VULKALC_API Verifier : public RAII
+    class VULKALC_API Verifier final : public RAII
     {
+    public:
+        /*!
+         * \brief Kinds of problems found by Verifier
+         */
+        enum DIAGNOSTIC_CODE
+        {
+            DIAGNOSTIC_MISSING_ENTRY_POINT,
+            DIAGNOSTIC_NOT_COMPUTE,
+            DIAGNOSTIC_WORKGROUP_SIZE,
+            DIAGNOSTIC_WORKGROUP_INVOCATIONS,
+            DIAGNOSTIC_SHARED_MEMORY,
+            DIAGNOSTIC_DESCRIPTOR_SET,
+            DIAGNOSTIC_STORAGE_BUFFERS,
+            DIAGNOSTIC_UNIFORM_BUFFERS,
+            DIAGNOSTIC_PUSH_CONSTANTS,
+            DIAGNOSTIC_CAPABILITY,
+            DIAGNOSTIC_GROUP_COUNT,
+            DIAGNOSTIC_UNBOUND_BINDING
+        };
+
+        /*!
+         * \brief Problem found in shader or Task
+         */
+        struct Diagnostic
+        {
+            /*!
+             * \brief Kind of problem
+             */
+            DIAGNOSTIC_CODE code;
+            /*!
+             * \brief Human-readable description
+             */
+            std::string message;
+            /*!
+             * \brief Value required by shader, e.g. size of shared memory
+             */
+            uint64_t value;
+            /*!
+             * \brief Limit of device, which value exceeds
+             */
+            uint64_t limit;
+        };
+
+        /*!
+         * \brief Verifier constructor
+         * \param limits limits of device
+         * \param enabledFeatures features enabled on VkDevice
+         */
+        Verifier(const VkPhysicalDeviceLimits& limits, const VkPhysicalDeviceFeatures& enabledFeatures);
+
+        /*!
+         * \brief Verifier destructor
+         */
+        ~Verifier();
+
+        /*!
+         * \brief Checks shader against limits and features of device
+         * \param reflection reflection of shader
+         * \param specializationConstants values of specialization constants by IDs
+         * \return diagnostics, empty if shader can be run on device
+         */
+        std::vector<Diagnostic> verify(const ShaderReflection& reflection,
+                                       const std::map<uint32_t, uint32_t>& specializationConstants) const;
+
+        /*!
+         * \brief Checks dispatch Task: its shader, number of workgroups and bound buffers
+         *
+         * Runner binds buffers of Task to bindings of descriptor set 0 in order, so every binding of shader
+         * must be a storage buffer in set 0 with a bound buffer.
+         * \param task Task to check. Fill and copy Tasks are always valid
+         * \return diagnostics, empty if Task can be run on device
+         */
+        std::vector<Diagnostic> verify(const Task& task) const;
+
+        /*!
+         * \brief Joins diagnostics into one message
+         * \param diagnostics diagnostics to describe
+         * \return messages separated by "; "
+         */
+        static std::string describe(const std::vector<Diagnostic>& diagnostics);
+
+    private:
+        Verifier(const Verifier&);
+
+        void operator=(const Verifier&);
+
+        virtual void init() override;
+
+        virtual void release() override;
 
+        VkPhysicalDeviceLimits m_vkLimits;
+        VkPhysicalDeviceFeatures m_vkEnabledFeatures;
     };
 }
 
@@ -31,23 +31,75 @@
  *  Provides VulkanInfo class which contains information about Vulkan runtime and installation
  */
 
+#pragma once
+
 #ifndef VULKALC_LIBRARY_VULKANINFO_H
 #define VULKALC_LIBRARY_VULKANINFO_H
 
 #include "Export.hpp"
 
+#include <vulkan/vulkan.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 /*!
  * \copydoc Vulkalc
  */
 namespace Vulkalc
 {
+    /*!
+     * \class VulkanInfo
+     * \brief Snapshot of instance layers, instance extensions and physical device capabilities
+     *
+     * Every category is queried once, on first request, and is cached for lifetime of the object.
+     * Snapshot can be saved to file and loaded by next process, so it skips enumeration. Saved snapshot is keyed
+     * by Vulkan headers version and loader environment variables, and every device in it is keyed by
+     * its vendor, device, driver version and pipeline cache UUID, so updated drivers are queried again.
+     * \note Methods are thread-safe. Returned references stay valid for lifetime of the object.
+     */
     class VULKALC_API VulkanInfo
     {
     public:
+        /*!
+         * \brief Capabilities of one physical device
+         */
+        struct PhysicalDeviceInfo
+        {
+            /*!
+             * \brief Properties and limits of device
+             */
+            VkPhysicalDeviceProperties properties;
+            /*!
+             * \brief Features supported by device
+             */
+            VkPhysicalDeviceFeatures features;
+            /*!
+             * \brief Memory heaps and types of device
+             */
+            VkPhysicalDeviceMemoryProperties memoryProperties;
+            /*!
+             * \brief Properties of queue families of device
+             */
+            std::vector<VkQueueFamilyProperties> queueFamilies;
+            /*!
+             * \brief Extensions supported by device
+             */
+            std::vector<VkExtensionProperties> extensions;
+
+            /*!
+             * \brief Checks if device supports extension
+             * \param extensionName name of extension
+             * \return true, if extension is supported
+             */
+            bool isExtensionSupported(const char* extensionName) const;
+        };
+
         /*!
          * \brief Constructor for VulkanInfo
          *
-         * Constructs a VulkanInfo object and fetches information about Vulkan
+         * Constructs an empty VulkanInfo object, information about Vulkan is fetched on first request
          */
         VulkanInfo();
 
@@ -58,8 +110,85 @@ namespace Vulkalc
          */
         ~VulkanInfo();
 
+        /*!
+         * \brief Returns snapshot shared by the whole process
+         * \return pointer to VulkanInfo
+         */
+        static VulkanInfo* const getInstance();
+
+        /*!
+         * \brief Returns extensions supported by Vulkan instance
+         * \return properties of extensions
+         */
+        const std::vector<VkExtensionProperties>& getInstanceExtensions();
+
+        /*!
+         * \brief Returns available instance layers
+         * \return properties of layers
+         */
+        const std::vector<VkLayerProperties>& getLayers();
+
+        /*!
+         * \brief Checks if Vulkan instance supports extension
+         * \param extensionName name of extension
+         * \return true, if extension is supported
+         */
+        bool isInstanceExtensionSupported(const char* extensionName);
+
+        /*!
+         * \brief Checks if instance layer is available
+         * \param layerName name of layer
+         * \return true, if layer is available
+         */
+        bool isLayerSupported(const char* layerName);
+
+        /*!
+         * \brief Returns capabilities of physical device
+         *
+         * Properties of device are queried on every call to match it with cached capabilities.
+         * \param physicalDevice device to return capabilities of
+         * \return capabilities of device
+         */
+        const PhysicalDeviceInfo& getPhysicalDeviceInfo(VkPhysicalDevice physicalDevice);
+
+        /*!
+         * \brief Loads snapshot, saved by previous process. Categories, which are already queried, are kept.
+         * \param path path to file
+         * \return false, if file doesn't exist, is malformed or was saved with other headers or loader environment
+         */
+        bool load(const char* path);
+
+        /*!
+         * \brief Saves snapshot to file, querying instance categories, if they aren't queried yet
+         * \param path path to file. File is replaced atomically
+         * \return false, if failed to write file
+         */
+        bool save(const char* path);
+
+        /*!
+         * \brief Checks if snapshot has information, which wasn't loaded from file or saved yet
+         * \return true, if snapshot should be saved
+         */
+        bool isModified() const { return m_isModified; }
+
     private:
+        VulkanInfo(const VulkanInfo&);
+
+        void operator=(const VulkanInfo&);
+
+        static std::string getCacheKey();
+
+        static std::string getDeviceKey(const VkPhysicalDeviceProperties& properties);
 
+        mutable std::mutex m_mutex;
+        bool m_isInstanceExtensionsQueried = false;
+        bool m_isLayersQueried = false;
+        bool m_isModified = false;
+        std::vector<VkExtensionProperties> m_instanceExtensions;
+        std::vector<VkLayerProperties> m_layers;
+        //devices are cached by key to match them with saved snapshots and indexed by handle to skip building of key
+        std::map<std::string, PhysicalDeviceInfo> m_devices;
+        std::map<VkPhysicalDevice, const PhysicalDeviceInfo*> m_devicesByHandle;
     };
 }
 
@@ -0,0 +1,161 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Baseline.cpp
+ * \brief Contains comparison of benchmark results with stored baseline
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "Baseline.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+
+using namespace VulkalcBench;
+
+/*
+ * Finds value of key in line of JSON written by vulkalc-bench, which has one object per line
+ */
+static bool findString(const std::string& line, const char* key, std::string& value)
+{
+    size_t position = line.find("\"" + std::string(key) + "\": \"");
+    if (position == std::string::npos)
+        return false;
+    value.clear();
+    for (position += strlen(key) + 5; position < line.size() && line[position] != '"'; ++position)
+    {
+        if (line[position] == '\\' && position + 1 < line.size())
+        {
+            ++position;
+            if (line[position] == 'u' && position + 4 < line.size())
+            {
+                value += static_cast<char>(strtol(line.substr(position + 1, 4).c_str(), nullptr, 16));
+                position += 4;
+                continue;
+            }
+        }
+        value += line[position];
+    }
+    return position < line.size();
+}
+
+static bool findNumber(const std::string& line, const char* key, double& value)
+{
+    size_t position = line.find("\"" + std::string(key) + "\": ");
+    if (position == std::string::npos)
+        return false;
+    value = strtod(line.c_str() + position + strlen(key) + 4, nullptr);
+    return true;
+}
+
+bool VulkalcBench::loadBaseline(const char* path, std::string& device, std::vector<Result>& results)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    results.clear();
+    std::string line;
+    while (std::getline(file, line))
+    {
+        findString(line, "device", device);
+        Result result;
+        double repetitions = 0;
+        if (!findString(line, "benchmark", result.benchmark) || !findString(line, "name", result.name) ||
+            !findNumber(line, "repetitions", repetitions) ||
+            !findNumber(line, "meanMilliseconds", result.measurement.meanMilliseconds))
+            continue;
+        result.measurement.repetitions = static_cast<unsigned>(repetitions);
+        findNumber(line, "minMilliseconds", result.measurement.minMilliseconds);
+        findNumber(line, "medianMilliseconds", result.measurement.medianMilliseconds);
+        //baselines without intervals are compared by their mean
+        result.measurement.standardDeviationMilliseconds = 0.0;
+        result.measurement.confidenceLowMilliseconds = result.measurement.meanMilliseconds;
+        result.measurement.confidenceHighMilliseconds = result.measurement.meanMilliseconds;
+        findNumber(line, "standardDeviationMilliseconds", result.measurement.standardDeviationMilliseconds);
+        findNumber(line, "confidenceLowMilliseconds", result.measurement.confidenceLowMilliseconds);
+        findNumber(line, "confidenceHighMilliseconds", result.measurement.confidenceHighMilliseconds);
+        result.bytes = 0;
+        findNumber(line, "bytes", result.bytes);
+        results.push_back(result);
+    }
+    return !results.empty();
+}
+
+size_t VulkalcBench::compareWithBaseline(const std::vector<Result>& baseline, const std::vector<Result>& results,
+                                         double threshold, const std::function<bool(const std::string&)>& isSelected,
+                                         size_t& missingCount)
+{
+    std::map<std::string, const Result*> baselineResults;
+    for (auto& result : baseline)
+        baselineResults[result.benchmark + "/" + result.name] = &result;
+
+    std::set<std::string> currentResults;
+    size_t regressionCount = 0;
+    printf("\n%-64s %12s %12s %9s  %s\n", "result", "baseline ms", "current ms", "change", "status");
+    for (auto& result : results)
+    {
+        std::string key = result.benchmark + "/" + result.name;
+        currentResults.insert(key);
+        auto found = baselineResults.find(key);
+        if (found == baselineResults.end())
+        {
+            printf("%-64s %12s %12.3f %9s  new\n", key.c_str(), "-", result.measurement.meanMilliseconds, "-");
+            continue;
+        }
+
+        const Measurement& before = found->second->measurement;
+        const Measurement& after = result.measurement;
+        double change = before.meanMilliseconds > 0 ? after.meanMilliseconds / before.meanMilliseconds - 1.0 : 0.0;
+        const char* status = "ok";
+        if (before.repetitions < 2 || after.repetitions < 2)
+            status = "not gated, single run";
+        else if (after.confidenceLowMilliseconds > before.confidenceHighMilliseconds * (1.0 + threshold))
+        {
+            status = "REGRESSED";
+            ++regressionCount;
+        }
+        else if (after.confidenceHighMilliseconds * (1.0 + threshold) < before.confidenceLowMilliseconds)
+            status = "improved";
+        printf("%-64s %12.3f %12.3f %+8.1f%%  %s\n", key.c_str(), before.meanMilliseconds, after.meanMilliseconds,
+               change * 100.0, status);
+    }
+
+    //renamed or no longer reported cases would otherwise silently drop out of comparison
+    missingCount = 0;
+    for (auto& result : baseline)
+    {
+        std::string key = result.benchmark + "/" + result.name;
+        if (!isSelected(result.benchmark) || currentResults.count(key) != 0)
+            continue;
+        printf("%-64s %12.3f %12s %9s  MISSING\n", key.c_str(), result.measurement.meanMilliseconds, "-", "-");
+        ++missingCount;
+    }
+    return regressionCount;
+}
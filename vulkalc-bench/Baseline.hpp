@@ -0,0 +1,74 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Baseline.hpp
+ * \brief Contains comparison of benchmark results with stored baseline
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_BENCH_BASELINE_H
+#define VULKALC_BENCH_BASELINE_H
+
+#include "Benchmark.hpp"
+
+#include <functional>
+
+/*!
+ * \copydoc VulkalcBench
+ */
+namespace VulkalcBench
+{
+    /*!
+     * \brief Loads results from JSON file written by vulkalc-bench --json
+     * \param path path to JSON file
+     * \param device receives name of device, which results were measured on
+     * \param results receives loaded results
+     * \return false, if file can't be read or contains no results
+     */
+    bool loadBaseline(const char* path, std::string& device, std::vector<Result>& results);
+
+    /*!
+     * \brief Compares results with baseline and prints report
+     *
+     * Result regresses, if lower bound of its confidence interval is above upper bound of baseline interval
+     * by more than threshold, so noise of both runs doesn't fail comparison. Results of single run and results,
+     * which are missing in baseline, are reported, but never regress. Baseline results, which are missing in current
+     * run, are reported as missing, unless their benchmark wasn't selected to run.
+     * \param baseline baseline results
+     * \param results current results
+     * \param threshold allowed slowdown, 0.1 for 10%
+     * \param isSelected returns whether benchmark of given name was selected by filters
+     * \param missingCount receives number of baseline results of selected benchmarks, which are missing in results
+     * \return number of regressed results
+     */
+    size_t compareWithBaseline(const std::vector<Result>& baseline, const std::vector<Result>& results,
+                               double threshold, const std::function<bool(const std::string&)>& isSelected,
+                               size_t& missingCount);
+}
+
+#endif //VULKALC_BENCH_BASELINE_H
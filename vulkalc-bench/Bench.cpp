@@ -0,0 +1,258 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+#include "Baseline.hpp"
+
+#include <Application.hpp>
+#include <Utilities.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const char* getDeviceTypeName(VkPhysicalDeviceType type)
+{
+    switch (type)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+            return "integrated";
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+            return "discrete";
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+            return "virtual";
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:
+            return "cpu";
+        default:
+            return "other";
+    }
+}
+
+static std::string getDriverVersionText(const VkPhysicalDeviceProperties& properties)
+{
+    //NVIDIA packs driver version as 10.8.8.6 bits, other vendors follow Vulkan version packing
+    char text[32];
+    uint32_t version = properties.driverVersion;
+    if (properties.vendorID == 0x10DE)
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", version >> 22, (version >> 14) & 0xFF, (version >> 6) & 0xFF,
+                 version & 0x3F);
+    else
+        snprintf(text, sizeof(text), "%u.%u.%u", VK_VERSION_MAJOR(version), VK_VERSION_MINOR(version),
+                 VK_VERSION_PATCH(version));
+    return text;
+}
+
+static const char* getCompilerName()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+/*
+ * Writes results with metadata of device, driver and build, so results of different machines can be told apart
+ */
+static bool writeJson(const char* path, Runner* runner)
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr)
+        return false;
+
+    const VkPhysicalDeviceProperties& properties = runner->getPhysicalDeviceProperties();
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    fprintf(file, "{\n  \"metadata\": {\n");
+    fprintf(file, "    \"date\": \"%s\",\n", date);
+    fprintf(file, "    \"device\": \"%s\",\n", escapeJson(properties.deviceName).c_str());
+    fprintf(file, "    \"deviceType\": \"%s\",\n", getDeviceTypeName(properties.deviceType));
+    fprintf(file, "    \"vendorId\": %u,\n    \"deviceId\": %u,\n", properties.vendorID, properties.deviceID);
+    fprintf(file, "    \"driverVersion\": \"%s\",\n", getDriverVersionText(properties).c_str());
+    fprintf(file, "    \"apiVersion\": \"%u.%u.%u\",\n", VK_VERSION_MAJOR(properties.apiVersion),
+            VK_VERSION_MINOR(properties.apiVersion), VK_VERSION_PATCH(properties.apiVersion));
+    fprintf(file, "    \"compiler\": \"%s\",\n", escapeJson(getCompilerName()).c_str());
+#ifdef NDEBUG
+    fprintf(file, "    \"build\": \"release\"\n  },\n");
+#else
+    fprintf(file, "    \"build\": \"debug\"\n  },\n");
+#endif
+    fprintf(file, "  \"results\": [");
+    const std::vector<Result>& results = getResults();
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& result = results[i];
+        fprintf(file, "%s\n    {\"benchmark\": \"%s\", \"name\": \"%s\", \"repetitions\": %u, "
+                      "\"minMilliseconds\": %.6f, \"medianMilliseconds\": %.6f, \"meanMilliseconds\": %.6f, "
+                      "\"standardDeviationMilliseconds\": %.6f, \"confidenceLowMilliseconds\": %.6f, "
+                      "\"confidenceHighMilliseconds\": %.6f, \"bytes\": %.0f}", i > 0 ? "," : "",
+                escapeJson(result.benchmark).c_str(), escapeJson(result.name).c_str(), result.measurement.repetitions,
+                result.measurement.minMilliseconds, result.measurement.medianMilliseconds,
+                result.measurement.meanMilliseconds, result.measurement.standardDeviationMilliseconds,
+                result.measurement.confidenceLowMilliseconds, result.measurement.confidenceHighMilliseconds,
+                result.bytes);
+    }
+    fprintf(file, "\n  ]\n}\n");
+    return fclose(file) == 0;
+}
+
+static double getMillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * Runs all registered benchmarks or only those, whose names contain one of filters.
+ * Usage: vulkalc-bench [--device index] [--json path] [--baseline path [--threshold percent]]
+ *                      [--repetitions count] [filter...]
+ * Device index selects physical device, like lavapipe or other CPU implementation on CI.
+ * With baseline every case is measured at least 30 times, unless --repetitions is given, and exit code is 2,
+ * if any case regressed by more than threshold, 10% by default, or any baseline case of selected benchmarks is missing.
+ */
+int main(int argc, char** argv)
+{
+    const char* jsonPath = nullptr;
+    const char* baselinePath = nullptr;
+    double threshold = 0.1;
+    int deviceIndex = -1;
+    int minimumRepetitions = -1;
+    std::vector<std::string> filters;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+            baselinePath = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            threshold = atof(argv[++i]) / 100.0;
+        else if (strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+            minimumRepetitions = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--device") == 0 && i + 1 < argc)
+            deviceIndex = atoi(argv[++i]);
+        else
+            filters.push_back(argv[i]);
+    }
+
+    //baseline is loaded first, so missing file doesn't waste whole run
+    std::string baselineDevice;
+    std::vector<Result> baseline;
+    if (baselinePath)
+    {
+        if (!loadBaseline(baselinePath, baselineDevice, baseline))
+        {
+            fprintf(stderr, "Failed to load baseline %s\n", baselinePath);
+            return 1;
+        }
+        if (minimumRepetitions < 0)
+            minimumRepetitions = 30;
+    }
+    if (minimumRepetitions > 0)
+        getMinimumRepetitions() = static_cast<unsigned>(minimumRepetitions);
+    auto isSelected = [&filters](const std::string& name)
+    {
+        bool isSelected = filters.empty();
+        for (auto& filter : filters)
+            isSelected = isSelected || name.find(filter) != std::string::npos;
+        return isSelected;
+    };
+
+    //startup happens once per process, so it is measured cold, without repetitions
+    auto startupBegin = std::chrono::steady_clock::now();
+    Application* application = Application::getInstance();
+    double instanceMilliseconds = getMillisecondsSince(startupBegin);
+    Configuration* configuration = application->getConfigurator()->getConfiguration();
+    configuration->isLoggingEnabled = false;
+    if (deviceIndex >= 0)
+        configuration->deviceToUse = static_cast<uint32_t>(deviceIndex);
+    //push descriptors require this instance extension
+    if (VulkanInfo::getInstance()->isInstanceExtensionSupported("VK_KHR_get_physical_device_properties2"))
+        configuration->enabledExtensionsNames.push_back("VK_KHR_get_physical_device_properties2");
+    auto configureBegin = std::chrono::steady_clock::now();
+    try
+    {
+        application->configure();
+    }
+    catch (Exception& e)
+    {
+        fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    double configureMilliseconds = getMillisecondsSince(configureBegin);
+
+    Runner* runner = application->getRunner();
+    printf("Device: %s\n", runner->getPhysicalDeviceProperties().deviceName);
+    if (isSelected("startup"))
+    {
+        printf("\nstartup\n");
+        getCurrentBenchmark() = "startup";
+        report("Application::getInstance, cold", summarize(std::vector<double>(1, instanceMilliseconds)), 0);
+        report("Application::configure, cold", summarize(std::vector<double>(1, configureMilliseconds)), 0);
+    }
+    for (auto& benchmark : getBenchmarks())
+    {
+        if (!isSelected(benchmark.first))
+            continue;
+
+        printf("\n%s\n", benchmark.first.c_str());
+        getCurrentBenchmark() = benchmark.first;
+        try
+        {
+            benchmark.second(runner);
+        }
+        catch (Exception& e)
+        {
+            fprintf(stderr, "%s failed: %s\n", benchmark.first.c_str(), e.what());
+            return 1;
+        }
+    }
+
+    if (jsonPath && !writeJson(jsonPath, runner))
+    {
+        fprintf(stderr, "Failed to write %s\n", jsonPath);
+        return 1;
+    }
+    if (baselinePath)
+    {
+        if (baselineDevice != runner->getPhysicalDeviceProperties().deviceName)
+            printf("\nwarning: baseline was measured on %s\n", baselineDevice.c_str());
+        size_t missingCount = 0;
+        size_t regressionCount = compareWithBaseline(baseline, getResults(), threshold, isSelected, missingCount);
+        if (regressionCount > 0)
+            printf("\n%zu results regressed by more than %.1f%%\n", regressionCount, threshold * 100.0);
+        if (missingCount > 0)
+            printf("\n%zu baseline results are missing, update baseline, if cases were renamed or removed\n",
+                   missingCount);
+        if (regressionCount > 0 || missingCount > 0)
+            return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,236 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file Benchmark.hpp
+ * \brief Contains minimal benchmarking harness for Vulkalc
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_BENCH_BENCHMARK_H
+#define VULKALC_BENCH_BENCHMARK_H
+
+#include <Runner.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*!
+ * \namespace VulkalcBench
+ * \brief Contains benchmarking harness and benchmarks
+ */
+namespace VulkalcBench
+{
+    /*!
+     * \brief Benchmark function, which receives configured Runner
+     */
+    typedef void (* BenchmarkFunction)(Vulkalc::Runner* runner);
+
+    /*!
+     * \brief Returns all registered benchmarks
+     * \return vector of benchmark names and functions
+     */
+    inline std::vector<std::pair<std::string, BenchmarkFunction>>& getBenchmarks()
+    {
+        static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+        return benchmarks;
+    }
+
+    /*!
+     * \brief Registers benchmark on construction
+     */
+    struct Registrar
+    {
+        Registrar(const char* name, BenchmarkFunction function)
+        {
+            getBenchmarks().push_back(std::make_pair(std::string(name), function));
+        }
+    };
+
+    /*!
+     * \brief Timings of repeated runs
+     */
+    struct Measurement
+    {
+        unsigned repetitions;
+        double minMilliseconds;
+        double medianMilliseconds;
+        double meanMilliseconds;
+        double standardDeviationMilliseconds;
+        /*!
+         * \brief Bounds of 95% confidence interval of mean, equal to mean for single run
+         */
+        double confidenceLowMilliseconds;
+        double confidenceHighMilliseconds;
+    };
+
+    /*!
+     * \brief Reported measurement of benchmark case
+     */
+    struct Result
+    {
+        std::string benchmark;
+        std::string name;
+        Measurement measurement;
+        double bytes;
+    };
+
+    /*!
+     * \brief Returns all reported results in order of reporting
+     * \return vector of results
+     */
+    inline std::vector<Result>& getResults()
+    {
+        static std::vector<Result> results;
+        return results;
+    }
+
+    /*!
+     * \brief Returns name of running benchmark, which reported results belong to
+     * \return reference to name
+     */
+    inline std::string& getCurrentBenchmark()
+    {
+        static std::string benchmark;
+        return benchmark;
+    }
+
+    /*!
+     * \brief Returns minimum number of measured runs, which overrides smaller repetitions of benchmarks
+     *
+     * Comparison with baseline raises it, so confidence intervals are narrow enough to tell regressions from noise.
+     * \return reference to minimum number of runs
+     */
+    inline unsigned& getMinimumRepetitions()
+    {
+        static unsigned minimumRepetitions = 1;
+        return minimumRepetitions;
+    }
+
+    /*!
+     * \brief Returns two-sided 95% quantile of Student's t-distribution
+     * \param degreesOfFreedom number of runs minus 1
+     * \return quantile
+     */
+    inline double getStudentQuantile(unsigned degreesOfFreedom)
+    {
+        static const double quantiles[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                           2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                           2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        if (degreesOfFreedom == 0)
+            return 0.0;
+        if (degreesOfFreedom <= 30)
+            return quantiles[degreesOfFreedom - 1];
+        return degreesOfFreedom <= 60 ? 2.000 : 1.960;
+    }
+
+    /*!
+     * \brief Computes statistics of timings
+     * \param timings timings of runs in milliseconds, not empty
+     * \return measurement
+     */
+    inline Measurement summarize(std::vector<double> timings)
+    {
+        std::sort(timings.begin(), timings.end());
+        Measurement measurement;
+        measurement.repetitions = static_cast<unsigned>(timings.size());
+        measurement.minMilliseconds = timings.front();
+        measurement.medianMilliseconds = timings[timings.size() / 2];
+        measurement.meanMilliseconds = 0;
+        for (double timing : timings)
+            measurement.meanMilliseconds += timing;
+        measurement.meanMilliseconds /= timings.size();
+        double variance = 0;
+        for (double timing : timings)
+            variance += (timing - measurement.meanMilliseconds) * (timing - measurement.meanMilliseconds);
+        variance = timings.size() > 1 ? variance / (timings.size() - 1) : 0.0;
+        measurement.standardDeviationMilliseconds = std::sqrt(variance);
+        double halfWidth = getStudentQuantile(measurement.repetitions - 1) * measurement.standardDeviationMilliseconds /
+                           std::sqrt(double(timings.size()));
+        measurement.confidenceLowMilliseconds = measurement.meanMilliseconds - halfWidth;
+        measurement.confidenceHighMilliseconds = measurement.meanMilliseconds + halfWidth;
+        return measurement;
+    }
+
+    /*!
+     * \brief Runs body once to warm up, then repetitions times and measures every run
+     * \param repetitions number of measured runs, at least getMinimumRepetitions()
+     * \param body measured code
+     * \return timings
+     */
+    inline Measurement measure(unsigned repetitions, const std::function<void()>& body)
+    {
+        body();
+        std::vector<double> timings;
+        repetitions = std::max(repetitions, getMinimumRepetitions());
+        for (unsigned i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            timings.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return summarize(timings);
+    }
+
+    /*!
+     * \brief Prints measurement with throughput and adds it to results of current benchmark
+     * \param name name of measured case, unique within benchmark
+     * \param measurement timings
+     * \param bytes number of bytes processed by one run, 0 to skip throughput
+     */
+    inline void report(const std::string& name, const Measurement& measurement, double bytes)
+    {
+        printf("%-48s min %10.3f ms  median %10.3f ms  mean %10.3f ms", name.c_str(), measurement.minMilliseconds,
+               measurement.medianMilliseconds, measurement.meanMilliseconds);
+        if (bytes > 0)
+            printf("  %8.2f GB/s", bytes / (measurement.medianMilliseconds * 1e6));
+        printf("\n");
+
+        Result result;
+        result.benchmark = getCurrentBenchmark();
+        result.name = name;
+        result.measurement = measurement;
+        result.bytes = bytes;
+        getResults().push_back(result);
+    }
+}
+
+/*!
+ * \brief Defines and registers benchmark function with given name
+ */
+#define VULKALC_BENCHMARK(name) \
+    static void name(Vulkalc::Runner* runner); \
+    static VulkalcBench::Registrar name##Registrar(#name, name); \
+    static void name(Vulkalc::Runner* runner)
+
+#endif //VULKALC_BENCH_BENCHMARK_H
@@ -0,0 +1,108 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <ShaderCompiler.hpp>
+
+#include <cstdio>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned KERNEL_COUNT = 16;
+static const unsigned REPETITIONS = 3;
+
+static const char* const KERNEL_SOURCE =
+        "#version 450\n"
+        "layout(local_size_x = 256) in;\n"
+        "layout(std430, binding = 0) buffer Values { float values[]; };\n"
+        "void main()\n"
+        "{\n"
+        "    uint i = gl_GlobalInvocationID.x;\n"
+        "    values[i] = values[i] * SCALE + 1.0;\n"
+        "}\n";
+
+static std::vector<std::vector<std::string>> createVariants()
+{
+    std::vector<std::vector<std::string>> variants;
+    for (unsigned i = 0; i < KERNEL_COUNT; ++i)
+        variants.push_back({"SCALE=" + std::to_string(i + 1) + ".0"});
+    return variants;
+}
+
+static void removeCachedKernels(const std::string& source, const std::vector<std::vector<std::string>>& variants)
+{
+    for (auto& defines : variants)
+    {
+        std::string path = "./" + ShaderCompiler::getCacheKey(source, defines) + ".spv";
+        std::remove(path.c_str());
+    }
+}
+
+/*
+ * Compiles KERNEL_COUNT distinct kernels with empty disk cache, then loads them again with new compiler,
+ * which finds all of them in cache. Cache is kept in working directory and removed afterwards.
+ */
+VULKALC_BENCHMARK(shaderCompilation)
+{
+    (void) runner;
+    if (!ShaderCompiler::isCompilationSupported())
+    {
+        printf("skipped: Vulkalc is built without VULKALC_RUNTIME_COMPILER\n");
+        return;
+    }
+
+    //unique source per run guarantees cold cache even if previous run was interrupted
+    std::vector<std::vector<std::string>> variants = createVariants();
+    std::string runTag = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    unsigned coldRun = 0;
+    report("cold, " + std::to_string(KERNEL_COUNT) + " kernels compiled", measure(REPETITIONS, [&]()
+    {
+        std::string source = std::string(KERNEL_SOURCE) + "// run " + runTag + " " + std::to_string(coldRun++) + "\n";
+        ShaderCompiler coldCompiler(".");
+        for (auto& defines : variants)
+            coldCompiler.compile(source, defines);
+        removeCachedKernels(source, variants);
+    }), 0);
+
+    std::string source = std::string(KERNEL_SOURCE) + "// run " + runTag + " warm\n";
+    ShaderCompiler populatingCompiler(".");
+    for (auto& defines : variants)
+        populatingCompiler.compile(source, defines);
+    uint64_t cacheHitCount = 0, requestCount = 0;
+    report("warm, " + std::to_string(KERNEL_COUNT) + " kernels loaded from disk cache", measure(REPETITIONS, [&]()
+    {
+        ShaderCompiler warmCompiler(".");
+        for (auto& defines : variants)
+            warmCompiler.compile(source, defines);
+        cacheHitCount += warmCompiler.getStatistics().cacheHitCount;
+        requestCount += warmCompiler.getStatistics().requestCount;
+    }), 0);
+    removeCachedKernels(source, variants);
+    if (cacheHitCount != requestCount)
+        printf("warm compilation missed disk cache in %llu of %llu requests\n",
+               static_cast<unsigned long long>(requestCount - cacheHitCount),
+               static_cast<unsigned long long>(requestCount));
+}
@@ -0,0 +1,73 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Expression.hpp>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t ELEMENT_COUNT = 1024;
+static const unsigned EXECUTION_COUNT = 1000;
+static const unsigned REPETITIONS = 5;
+
+/*
+ * Executes EXECUTION_COUNT small dispatches one by one with descriptor sets from pools and with pushed descriptors
+ */
+VULKALC_BENCHMARK(descriptorAllocation)
+{
+    Buffer<float> a(runner, ELEMENT_COUNT), b(runner, ELEMENT_COUNT);
+    Task task = createExpressionTask(b, a * 2.0f);
+
+    bool isPushDescriptorEnabled = runner->isPushDescriptorEnabled();
+    for (int usePushDescriptors = 0; usePushDescriptors < 2; ++usePushDescriptors)
+    {
+        if (usePushDescriptors && !runner->isPushDescriptorSupported())
+        {
+            printf("push descriptors: skipped, VK_KHR_push_descriptor is not supported\n");
+            break;
+        }
+        runner->setPushDescriptorEnabled(usePushDescriptors != 0);
+
+        uint64_t allocationCount = runner->getDescriptorStatistics().allocationCount;
+        uint64_t pushedCount = runner->getPushedDescriptorSetCount();
+        Measurement measurement = measure(REPETITIONS, [&]()
+        {
+            for (unsigned i = 0; i < EXECUTION_COUNT; ++i)
+                runner->execute(task);
+        });
+        std::string name = std::string(usePushDescriptors ? "push descriptors" : "pooled descriptor sets") + ", " +
+                           std::to_string(EXECUTION_COUNT) + " executions";
+        report(name, measurement, 0);
+
+        //warm-up run is counted too
+        double executionCount = double(measurement.repetitions + 1) * EXECUTION_COUNT;
+        printf("%-48s %10.2f allocations, %10.2f pushes per execution, %llu pools\n", "",
+               (runner->getDescriptorStatistics().allocationCount - allocationCount) / executionCount,
+               (runner->getPushedDescriptorSetCount() - pushedCount) / executionCount,
+               static_cast<unsigned long long>(runner->getDescriptorStatistics().poolCount));
+    }
+    runner->setPushDescriptorEnabled(isPushDescriptorEnabled);
+}
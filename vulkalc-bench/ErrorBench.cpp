@@ -0,0 +1,99 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Buffer.hpp>
+#include <Expression.hpp>
+#include <Recording.hpp>
+
+#include <cstdlib>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned CALL_COUNT = 1000000;
+static const unsigned FAILING_CALL_COUNT = 10000;
+
+/*
+ * Returns nanoseconds per call of body
+ */
+static double measureCall(unsigned callCount, const std::function<void()>& body)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < callCount; ++i)
+        body();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / callCount;
+}
+
+/*
+ * Compares throwing calls with calls returning Expected. On success path both should cost the same,
+ * on failure path Expected avoids unwinding.
+ */
+VULKALC_BENCHMARK(errorHandling)
+{
+    Buffer<float> buffer(runner, 1024);
+    float values[16] = {};
+
+    double throwing = measureCall(CALL_COUNT, [&]()
+    {
+        buffer.upload(values, 16);
+    });
+    double expected = measureCall(CALL_COUNT, [&]()
+    {
+        if (!buffer.tryUpload(values, 16))
+            abort();
+    });
+    printf("upload of 64 bytes, no error:     exceptions %8.2f ns, Expected %8.2f ns\n", throwing, expected);
+
+    throwing = measureCall(FAILING_CALL_COUNT, [&]()
+    {
+        try
+        {
+            buffer.upload(values, 16, 1024);
+        }
+        catch (InvalidArgumentException&)
+        {
+        }
+    });
+    expected = measureCall(FAILING_CALL_COUNT, [&]()
+    {
+        if (buffer.tryUpload(values, 16, 1024))
+            abort();
+    });
+    printf("upload out of range, error:       exceptions %8.2f ns, Expected %8.2f ns\n", throwing, expected);
+
+    Buffer<float> output(runner, 1024);
+    std::vector<Task> tasks(1, createExpressionTask(output, buffer * 2.0f));
+    Recording recording(runner, tasks);
+    report("replay, exceptions", measure(1000, [&]()
+    {
+        runner->execute(recording);
+    }), 0);
+    report("replay, Expected", measure(1000, [&]()
+    {
+        if (!runner->tryExecute(recording))
+            abort();
+    }), 0);
+}
@@ -0,0 +1,65 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Expression.hpp>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t ELEMENT_COUNT = 16 * 1024 * 1024;
+static const unsigned REPETITIONS = 20;
+
+/*
+ * c = a * b + d * e - f evaluated by one fused kernel and by one kernel per operation with temporary buffers.
+ * Both variants are submitted once, so the difference is in kernels and memory traffic only.
+ */
+VULKALC_BENCHMARK(expressionFusion)
+{
+    Buffer<float> a(runner, ELEMENT_COUNT), b(runner, ELEMENT_COUNT), d(runner, ELEMENT_COUNT);
+    Buffer<float> e(runner, ELEMENT_COUNT), f(runner, ELEMENT_COUNT), c(runner, ELEMENT_COUNT);
+    Buffer<float> temporary1(runner, ELEMENT_COUNT), temporary2(runner, ELEMENT_COUNT);
+    std::vector<float> values(ELEMENT_COUNT);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i)
+        values[i] = static_cast<float>(i % 1024) / 1024.0f;
+    for (Buffer<float>* buffer : {&a, &b, &d, &e, &f})
+        buffer->upload(values);
+
+    //5 buffers are read and 1 is written by fused kernel, every unfused kernel reads 2 buffers and writes 1
+    double elementSize = sizeof(float);
+    double fusedTraffic = 6 * elementSize * ELEMENT_COUNT;
+    double unfusedTraffic = 4 * 3 * elementSize * ELEMENT_COUNT;
+
+    report("fused, 1 kernel", measure(REPETITIONS, [&]() { c = a * b + d * e - f; }), fusedTraffic);
+
+    std::vector<Task> unfused;
+    unfused.push_back(createExpressionTask(temporary1, a * b));
+    unfused.push_back(createExpressionTask(temporary2, d * e));
+    unfused.push_back(createExpressionTask(temporary1, temporary1 + temporary2));
+    unfused.push_back(createExpressionTask(c, temporary1 - f));
+    report("unfused, 4 kernels", measure(REPETITIONS, [&]() { runner->execute(unfused); }), unfusedTraffic);
+
+    printf("memory traffic: fused %.0f MB, unfused %.0f MB\n", fusedTraffic / 1e6, unfusedTraffic / 1e6);
+}
@@ -0,0 +1,72 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <ComputeGraph.hpp>
+#include <Expression.hpp>
+
+#include <memory>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t ELEMENT_COUNT = 1024 * 1024;
+static const size_t CHAIN_COUNT = 8;
+static const size_t CHAIN_LENGTH = 4;
+static const unsigned REPETITIONS = 20;
+
+/*
+ * CHAIN_COUNT independent chains of CHAIN_LENGTH dependent kernels, executed with full barrier between every two
+ * kernels and as ComputeGraph, which synchronizes only kernels of the same chain.
+ */
+VULKALC_BENCHMARK(computeGraph)
+{
+    std::vector<std::unique_ptr<Buffer<float>>> buffers;
+    for (size_t i = 0; i < 2 * CHAIN_COUNT; ++i)
+        buffers.push_back(std::unique_ptr<Buffer<float>>(new Buffer<float>(runner, ELEMENT_COUNT)));
+
+    std::vector<Task> tasks;
+    ComputeGraph graph;
+    for (size_t chain = 0; chain < CHAIN_COUNT; ++chain)
+    {
+        Buffer<float>& a = *buffers[2 * chain];
+        Buffer<float>& b = *buffers[2 * chain + 1];
+        for (size_t i = 0; i < CHAIN_LENGTH; ++i)
+        {
+            //kernels ping-pong between two buffers, so every kernel depends on previous one
+            Task task = i % 2 == 0 ? createExpressionTask(b, a * 2.0f + 1.0f) : createExpressionTask(a, b * 0.5f);
+            tasks.push_back(task);
+            graph.add(task);
+        }
+    }
+    graph.compile(runner->getComputeQueueCount());
+
+    double traffic = 2.0 * sizeof(float) * ELEMENT_COUNT * tasks.size();
+    report("serialized, " + std::to_string(tasks.size() - 1) + " full barriers",
+           measure(REPETITIONS, [&]() { runner->execute(tasks); }), traffic);
+    report("graph, " + std::to_string(graph.getPipelineBarrierCount()) + " barriers on " +
+           std::to_string(graph.compile(runner->getComputeQueueCount()).size()) + " queues",
+           measure(REPETITIONS, [&]() { runner->execute(graph); }), traffic);
+}
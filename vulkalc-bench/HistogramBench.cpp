@@ -0,0 +1,128 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Histogram.hpp>
+#include <cmath>
+#include <random>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t VALUE_COUNT = 16 * 1024 * 1024;
+static const uint32_t BIN_COUNT = 1024;
+static const unsigned REPETITIONS = 20;
+
+/*
+ * Uniform values spread atomics over all bins, equal values make every thread hit the same bin,
+ * power-law values put most of the counts into a few first bins
+ */
+enum DISTRIBUTION { DISTRIBUTION_UNIFORM, DISTRIBUTION_EQUAL, DISTRIBUTION_POWER_LAW };
+
+static const char* getDistributionName(DISTRIBUTION distribution)
+{
+    switch (distribution)
+    {
+        case DISTRIBUTION_UNIFORM:
+            return "uniform";
+        case DISTRIBUTION_EQUAL:
+            return "equal";
+        case DISTRIBUTION_POWER_LAW:
+            return "power-law";
+    }
+    return "";
+}
+
+static std::vector<float> generateValues(DISTRIBUTION distribution)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    std::vector<float> values(VALUE_COUNT);
+    for (auto& value : values)
+    {
+        switch (distribution)
+        {
+            case DISTRIBUTION_UNIFORM:
+                value = uniform(generator);
+                break;
+            case DISTRIBUTION_EQUAL:
+                value = 0.5f;
+                break;
+            case DISTRIBUTION_POWER_LAW:
+                value = std::pow(uniform(generator), 8.0f);
+                break;
+        }
+    }
+    return values;
+}
+
+VULKALC_BENCHMARK(histogramFloat)
+{
+    Buffer<float> input(runner, VALUE_COUNT);
+    Buffer<uint32_t> bins(runner, BIN_COUNT);
+    Histogram histogram(runner, BIN_COUNT, 0.0f, 1.0f);
+
+    for (auto distribution : {DISTRIBUTION_UNIFORM, DISTRIBUTION_EQUAL, DISTRIBUTION_POWER_LAW})
+    {
+        input.upload(generateValues(distribution));
+        for (bool isPrivatized : {true, false})
+        {
+            histogram.setPrivatizationEnabled(isPrivatized);
+            std::string name = std::string(getDistributionName(distribution)) +
+                               (histogram.isPrivatized() ? ", shared bins" : ", global bins");
+            report(name, measure(REPETITIONS, [&]() { histogram.compute(input, bins); }),
+                   VALUE_COUNT * sizeof(float));
+        }
+    }
+}
+
+VULKALC_BENCHMARK(histogramBytes)
+{
+    Buffer<uint8_t> bytes(runner, VALUE_COUNT);
+    Buffer<uint32_t> words(runner, VALUE_COUNT);
+    Buffer<uint32_t> bins(runner, Histogram::BYTE_BIN_COUNT);
+    Histogram histogram(runner, Histogram::BYTE_BIN_COUNT, 0.0f, 256.0f);
+
+    for (auto distribution : {DISTRIBUTION_UNIFORM, DISTRIBUTION_EQUAL, DISTRIBUTION_POWER_LAW})
+    {
+        std::vector<float> values = generateValues(distribution);
+        std::vector<uint8_t> byteValues(VALUE_COUNT);
+        std::vector<uint32_t> wordValues(VALUE_COUNT);
+        for (size_t i = 0; i < VALUE_COUNT; ++i)
+        {
+            byteValues[i] = static_cast<uint8_t>(std::min(values[i] * 256.0f, 255.0f));
+            wordValues[i] = byteValues[i];
+        }
+        bytes.upload(byteValues);
+        words.upload(wordValues);
+
+        std::string name = getDistributionName(distribution);
+        report(name + ", byte fast path", measure(REPETITIONS, [&]() {
+            Histogram::computeBytes(runner, bytes, bins);
+        }), VALUE_COUNT);
+        report(name + ", generic uint path", measure(REPETITIONS, [&]() { histogram.compute(words, bins); }),
+               VALUE_COUNT * sizeof(uint32_t));
+    }
+}
@@ -0,0 +1,106 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Logger.hpp>
+
+#include <streambuf>
+#include <thread>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned PRODUCER_COUNT = 16;
+static const unsigned MESSAGES_PER_PRODUCER = 100000;
+static const unsigned REPETITIONS = 3;
+
+/*
+ * Stream buffer, which discards everything, so benchmark measures logger and not the stream
+ */
+class NullBuffer : public std::streambuf
+{
+protected:
+    virtual int overflow(int c) override { return c; }
+
+    virtual std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+/*
+ * PRODUCER_COUNT threads log MESSAGES_PER_PRODUCER messages each, with and without fields. Enqueue rate is what
+ * calling threads see, drain rate includes formatting and writing on logger thread. Messages, which did not fit into
+ * ring buffer, are dropped.
+ */
+VULKALC_BENCHMARK(loggerThroughput)
+{
+    (void) runner;
+    NullBuffer buffer;
+    std::ostream stream(&buffer);
+    const double messageCount = double(PRODUCER_COUNT) * MESSAGES_PER_PRODUCER;
+
+    for (unsigned fieldCount : {0u, 3u})
+    {
+        for (size_t capacity : {size_t(4096), size_t(65536)})
+        {
+            //every run gets new logger, so drops of previous runs don't free ring buffer for next ones
+            std::vector<double> enqueueTimings;
+            uint64_t writtenCount = 0, droppedCount = 0;
+            Measurement measurement = measure(REPETITIONS, [&]()
+            {
+                Logger logger("bench ", &stream, nullptr, capacity);
+                auto start = std::chrono::steady_clock::now();
+                std::vector<std::thread> producers;
+                for (unsigned i = 0; i < PRODUCER_COUNT; ++i)
+                    producers.push_back(std::thread([&logger, fieldCount]()
+                    {
+                        for (unsigned j = 0; j < MESSAGES_PER_PRODUCER; ++j)
+                        {
+                            if (fieldCount == 0)
+                                VULKALC_LOG_INFO(&logger, "buffer of 65536 elements uploaded to device memory");
+                            else
+                                VULKALC_LOG_INFO(&logger, "dispatch", {"kernel", "histogram_float"},
+                                                 {"size", 65536}, {"microseconds", 12.5});
+                        }
+                    }));
+                for (auto& producer : producers)
+                    producer.join();
+                enqueueTimings.push_back(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start).count());
+                logger.flush();
+                writtenCount += logger.getWrittenCount();
+                droppedCount += logger.getDroppedCount();
+            });
+
+            //measured runs include flush, so they show drain rate, enqueue rate is what calling threads see
+            std::string name = std::to_string(fieldCount) + " fields, " + std::to_string(PRODUCER_COUNT) +
+                               " producers, ring of " + std::to_string(capacity);
+            report(name + ", written", measurement, 0);
+            report(name + ", enqueued", summarize(enqueueTimings), 0);
+            double runCount = double(enqueueTimings.size());
+            printf("%-48s %7.2f M msg/s written, dropped %5.1f%%\n", "",
+                   writtenCount / runCount / measurement.medianMilliseconds / 1e3,
+                   100.0 * droppedCount / (messageCount * runCount));
+        }
+    }
+}
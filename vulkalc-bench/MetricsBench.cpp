@@ -0,0 +1,89 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <Metrics.hpp>
+
+#include <thread>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned INCREMENTS_PER_THREAD = 1000000;
+static const unsigned REPETITIONS = 5;
+
+/*
+ * Runs body INCREMENTS_PER_THREAD times on every thread
+ */
+template<typename Body>
+static void runIncrements(unsigned threadCount, Body body)
+{
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; ++i)
+        threads.push_back(std::thread([&body]()
+        {
+            for (unsigned j = 0; j < INCREMENTS_PER_THREAD; ++j)
+                body(j);
+        }));
+    for (auto& thread : threads)
+        thread.join();
+}
+
+/*
+ * Cost of INCREMENTS_PER_THREAD metric updates on each of 1 to 16 threads. Sharded Counter is compared with single
+ * shared atomic, which every thread invalidates in caches of other threads.
+ * LatencyHistogram updates bucket, count and sum.
+ */
+VULKALC_BENCHMARK(metricsIncrement)
+{
+    (void) runner;
+    for (unsigned threadCount : {1u, 4u, 16u})
+    {
+        Metrics metrics;
+        Counter& counter = metrics.getCounter("vulkalc_bench_total");
+        LatencyHistogram& histogram = metrics.getHistogram("vulkalc_bench_seconds");
+        std::atomic<uint64_t> sharedCounter(0);
+
+        std::string suffix = ", " + std::to_string(threadCount) + " threads";
+        Measurement counterMeasurement = measure(REPETITIONS, [&]()
+        {
+            runIncrements(threadCount, [&counter](unsigned) { counter.add(); });
+        });
+        report("Counter" + suffix, counterMeasurement, 0);
+        report("shared atomic" + suffix, measure(REPETITIONS, [&]()
+        {
+            runIncrements(threadCount, [&sharedCounter](unsigned)
+            {
+                sharedCounter.fetch_add(1, std::memory_order_relaxed);
+            });
+        }), 0);
+        report("LatencyHistogram" + suffix, measure(REPETITIONS, [&]()
+        {
+            runIncrements(threadCount, [&histogram](unsigned value) { histogram.record(value); });
+        }), 0);
+        //warm-up run is counted too
+        if (counter.get() != uint64_t(threadCount) * INCREMENTS_PER_THREAD * (counterMeasurement.repetitions + 1))
+            printf("Counter lost increments\n");
+    }
+}
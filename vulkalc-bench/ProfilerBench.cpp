@@ -0,0 +1,75 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Expression.hpp>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t ELEMENT_COUNT = 1024 * 1024;
+static const unsigned REPETITION_COUNT = 50;
+
+/*
+ * Executes chain of small kernels with profiling disabled and enabled, then prints device time per kernel
+ */
+VULKALC_BENCHMARK(profiler)
+{
+    if (!runner->isProfilingSupported())
+    {
+        printf("skipped: compute queue doesn't support timestamps\n");
+        return;
+    }
+
+    Buffer<float> a(runner, ELEMENT_COUNT), b(runner, ELEMENT_COUNT), c(runner, ELEMENT_COUNT);
+    std::vector<Task> tasks;
+    tasks.push_back(Task::fill(a, 0));
+    tasks.push_back(Task::copy(a, b));
+    for (int i = 0; i < 8; ++i)
+    {
+        tasks.push_back(createExpressionTask(c, a * b + 1.0f));
+        tasks.push_back(createExpressionTask(a, c * 0.5f));
+    }
+    auto execute = [&]()
+    {
+        runner->execute(tasks);
+    };
+
+    bool wasEnabled = runner->isProfilingEnabled();
+    runner->setProfilingEnabled(false);
+    Measurement disabled = measure(REPETITION_COUNT, execute);
+    runner->setProfilingEnabled(true);
+    runner->getProfiler()->reset();
+    Measurement enabled = measure(REPETITION_COUNT, execute);
+    runner->setProfilingEnabled(wasEnabled);
+
+    report("profiling disabled", disabled, 0);
+    report("profiling enabled", enabled, 0);
+    printf("%-24s %8s %12s %12s %12s %12s\n", "kernel", "count", "min us", "mean us", "p99 us", "total us");
+    for (auto& kernel : runner->getProfiler()->getStatistics())
+        printf("%-24s %8llu %12.2f %12.2f %12.2f %12.2f\n", kernel.first.c_str(),
+               static_cast<unsigned long long>(kernel.second.count), kernel.second.minMicroseconds,
+               kernel.second.meanMicroseconds, kernel.second.p99Microseconds, kernel.second.totalMicroseconds);
+}
@@ -0,0 +1,81 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include "Benchmark.hpp"
+
+#include <Expression.hpp>
+#include <Recording.hpp>
+
+#include <ctime>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const size_t ELEMENT_COUNT = 64 * 1024;
+static const size_t KERNEL_COUNT = 16;
+static const unsigned TICK_COUNT = 200;
+
+/*
+ * Returns CPU time of process per tick in milliseconds, GPU work is excluded
+ */
+static double measureCpuTime(const std::function<void()>& tick)
+{
+    tick();
+    std::clock_t start = std::clock();
+    for (unsigned i = 0; i < TICK_COUNT; ++i)
+        tick();
+    return 1000.0 * (std::clock() - start) / CLOCKS_PER_SEC / TICK_COUNT;
+}
+
+/*
+ * Every tick uploads new input and runs the same KERNEL_COUNT small kernels, which are either recorded every tick
+ * or recorded once and replayed.
+ */
+VULKALC_BENCHMARK(commandReplay)
+{
+    Buffer<float> input(runner, ELEMENT_COUNT), a(runner, ELEMENT_COUNT), b(runner, ELEMENT_COUNT);
+    std::vector<float> values(ELEMENT_COUNT, 1.0f);
+
+    std::vector<Task> tasks;
+    tasks.push_back(createExpressionTask(a, input * 1.0f));
+    for (size_t i = 1; i < KERNEL_COUNT; ++i)
+        tasks.push_back(i % 2 == 0 ? createExpressionTask(a, b + 1.0f) : createExpressionTask(b, a * 0.5f));
+    Recording recording(runner, tasks);
+
+    auto recordEveryTick = [&]()
+    {
+        input.upload(values);
+        runner->execute(tasks);
+    };
+    auto replay = [&]()
+    {
+        input.upload(values);
+        runner->execute(recording);
+    };
+
+    report("recorded every tick", measure(TICK_COUNT, recordEveryTick), 0);
+    report("replayed", measure(TICK_COUNT, replay), 0);
+    printf("CPU time per tick: recorded every tick %.3f ms, replayed %.3f ms\n", measureCpuTime(recordEveryTick),
+           measureCpuTime(replay));
+}
@@ -0,0 +1,98 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <Application.hpp>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned REPETITIONS = 10;
+
+/*
+ * Creation of VkInstance and of Runner with its device, queues and pools. Application is a singleton and is
+ * configured once, so its cold startup is measured by main, while this benchmark shows warm cost of the same steps.
+ */
+VULKALC_BENCHMARK(runnerStartup)
+{
+    (void) runner;
+    Configuration* configuration = Application::getInstance()->getConfigurator()->getConfiguration();
+    VkApplicationInfo applicationInfo = {};
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = configuration->applicationName;
+    applicationInfo.apiVersion = configuration->apiVersion;
+    VkInstanceCreateInfo instanceCreateInfo = {};
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    instanceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(configuration->enabledExtensionsNames.size());
+    instanceCreateInfo.ppEnabledExtensionNames = configuration->enabledExtensionsNames.data();
+
+    VkInstance instance = VK_NULL_HANDLE;
+    report("vkCreateInstance", measure(REPETITIONS, [&]()
+    {
+        if (vkCreateInstance(&instanceCreateInfo, nullptr, &instance) != VK_SUCCESS)
+            throw VulkanException(VK_ERROR_INITIALIZATION_FAILED, "Failed to create VkInstance");
+        vkDestroyInstance(instance, nullptr);
+    }), 0);
+
+    //layers dominate instance creation, so every profile is measured with its own set
+    static const Configuration::PROFILE PROFILES[] = {Configuration::PROFILE_RELEASE, Configuration::PROFILE_DEBUG};
+    static const char* const PROFILE_NAMES[] = {"vkCreateInstance release profile", "vkCreateInstance debug profile"};
+    Configuration::PROFILE configuredProfile = configuration->profile;
+    for (size_t i = 0; i < sizeof(PROFILES) / sizeof(PROFILES[0]); ++i)
+    {
+        std::vector<const char*> layers;
+        std::vector<const char*> extensions;
+        configuration->profile = PROFILES[i];
+        Context::selectInstanceProfile(*configuration, layers, extensions);
+        configuration->profile = configuredProfile;
+        VkInstanceCreateInfo profileCreateInfo = instanceCreateInfo;
+        profileCreateInfo.enabledLayerCount = static_cast<uint32_t>(layers.size());
+        profileCreateInfo.ppEnabledLayerNames = layers.data();
+        profileCreateInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+        profileCreateInfo.ppEnabledExtensionNames = extensions.data();
+        report(PROFILE_NAMES[i], measure(REPETITIONS, [&]()
+        {
+            if (vkCreateInstance(&profileCreateInfo, nullptr, &instance) != VK_SUCCESS)
+                throw VulkanException(VK_ERROR_INITIALIZATION_FAILED, "Failed to create VkInstance");
+            vkDestroyInstance(instance, nullptr);
+        }), 0);
+    }
+
+    if (vkCreateInstance(&instanceCreateInfo, nullptr, &instance) != VK_SUCCESS)
+        throw VulkanException(VK_ERROR_INITIALIZATION_FAILED, "Failed to create VkInstance");
+    try
+    {
+        //automatic selection without benchmark must stay far below cost of vkCreateInstance
+        report("device selection", measure(REPETITIONS, [&]() { DeviceSelector::select(instance, nullptr, false); }),
+               0);
+        report("Runner construction", measure(REPETITIONS, [&]() { Runner runner(instance, configuration); }), 0);
+    }
+    catch (...)
+    {
+        vkDestroyInstance(instance, nullptr);
+        throw;
+    }
+    vkDestroyInstance(instance, nullptr);
+}
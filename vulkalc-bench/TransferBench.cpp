@@ -0,0 +1,79 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <Expression.hpp>
+
+using namespace Vulkalc;
+using namespace VulkalcBench;
+
+static const unsigned REPETITIONS = 20;
+static const unsigned DISPATCH_REPETITIONS = 200;
+
+static std::string formatSize(size_t size)
+{
+    if (size >= 1024 * 1024)
+        return std::to_string(size / (1024 * 1024)) + " MiB";
+    return std::to_string(size / 1024) + " KiB";
+}
+
+/*
+ * Host writes to and reads from mapped Buffers, then device fills and copies them, from 4 KiB to 64 MiB.
+ * Small sizes show fixed cost of call, large ones show bandwidth of memory.
+ */
+VULKALC_BENCHMARK(transferBandwidth)
+{
+    for (size_t size : {size_t(4) << 10, size_t(64) << 10, size_t(1) << 20, size_t(16) << 20, size_t(64) << 20})
+    {
+        std::vector<uint32_t> data(size / sizeof(uint32_t), 42);
+        Buffer<uint32_t> source(runner, data.size()), destination(runner, data.size());
+        std::string suffix = ", " + formatSize(size);
+        report("upload" + suffix, measure(REPETITIONS, [&]() { source.upload(data); }), double(size));
+        report("download" + suffix, measure(REPETITIONS, [&]() { source.download(data.data(), data.size()); }), double(size));
+        report("device fill" + suffix, measure(REPETITIONS, [&]() { runner->execute(Task::fill(source, 0)); }),
+               double(size));
+        //copy reads and writes every byte
+        report("device copy" + suffix, measure(REPETITIONS, [&]() {
+            runner->execute(Task::copy(source, destination));
+        }), 2.0 * size);
+    }
+}
+
+/*
+ * Fixed cost of execution: one dispatch of one workgroup per submission, then 64 of them in one submission,
+ * which divides cost of submission and waiting between dispatches
+ */
+VULKALC_BENCHMARK(dispatchOverhead)
+{
+    Buffer<float> a(runner, 64), b(runner, 64);
+    std::vector<Task> single(1, createExpressionTask(b, a + 1.0f));
+    std::vector<Task> batch(64, createExpressionTask(b, a + 1.0f));
+
+    Measurement singleMeasurement = measure(DISPATCH_REPETITIONS, [&]() { runner->execute(single); });
+    Measurement batchMeasurement = measure(DISPATCH_REPETITIONS, [&]() { runner->execute(batch); });
+    report("1 dispatch per submission", singleMeasurement, 0);
+    report("64 dispatches per submission", batchMeasurement, 0);
+    printf("%.2f us per submission, %.2f us per dispatch in batch\n", singleMeasurement.medianMilliseconds * 1e3,
+           batchMeasurement.medianMilliseconds * 1e3 / batch.size());
+}
@@ -89,12 +89,19 @@ TEST_CASE("Application is configured")
 
 TEST_CASE("Application is being destroyed")
 {
+    REQUIRE(application->isApplicationConfigured());
     REQUIRE_NOTHROW(delete application);
-    REQUIRE_THROWS(application->log("Application is deleted and this shouldn't be printed", Application::LOG_ERROR));
+    //deleted instance is never touched again, getInstance() creates new one
     application = nullptr;
 }
 
 TEST_CASE("New instance of Application is possible to create after deleting old one")
 {
     REQUIRE_NOTHROW(application = Application::getInstance());
+    REQUIRE(application != nullptr);
+    REQUIRE(application->isApplicationInitialized());
+    REQUIRE_FALSE(application->isApplicationConfigured());
+    REQUIRE_THROWS_AS(application->log("Application is new and not configured", Application::LOG_ERROR),
+                      ApplicationNotConfiguredException);
+    REQUIRE(Application::getInstance() == application);
 }
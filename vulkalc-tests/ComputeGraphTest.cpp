@@ -0,0 +1,132 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <ComputeGraph.hpp>
+#include "catch.hpp"
+
+using namespace Vulkalc;
+using namespace std;
+
+//graph only compares addresses of buffers, so storage without constructed buffers is enough
+static const BufferBase& fakeBuffer(size_t index)
+{
+    alignas(BufferBase) static char storage[8][sizeof(BufferBase)];
+    return *reinterpret_cast<const BufferBase*>(storage[index]);
+}
+
+static Task dispatch(const BufferBase& input, const BufferBase& output)
+{
+    Task task(reinterpret_cast<Shader*>(1), 1);
+    task.bind(input, Task::ACCESS_READ).bind(output, Task::ACCESS_WRITE);
+    return task;
+}
+
+TEST_CASE("Chain of dependent Tasks is synchronized by buffer barriers")
+{
+    ComputeGraph graph;
+    graph.add(Task::fill(fakeBuffer(0), 0));
+    graph.add(dispatch(fakeBuffer(0), fakeBuffer(1)));
+    graph.add(dispatch(fakeBuffer(1), fakeBuffer(2)));
+
+    REQUIRE(graph.getDependencies(1) == vector<size_t>({0}));
+    REQUIRE(graph.getDependencies(2) == vector<size_t>({1}));
+    REQUIRE(graph.compile(1).size() == 1);
+    REQUIRE(graph.getLevelCount() == 3);
+    REQUIRE(graph.getBranchCount() == 1);
+    REQUIRE(graph.getPipelineBarrierCount() == 2);
+    REQUIRE(graph.getBufferBarrierCount() == 2);
+
+    const ComputeGraph::Step& step = graph.compile(1)[0][1];
+    REQUIRE(step.srcStageMask == VK_PIPELINE_STAGE_TRANSFER_BIT);
+    REQUIRE(step.dstStageMask == VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    REQUIRE(step.bufferBarriers[0].buffer == &fakeBuffer(0));
+    REQUIRE(step.bufferBarriers[0].srcAccessMask == VK_ACCESS_TRANSFER_WRITE_BIT);
+    REQUIRE(step.bufferBarriers[0].dstAccessMask == VK_ACCESS_SHADER_READ_BIT);
+}
+
+TEST_CASE("Tasks reading the same buffer are not synchronized")
+{
+    ComputeGraph graph;
+    graph.add(dispatch(fakeBuffer(0), fakeBuffer(1)));
+    graph.add(dispatch(fakeBuffer(0), fakeBuffer(2)));
+    graph.compile(1);
+
+    REQUIRE(graph.getLevelCount() == 1);
+    REQUIRE(graph.getBranchCount() == 2);
+    REQUIRE(graph.getPipelineBarrierCount() == 0);
+}
+
+TEST_CASE("Write after read needs only execution dependency")
+{
+    ComputeGraph graph;
+    graph.add(dispatch(fakeBuffer(0), fakeBuffer(1)));
+    graph.add(dispatch(fakeBuffer(2), fakeBuffer(0)));
+    graph.compile(1);
+
+    REQUIRE(graph.getDependencies(1) == vector<size_t>({0}));
+    REQUIRE(graph.getPipelineBarrierCount() == 1);
+    REQUIRE(graph.getBufferBarrierCount() == 0);
+}
+
+TEST_CASE("Dependency covered by earlier barrier is not synchronized again")
+{
+    ComputeGraph graph;
+    graph.add(dispatch(fakeBuffer(0), fakeBuffer(1)));
+    graph.add(dispatch(fakeBuffer(1), fakeBuffer(2)));
+    Task task(reinterpret_cast<Shader*>(1), 1);
+    task.bind(fakeBuffer(1), Task::ACCESS_READ).bind(fakeBuffer(2), Task::ACCESS_READ)
+            .bind(fakeBuffer(3), Task::ACCESS_WRITE);
+    graph.add(task);
+    graph.compile(1);
+
+    REQUIRE(graph.getDependencies(2) == vector<size_t>({0, 1}));
+    REQUIRE(graph.getPipelineBarrierCount() == 2);
+    REQUIRE(graph.getBufferBarrierCount() == 2);
+}
+
+TEST_CASE("Independent branches are distributed between queues")
+{
+    ComputeGraph graph;
+    for (size_t branch = 0; branch < 2; ++branch)
+    {
+        graph.add(dispatch(fakeBuffer(4 * branch), fakeBuffer(4 * branch + 1)));
+        graph.add(dispatch(fakeBuffer(4 * branch + 1), fakeBuffer(4 * branch + 2)));
+    }
+    REQUIRE_THROWS_AS(graph.compile(0), InvalidArgumentException);
+
+    SECTION("Branches on one queue share barriers")
+    {
+        REQUIRE(graph.compile(1).size() == 1);
+        REQUIRE(graph.compile(1)[0].size() == 2);
+        REQUIRE(graph.getPipelineBarrierCount() == 1);
+        REQUIRE(graph.getBufferBarrierCount() == 2);
+    }
+
+    SECTION("Every branch gets its own queue")
+    {
+        REQUIRE(graph.compile(4).size() == 2);
+        REQUIRE(graph.getBranchCount() == 2);
+        REQUIRE(graph.getPipelineBarrierCount() == 2);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Configurator.hpp>
+#include "catch.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+using namespace Vulkalc;
+using namespace std;
+
+static void setVariable(const char* name, const char* value)
+{
+#ifdef _WIN32
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+static void unsetVariable(const char* name)
+{
+#ifdef _WIN32
+    _putenv_s(name, "");
+#else
+    unsetenv(name);
+#endif
+}
+
+TEST_CASE("Configurator loads settings file")
+{
+    const char* path = "vulkalc-test-settings.ini";
+    {
+        ofstream file(path);
+        file << "# tuned for test machine\n"
+                "[vulkalc]\n"
+                "compute_queue_count = 2\n"
+                "profiling=on\n"
+                "  descriptor_sets_per_pool = 256  \r\n"
+                "enabled_extensions = VK_KHR_a, VK_KHR_b\n"
+                "trace_file =\n"
+                "min_log_level = warn\n"
+                "compute_queue_count = 0\n"
+                "unknown = 1\n"
+                "no separator\n";
+    }
+    Configurator configurator;
+    Configuration* configuration = configurator.getConfiguration();
+    configuration->traceFile = "trace.json";
+    size_t errorCount = configurator.getLoadErrors().size();
+    REQUIRE(configurator.load(path));
+    remove(path);
+
+    REQUIRE(configuration->computeQueueCount == 2);
+    REQUIRE(configuration->isProfilingEnabled);
+    REQUIRE(configuration->descriptorSetsPerPool == 256);
+    REQUIRE(configuration->enabledExtensionsNames.size() == 2);
+    REQUIRE(strcmp(configuration->enabledExtensionsNames[1], "VK_KHR_b") == 0);
+    REQUIRE(configuration->traceFile == nullptr);
+    REQUIRE(configuration->minLogLevel == 1);
+    REQUIRE(configurator.getLoadErrors().size() == errorCount + 3);
+    REQUIRE(configurator.getLoadErrors()[errorCount] ==
+            "vulkalc-test-settings.ini:9: invalid setting compute_queue_count = 0");
+    REQUIRE_FALSE(configurator.load("missing-settings.ini"));
+}
+
+TEST_CASE("Environment variables override settings")
+{
+    setVariable("VULKALC_COMPUTE_QUEUE_COUNT", "3");
+    setVariable("VULKALC_PUSH_DESCRIPTORS", "false");
+    setVariable("VULKALC_METRICS", "maybe");
+    Configurator configurator;
+    unsetVariable("VULKALC_COMPUTE_QUEUE_COUNT");
+    unsetVariable("VULKALC_PUSH_DESCRIPTORS");
+    unsetVariable("VULKALC_METRICS");
+
+    Configuration* configuration = configurator.getConfiguration();
+    REQUIRE(configuration->computeQueueCount == 3);
+    REQUIRE_FALSE(configuration->isPushDescriptorEnabled);
+    REQUIRE(configuration->isMetricsEnabled);
+    REQUIRE(configurator.getLoadErrors().back() == "VULKALC_METRICS: invalid value maybe");
+
+    REQUIRE(configurator.set("device", "1"));
+    REQUIRE(configuration->deviceToUse == 1);
+    REQUIRE_FALSE(configurator.set("device", "-1"));
+    REQUIRE_FALSE(configurator.set("device", "99999999999"));
+    REQUIRE(configuration->deviceToUse == 1);
+}
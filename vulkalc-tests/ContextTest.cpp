@@ -0,0 +1,193 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Context.hpp>
+#include <Application.hpp>
+#include "catch.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("Contexts are configured independently")
+{
+    Context first;
+    Context second;
+    REQUIRE(first.isInitialized());
+    REQUIRE_FALSE(first.isConfigured());
+    REQUIRE_THROWS_AS(first.getRunner(), ApplicationNotConfiguredException);
+    REQUIRE(first.getConfigurator() != second.getConfigurator());
+
+    first.getConfigurator()->getConfiguration()->isMetricsEnabled = false;
+    //tenants may be brought up concurrently
+    thread configuring([&second]() { second.configure(); });
+    REQUIRE_NOTHROW(first.configure());
+    configuring.join();
+
+    REQUIRE(first.isConfigured());
+    REQUIRE(second.isConfigured());
+    REQUIRE(first.getRunner() != second.getRunner());
+    REQUIRE(first.getRunner()->getVkDevice() != second.getRunner()->getVkDevice());
+    REQUIRE(first.getMetrics() == nullptr);
+    REQUIRE(second.getMetrics() != nullptr);
+    REQUIRE(Application::getInstance()->getConfigurator() != first.getConfigurator());
+}
+
+TEST_CASE("Deleted Context is never touched by remaining ones")
+{
+    stringstream stream;
+    Context* deleted = new Context();
+    Context remaining;
+    remaining.getConfigurator()->getConfiguration()->logStream = &stream;
+    deleted->configure();
+    remaining.configure();
+    Runner* runner = remaining.getRunner();
+    delete deleted;
+
+    //remaining Context keeps its own Runner, Logger and Configurator
+    REQUIRE(remaining.isConfigured());
+    REQUIRE(remaining.getRunner() == runner);
+    REQUIRE_NOTHROW(remaining.log("after delete", Context::LOG_INFO));
+    Application* application = Application::getInstance();
+    REQUIRE(application->getConfigurator() != nullptr);
+    REQUIRE(application->getConfigurator() != remaining.getConfigurator());
+}
+
+TEST_CASE("Configurator publishes immutable snapshots")
+{
+    Configurator configurator;
+    REQUIRE(Configurator::Reader(configurator).get() == nullptr);
+
+    configurator.getConfiguration()->minLogLevel = 1;
+    const Configuration* first = configurator.publish();
+    Configurator::Reader reader(configurator);
+    REQUIRE(reader.get() == first);
+    REQUIRE(reader.get() != configurator.getConfiguration());
+
+    //draft is edited and published again, while snapshot is still read
+    configurator.getConfiguration()->minLogLevel = 2;
+    REQUIRE(reader->minLogLevel == 1);
+    const Configuration* second = configurator.publish();
+    REQUIRE(Configurator::Reader(configurator)->minLogLevel == 2);
+    REQUIRE(reader->minLogLevel == 1);
+    REQUIRE(second != first);
+}
+
+TEST_CASE("Snapshots are replaced while Readers on other threads read them")
+{
+    Configurator configurator;
+    configurator.publish();
+    atomic<bool> isPublishing(true);
+    atomic<int> invalidReadCount(0);
+    vector<thread> readers;
+    //Catch assertions aren't thread-safe, so readers only count what they saw
+    for (int i = 0; i < 4; ++i)
+        readers.push_back(thread([&configurator, &isPublishing, &invalidReadCount]()
+        {
+            while (isPublishing)
+            {
+                Configurator::Reader reader(configurator);
+                if (reader->minLogLevel >= 1000)
+                    ++invalidReadCount;
+            }
+        }));
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        configurator.getConfiguration()->minLogLevel = i;
+        configurator.publish();
+    }
+    isPublishing = false;
+    for (auto& reader : readers)
+        reader.join();
+    REQUIRE(invalidReadCount == 0);
+    REQUIRE(Configurator::Reader(configurator)->minLogLevel == 999);
+}
+
+TEST_CASE("Context applies reconfiguration at runtime")
+{
+    stringstream stream;
+    Context context;
+    REQUIRE_THROWS_AS(context.reconfigure(), ApplicationNotConfiguredException);
+    Configuration* configuration = context.getConfigurator()->getConfiguration();
+    configuration->logStream = &stream;
+    context.configure();
+    REQUIRE_FALSE(context.getRunner()->isProfilingEnabled());
+
+    configuration->minLogLevel = Context::LOG_ERROR;
+    configuration->isProfilingEnabled = true;
+    thread logging([&context]()
+    {
+        for (int i = 0; i < 1000; ++i)
+            context.log("message", Context::LOG_INFO);
+    });
+    REQUIRE_NOTHROW(context.reconfigure());
+    logging.join();
+    REQUIRE(Configurator::Reader(*context.getConfigurator())->minLogLevel == Context::LOG_ERROR);
+    if (context.getRunner()->isProfilingSupported())
+        REQUIRE(context.getRunner()->isProfilingEnabled());
+
+    //messages below new level don't reach stream, messages above it still do
+    Logger* logger = context.getRunner()->getLogger();
+    logger->flush();
+    size_t length = stream.str().size();
+    context.log("filtered", Context::LOG_INFO);
+    logger->flush();
+    REQUIRE(stream.str().size() == length);
+    context.log("passed", Context::LOG_ERROR);
+    logger->flush();
+    REQUIRE(stream.str().find("passed", length) != string::npos);
+    REQUIRE(stream.str().find("filtered") == string::npos);
+}
+
+TEST_CASE("Instance profiles enable only available layers and extensions")
+{
+    Context context;
+    Configuration* configuration = context.getConfigurator()->getConfiguration();
+    configuration->enabledLayersNames.push_back("VK_LAYER_missing");
+    configuration->enabledExtensionsNames.push_back("VK_KHR_missing");
+    vector<const char*> layers;
+    vector<const char*> extensions;
+    Context::selectInstanceProfile(*configuration, layers, extensions);
+    REQUIRE(layers.size() == 1);
+    REQUIRE(extensions.size() == 1);
+
+    configuration->profile = Configuration::PROFILE_DEBUG;
+    configuration->enabledExtensionsNames.push_back("VK_KHR_get_physical_device_properties2");
+    Context::selectInstanceProfile(*configuration, layers, extensions);
+    for (const char* layer : layers)
+        REQUIRE(VulkanInfo::getInstance()->isLayerSupported(layer));
+    REQUIRE(extensions.size() == (VulkanInfo::getInstance()->isInstanceExtensionSupported(
+            "VK_KHR_get_physical_device_properties2") ? 1 : 0));
+
+    configuration->profile = Configuration::PROFILE_PROFILING;
+    REQUIRE(context.getInstanceCreationTime() == 0);
+    context.configure();
+    REQUIRE(context.getInstanceCreationTime() > 0);
+    REQUIRE(context.getRunner()->isProfilingEnabled() == (context.getRunner()->getProfiler() != nullptr));
+    //draft keeps requested lists, only VkInstance is created with selected ones
+    REQUIRE(configuration->enabledLayersNames.size() == 1);
+}
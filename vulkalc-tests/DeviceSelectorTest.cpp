@@ -0,0 +1,91 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <DeviceSelector.hpp>
+#include <Context.hpp>
+#include "catch.hpp"
+#include <cstdio>
+
+using namespace Vulkalc;
+using namespace std;
+
+static VulkanInfo::PhysicalDeviceInfo makeDeviceInfo(VkPhysicalDeviceType type, VkDeviceSize localMemorySize)
+{
+    VulkanInfo::PhysicalDeviceInfo info = VulkanInfo::PhysicalDeviceInfo();
+    info.properties.deviceType = type;
+    info.properties.limits.maxComputeWorkGroupInvocations = 1024;
+    info.properties.limits.maxComputeSharedMemorySize = 32768;
+    info.memoryProperties.memoryHeapCount = 1;
+    info.memoryProperties.memoryHeaps[0].size = localMemorySize;
+    info.memoryProperties.memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    VkQueueFamilyProperties queueFamily = VkQueueFamilyProperties();
+    queueFamily.queueFlags = VK_QUEUE_COMPUTE_BIT;
+    queueFamily.queueCount = 1;
+    info.queueFamilies.push_back(queueFamily);
+    return info;
+}
+
+TEST_CASE("DeviceSelector scores devices by type, memory and compute limits")
+{
+    VulkanInfo::PhysicalDeviceInfo discrete = makeDeviceInfo(VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 1ull << 30);
+    VulkanInfo::PhysicalDeviceInfo integrated = makeDeviceInfo(VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU, 16ull << 30);
+    VulkanInfo::PhysicalDeviceInfo software = makeDeviceInfo(VK_PHYSICAL_DEVICE_TYPE_CPU, 64ull << 30);
+    REQUIRE(DeviceSelector::getScore(discrete) > DeviceSelector::getScore(integrated));
+    REQUIRE(DeviceSelector::getScore(integrated) > DeviceSelector::getScore(software));
+
+    VulkanInfo::PhysicalDeviceInfo bigger = makeDeviceInfo(VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8ull << 30);
+    REQUIRE(DeviceSelector::getScore(bigger) > DeviceSelector::getScore(discrete));
+    bigger.properties.limits.maxComputeSharedMemorySize = 65536;
+    REQUIRE(DeviceSelector::getScore(bigger) > DeviceSelector::getScore(
+            makeDeviceInfo(VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, 8ull << 30)));
+
+    software.queueFamilies[0].queueFlags = VK_QUEUE_TRANSFER_BIT;
+    REQUIRE(DeviceSelector::getScore(software) == 0);
+}
+
+TEST_CASE("DeviceSelector caches measured bandwidth in tuning database")
+{
+    const char* path = "vulkalc-test-device-tuning.txt";
+    remove(path);
+    Context context;
+    Configuration* configuration = context.getConfigurator()->getConfiguration();
+    configuration->tuningFile = path;
+    configuration->isDeviceAutoSelected = true;
+    configuration->isDeviceBenchmarkEnabled = true;
+    context.configure();
+
+    TuningDatabase database;
+    REQUIRE(database.load(path));
+    TuningDatabase::KernelParameters parameters = database.getKernelParameters(context.getRunner()->getDeviceKey());
+    REQUIRE(parameters[DeviceSelector::DEVICE_KERNEL][DeviceSelector::COPY_BANDWIDTH_PARAMETER] > 0);
+    //cached bandwidth is used, so the same device is selected without measuring again
+    Context second;
+    Configuration* secondConfiguration = second.getConfigurator()->getConfiguration();
+    secondConfiguration->tuningFile = path;
+    secondConfiguration->isDeviceAutoSelected = true;
+    secondConfiguration->isDeviceBenchmarkEnabled = true;
+    second.configure();
+    REQUIRE(second.getRunner()->getVkPhysicalDevice() == context.getRunner()->getVkPhysicalDevice());
+    remove(path);
+}
@@ -23,8 +23,10 @@
 */
 
 #include <Exceptions.h>
+#include <Expected.hpp>
 #include "catch.hpp"
 #include <cstring>
+#include <string>
 
 using namespace Vulkalc;
 using namespace std;
@@ -90,3 +92,42 @@ TEST_CASE("Exception messages are polymorphic")
         }
     }
 }
+
+TEST_CASE("Exception message is copied")
+{
+    string message = "temporary message";
+    Exception exception(message.c_str());
+    message.assign(message.size(), 'x');
+    REQUIRE(strcmp(exception.what(), "Exception in Vulkalc Application: temporary message") == 0);
+
+    Exception longException(string(2 * Exception::MAX_MESSAGE_LENGTH, 'y').c_str());
+    REQUIRE(strlen(longException.what()) == Exception::MAX_MESSAGE_LENGTH - 1);
+}
+
+TEST_CASE("Expected contains either value or Error")
+{
+    Expected<int> value(42);
+    REQUIRE(value.hasValue());
+    REQUIRE(value.valueOrThrow() == 42);
+    REQUIRE(value.getError().code == ERROR_NONE);
+
+    Expected<int> error(Error(ERROR_VULKAN, "Device lost", VK_ERROR_DEVICE_LOST));
+    REQUIRE_FALSE(error);
+    REQUIRE(error.getError().result == VK_ERROR_DEVICE_LOST);
+    try
+    {
+        error.valueOrThrow();
+        FAIL("VulkanException is not thrown");
+    }
+    catch (VulkanException& e)
+    {
+        REQUIRE(e.getResult() == VK_ERROR_DEVICE_LOST);
+        REQUIRE(e.getErrorCode() == ERROR_VULKAN);
+        REQUIRE(strcmp(e.what(), "Exception in Vulkalc Application: Device lost") == 0);
+    }
+
+    REQUIRE_NOTHROW(Expected<void>().valueOrThrow());
+    REQUIRE_THROWS_AS(Expected<void>(Error(ERROR_INVALID_ARGUMENT, "test")).valueOrThrow(), InvalidArgumentException);
+    REQUIRE_THROWS_AS(Expected<void>(Error(ERROR_SHADER_COMPILATION, "test")).valueOrThrow(),
+                      ShaderCompilationException);
+}
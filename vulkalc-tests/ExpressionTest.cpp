@@ -0,0 +1,121 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Expression.hpp>
+#include "catch.hpp"
+#include <utility>
+
+using namespace Vulkalc;
+using namespace std;
+
+//program doesn't dereference buffers until Task is created, so addresses are enough to identify them
+static const BufferBase* fakeBuffer(int index)
+{
+    return reinterpret_cast<const BufferBase*>(static_cast<uintptr_t>(index + 1) * 64);
+}
+
+static uint8_t instruction(ExpressionProgram::OPCODE opcode, uint8_t argument = 0)
+{
+    return static_cast<uint8_t>((opcode << 4) | argument);
+}
+
+TEST_CASE("Expression operators build expression tree")
+{
+    typedef BufferExpression<float> Load;
+    typedef BinaryExpression<float, ExpressionProgram::OPCODE_MULTIPLY, Load, Load> Multiply;
+    typedef BinaryExpression<float, ExpressionProgram::OPCODE_ADD, Multiply, ConstantExpression<float>> Add;
+
+    REQUIRE((is_same<decltype(declval<Buffer<float>&>() * declval<Buffer<float>&>()), Multiply>::value));
+    REQUIRE((is_same<decltype(declval<Buffer<float>&>() * declval<Buffer<float>&>() + 1.0f), Add>::value));
+    REQUIRE((is_same<decltype(-declval<Buffer<float>&>()), NegateExpression<float, Load>>::value));
+}
+
+TEST_CASE("Expression program is built in postfix order")
+{
+    ExpressionProgram program;
+    program.pushOperand(fakeBuffer(0), 16);
+    program.pushOperand(fakeBuffer(1), 16);
+    program.pushOperation(ExpressionProgram::OPCODE_MULTIPLY);
+    program.pushOperand(fakeBuffer(0), 16);
+    program.pushConstant(42);
+    program.pushOperation(ExpressionProgram::OPCODE_SUBTRACT);
+    program.pushOperation(ExpressionProgram::OPCODE_ADD);
+
+    SECTION("The same buffer is bound once")
+    {
+        REQUIRE(program.getOperands().size() == 2);
+        REQUIRE(program.getOperands()[0] == fakeBuffer(0));
+        REQUIRE(program.getOperands()[1] == fakeBuffer(1));
+    }
+
+    SECTION("Instructions reference operands and constants")
+    {
+        vector<uint8_t> expected = {instruction(ExpressionProgram::OPCODE_LOAD, 0),
+                                    instruction(ExpressionProgram::OPCODE_LOAD, 1),
+                                    instruction(ExpressionProgram::OPCODE_MULTIPLY),
+                                    instruction(ExpressionProgram::OPCODE_LOAD, 0),
+                                    instruction(ExpressionProgram::OPCODE_CONSTANT, 0),
+                                    instruction(ExpressionProgram::OPCODE_SUBTRACT),
+                                    instruction(ExpressionProgram::OPCODE_ADD)};
+        REQUIRE(program.getInstructions() == expected);
+        REQUIRE(program.getConstants() == vector<uint32_t>(1, 42));
+    }
+}
+
+TEST_CASE("Expression program limits are checked")
+{
+    ExpressionProgram program;
+
+    SECTION("Too many buffers")
+    {
+        for (uint32_t i = 0; i < ExpressionProgram::MAX_OPERANDS; ++i)
+        {
+            program.pushOperand(fakeBuffer(i), 16);
+            if (i > 0)
+                program.pushOperation(ExpressionProgram::OPCODE_ADD);
+        }
+        REQUIRE_THROWS_AS(program.pushOperand(fakeBuffer(ExpressionProgram::MAX_OPERANDS), 16),
+                          InvalidArgumentException);
+    }
+
+    SECTION("Too deep nesting")
+    {
+        for (uint32_t i = 0; i < ExpressionProgram::MAX_STACK_DEPTH; ++i)
+            program.pushConstant(i);
+        REQUIRE_THROWS_AS(program.pushConstant(0), InvalidArgumentException);
+    }
+
+    SECTION("Operation without operands")
+    {
+        program.pushConstant(0);
+        REQUIRE_THROWS_AS(program.pushOperation(ExpressionProgram::OPCODE_ADD), InvalidArgumentException);
+    }
+
+    SECTION("Incomplete program can't be evaluated")
+    {
+        program.pushConstant(0);
+        program.pushConstant(1);
+        REQUIRE_THROWS_AS(program.createTask("fused_float", *fakeBuffer(0), 16), InvalidArgumentException);
+    }
+}
@@ -0,0 +1,76 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Runner.hpp>
+#include <Buffer.hpp>
+#include "catch.hpp"
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("InformationProvider tracks allocations of buffers")
+{
+    VkInstanceCreateInfo instanceCreateInfo = {};
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    VkInstance instance = VK_NULL_HANDLE;
+    REQUIRE(vkCreateInstance(&instanceCreateInfo, nullptr, &instance) == VK_SUCCESS);
+    Configuration configuration;
+    Runner* runner = new Runner(instance, &configuration);
+    InformationProvider* provider = runner->getInformationProvider();
+    REQUIRE(provider != nullptr);
+    REQUIRE(provider->getHeapCount() > 0);
+    REQUIRE_THROWS_AS(provider->getHeapBudget(provider->getHeapCount()), InvalidArgumentException);
+    REQUIRE_THROWS_AS(provider->setWatermark(1.5, [](uint32_t, const InformationProvider::HeapBudget&) {}),
+                      InvalidArgumentException);
+
+    VkDeviceSize trackedUsage = 0;
+    for (auto& budget : provider->getHeapBudgets())
+        trackedUsage += budget.trackedUsage;
+
+    uint32_t crossings = 0;
+    provider->setWatermark(1e-9, [&crossings](uint32_t, const InformationProvider::HeapBudget& budget)
+    {
+        REQUIRE(budget.usage >= budget.budget * 1e-9);
+        ++crossings;
+    });
+    {
+        Buffer<float> buffer(runner, 1024);
+        VkDeviceSize usage = 0;
+        for (auto& budget : provider->getHeapBudgets())
+            usage += budget.trackedUsage;
+        REQUIRE(usage >= trackedUsage + 1024 * sizeof(float));
+        REQUIRE(crossings == 1);
+        Buffer<float> another(runner, 1024);
+        REQUIRE(crossings == 1);
+    }
+    provider->setWatermark(0.0, InformationProvider::WatermarkCallback());
+
+    VkDeviceSize usage = 0;
+    for (auto& budget : provider->getHeapBudgets())
+        usage += budget.trackedUsage;
+    REQUIRE(usage == trackedUsage);
+
+    delete runner;
+    vkDestroyInstance(instance, nullptr);
+}
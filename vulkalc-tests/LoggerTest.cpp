@@ -0,0 +1,147 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Logger.hpp>
+#include "catch.hpp"
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("Logger writes queued messages after flush()")
+{
+    stringstream log, errors;
+    Logger logger("test ", &log, &errors);
+    REQUIRE(logger.log(Logger::LEVEL_INFO, "first"));
+    REQUIRE(logger.log(Logger::LEVEL_ERROR, "second"));
+    logger.flush();
+
+    REQUIRE(logger.getWrittenCount() == 2);
+    REQUIRE(log.str().find("test INFO: first\n") != string::npos);
+    REQUIRE(log.str().find("second") == string::npos);
+    REQUIRE(errors.str().find("test ERROR: second\n") != string::npos);
+}
+
+/*
+ * Counts flushes of stream to check that they happen before Logger::flush() returns
+ */
+class CountingBuffer : public stringbuf
+{
+public:
+    atomic<int> syncCount{0};
+
+protected:
+    virtual int sync() override
+    {
+        ++syncCount;
+        return stringbuf::sync();
+    }
+};
+
+TEST_CASE("Logger flushes streams before flush() returns")
+{
+    CountingBuffer buffer;
+    iostream log(&buffer);
+    Logger logger("", &log, nullptr);
+    logger.flush();
+    REQUIRE(logger.log(Logger::LEVEL_INFO, "message"));
+    logger.flush();
+    //background thread doesn't touch stream after flush() until next message
+    int syncCount = buffer.syncCount;
+    REQUIRE(syncCount > 0);
+    REQUIRE(buffer.str().find("INFO: message\n") != string::npos);
+    this_thread::sleep_for(chrono::milliseconds(20));
+    REQUIRE(buffer.syncCount == syncCount);
+}
+
+TEST_CASE("Logger skips messages without stream")
+{
+    stringstream log;
+    Logger logger("", &log, nullptr);
+    logger.log(Logger::LEVEL_ERROR, "error");
+    logger.flush();
+    REQUIRE(log.str().empty());
+}
+
+TEST_CASE("Logger drops messages instead of blocking when ring buffer is full")
+{
+    stringstream log;
+    const unsigned producerCount = 4, messageCount = 1000;
+    {
+        Logger logger("", &log, nullptr, 16);
+        vector<thread> producers;
+        for (unsigned i = 0; i < producerCount; ++i)
+            producers.push_back(thread([&logger]()
+            {
+                for (unsigned j = 0; j < messageCount; ++j)
+                    logger.log(Logger::LEVEL_WARN, "message");
+            }));
+        for (auto& producer : producers)
+            producer.join();
+        logger.flush();
+        REQUIRE(logger.getWrittenCount() + logger.getDroppedCount() == producerCount * messageCount);
+    }
+
+    size_t lineCount = 0;
+    string line;
+    while (getline(log, line))
+    {
+        REQUIRE(line.find("WARNING: message") != string::npos);
+        ++lineCount;
+    }
+    REQUIRE(lineCount > 0);
+}
+
+TEST_CASE("Long messages are truncated")
+{
+    stringstream log;
+    Logger logger("", &log, nullptr);
+    logger.log(Logger::LEVEL_INFO, string(2 * Logger::MAX_MESSAGE_LENGTH, 'x').c_str());
+    logger.flush();
+    REQUIRE(log.str().find(string(Logger::MAX_MESSAGE_LENGTH, 'x') + "\n") != string::npos);
+    REQUIRE(log.str().find(string(Logger::MAX_MESSAGE_LENGTH + 1, 'x')) == string::npos);
+}
+
+TEST_CASE("Fields are written after message")
+{
+    stringstream log;
+    Logger logger("", &log, &log);
+    string kernel = "histogram";
+    VULKALC_LOG_INFO(&logger, "dispatch", {"kernel", kernel}, {"size", size_t(65536)}, {"offset", -4},
+                     {"milliseconds", 1.5});
+    VULKALC_LOG_ERROR(&logger, "failed");
+    logger.flush();
+
+    REQUIRE(log.str().find("INFO: dispatch kernel=histogram size=65536 offset=-4 milliseconds=1.5\n") != string::npos);
+    REQUIRE(log.str().find("ERROR: failed\n") != string::npos);
+}
+
+TEST_CASE("Logging macros ignore nullptr Logger")
+{
+    Logger* logger = nullptr;
+    VULKALC_LOG_WARN(logger, "nothing", {"value", 1});
+    SUCCEED("nullptr Logger is ignored");
+}
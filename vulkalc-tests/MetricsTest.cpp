@@ -0,0 +1,128 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Metrics.hpp>
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("Counter sums increments of all threads")
+{
+    Metrics metrics;
+    Counter& counter = metrics.getCounter("vulkalc_test_total", "Test counter");
+    REQUIRE(&metrics.getCounter("vulkalc_test_total") == &counter);
+
+    vector<thread> threads;
+    for (int i = 0; i < 8; ++i)
+        threads.push_back(thread([&counter]()
+                                 {
+                                     for (int j = 0; j < 1000; ++j)
+                                         counter.add();
+                                 }));
+    for (auto& producer : threads)
+        producer.join();
+    counter.add(5);
+    REQUIRE(counter.get() == 8005);
+}
+
+TEST_CASE("LatencyHistogram keeps relative error of percentiles")
+{
+    REQUIRE(LatencyHistogram::getBucketIndex(15) == 15);
+    REQUIRE(LatencyHistogram::getBucketUpperBound(LatencyHistogram::getBucketIndex(16)) == 17);
+    REQUIRE(LatencyHistogram::getBucketUpperBound(LatencyHistogram::getBucketIndex(1000)) == 1024);
+    REQUIRE(LatencyHistogram::getBucketIndex(~0ull) == LatencyHistogram::BUCKET_COUNT - 1);
+
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value)
+        histogram.record(value * 1000);
+    LatencyHistogram::Snapshot snapshot = histogram.getSnapshot();
+    REQUIRE(snapshot.count == 100000);
+    REQUIRE(snapshot.sum == 100000ull * 100001ull / 2 * 1000);
+    REQUIRE(snapshot.getPercentile(50.0) >= 50000000ull);
+    REQUIRE(snapshot.getPercentile(50.0) < 50000000ull * 17 / 16);
+    REQUIRE(snapshot.getPercentile(99.0) >= 99000000ull);
+    REQUIRE(snapshot.getPercentile(99.0) < 99000000ull * 17 / 16);
+    REQUIRE(LatencyHistogram::Snapshot().getPercentile(99.0) == 0);
+}
+
+TEST_CASE("Metrics are written in Prometheus text format")
+{
+    Metrics metrics;
+    metrics.getCounter("vulkalc_submits_total", "Command buffers\nsubmitted").add(3);
+    metrics.getGauge("vulkalc_buffer_bytes").set(-4);
+    LatencyHistogram& histogram = metrics.getHistogram("vulkalc_wait_seconds", "Wait");
+    histogram.record(1500);
+    histogram.record(3000000000ull);
+    REQUIRE_THROWS_AS(metrics.getGauge("vulkalc_submits_total"), InvalidArgumentException);
+    REQUIRE_THROWS_AS(metrics.getCounter("vulkalc submits"), InvalidArgumentException);
+
+    Metrics::Snapshot snapshot = metrics.getSnapshot();
+    REQUIRE(snapshot.counters.size() == 1);
+    REQUIRE(snapshot.counters[0].value == 3.0);
+    REQUIRE(snapshot.histograms[0].histogram.count == 2);
+
+    stringstream stream;
+    metrics.writePrometheus(stream);
+    string text = stream.str();
+    REQUIRE(text.find("# HELP vulkalc_submits_total Command buffers\\nsubmitted\n"
+                      "# TYPE vulkalc_submits_total counter\nvulkalc_submits_total 3\n") != string::npos);
+    REQUIRE(text.find("# TYPE vulkalc_buffer_bytes gauge\nvulkalc_buffer_bytes -4\n") != string::npos);
+    REQUIRE(text.find("vulkalc_wait_seconds_bucket{le=\"1.024e-06\"} 0\n") != string::npos);
+    REQUIRE(text.find("vulkalc_wait_seconds_bucket{le=\"2.048e-06\"} 1\n") != string::npos);
+    REQUIRE(text.find("vulkalc_wait_seconds_bucket{le=\"2.14748365\"} 1\n") != string::npos);
+    REQUIRE(text.find("vulkalc_wait_seconds_bucket{le=\"4.2949673\"} 2\n") != string::npos);
+    REQUIRE(text.find("vulkalc_wait_seconds_bucket{le=\"+Inf\"} 2\nvulkalc_wait_seconds_sum 3.0000015\n"
+                      "vulkalc_wait_seconds_count 2\n") != string::npos);
+}
+
+TEST_CASE("Metrics file is replaced by concurrent writers")
+{
+    const char* path = "vulkalc-test-metrics.prom";
+    Metrics metrics;
+    metrics.getCounter("vulkalc_test_total", "Test counter").add(5);
+    stringstream expected;
+    metrics.writePrometheus(expected);
+
+    vector<thread> writers;
+    for (int i = 0; i < 4; ++i)
+        writers.push_back(thread([&metrics, path]()
+        {
+            for (int j = 0; j < 50; ++j)
+                metrics.writePrometheus(path);
+        }));
+    for (auto& writer : writers)
+        writer.join();
+
+    stringstream written;
+    written << ifstream(path).rdbuf();
+    remove(path);
+    REQUIRE(written.str() == expected.str());
+    REQUIRE_THROWS_AS(metrics.writePrometheus(static_cast<const char*>(nullptr)), InvalidArgumentException);
+}
@@ -0,0 +1,86 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Profiler.hpp>
+#include <Context.hpp>
+#include <Buffer.hpp>
+#include "catch.hpp"
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("Profiler aggregates every measured Task")
+{
+    Context context;
+    context.getConfigurator()->getConfiguration()->isProfilingEnabled = true;
+    context.configure();
+    Runner* runner = context.getRunner();
+    if (!runner->isProfilingSupported())
+        return;
+    REQUIRE(runner->isProfilingEnabled());
+    Buffer<uint32_t> buffer(runner, 16);
+    for (uint32_t i = 0; i < 10; ++i)
+        runner->execute(Task::fill(buffer, i));
+
+    map<string, Profiler::KernelStatistics> statistics = runner->getProfiler()->getStatistics();
+    REQUIRE(statistics.size() == 1);
+    const Profiler::KernelStatistics& fill = statistics["fill"];
+    REQUIRE(fill.count == 10);
+    REQUIRE(fill.minMicroseconds >= 0.0);
+    REQUIRE(fill.minMicroseconds <= fill.meanMicroseconds);
+    REQUIRE(fill.meanMicroseconds <= fill.p99Microseconds);
+    REQUIRE(fill.totalMicroseconds == Approx(fill.meanMicroseconds * 10));
+    REQUIRE(runner->getProfiler()->getLastSamples().size() == 1);
+
+    runner->getProfiler()->reset();
+    REQUIRE(runner->getProfiler()->getStatistics().empty());
+}
+
+TEST_CASE("Profiler reuses queries beyond one pool")
+{
+    Context context;
+    context.getConfigurator()->getConfiguration()->isProfilingEnabled = true;
+    context.configure();
+    Runner* runner = context.getRunner();
+    if (!runner->isProfilingSupported())
+        return;
+    Buffer<uint32_t> source(runner, 16);
+    Buffer<uint32_t> destination(runner, 16);
+    //every Task takes two queries, so one execution spans two pools
+    vector<Task> tasks;
+    for (uint32_t i = 0; i < Profiler::QUERIES_PER_POOL; ++i)
+        tasks.push_back(i % 2 == 0 ? Task::fill(source, i) : Task::copy(source, destination));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        runner->execute(tasks);
+        const vector<Profiler::Sample>& samples = runner->getProfiler()->getLastSamples();
+        REQUIRE(samples.size() == tasks.size());
+        REQUIRE(string(samples.front().name) == "fill");
+        REQUIRE(string(samples.back().name) == "copy");
+    }
+    map<string, Profiler::KernelStatistics> statistics = runner->getProfiler()->getStatistics();
+    REQUIRE(statistics["fill"].count == 3 * Profiler::QUERIES_PER_POOL / 2);
+    REQUIRE(statistics["copy"].count == 3 * Profiler::QUERIES_PER_POOL / 2);
+}
@@ -0,0 +1,94 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <ShaderCompiler.hpp>
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace Vulkalc;
+using namespace std;
+
+static const string SOURCE = "#version 450\nlayout(local_size_x = 64) in;\nvoid main() {}\n";
+
+TEST_CASE("Shader cache key depends on source and defines")
+{
+    vector<string> defines = {"VALUE_TYPE=float"};
+    REQUIRE(ShaderCompiler::getCacheKey(SOURCE, defines) == ShaderCompiler::getCacheKey(SOURCE, defines));
+    REQUIRE(ShaderCompiler::getCacheKey(SOURCE, defines).size() == 16);
+    REQUIRE(ShaderCompiler::getCacheKey(SOURCE, defines) != ShaderCompiler::getCacheKey(SOURCE, {}));
+    REQUIRE(ShaderCompiler::getCacheKey(SOURCE, defines) != ShaderCompiler::getCacheKey(SOURCE + " ", defines));
+    REQUIRE(ShaderCompiler::getCacheKey(SOURCE, {"AB", "C"}) != ShaderCompiler::getCacheKey(SOURCE, {"A", "BC"}));
+}
+
+TEST_CASE("Cached shader is loaded without compilation")
+{
+    vector<string> defines = {"CACHE_TEST"};
+    string path = "./" + ShaderCompiler::getCacheKey(SOURCE, defines) + ".spv";
+    //cached code is followed by its word count
+    uint32_t spirv[] = {0x07230203, 0x00010000, 0, 1, 0, 5};
+    {
+        ofstream file(path.c_str(), ios::binary);
+        file.write(reinterpret_cast<const char*>(spirv), sizeof(spirv));
+    }
+
+    ShaderCompiler compiler(".");
+    vector<uint32_t> code = compiler.compile(SOURCE, defines);
+    remove(path.c_str());
+
+    REQUIRE(code == vector<uint32_t>(spirv, spirv + 5));
+    REQUIRE(compiler.getStatistics().requestCount == 1);
+    REQUIRE(compiler.getStatistics().cacheHitCount == 1);
+    REQUIRE(compiler.getStatistics().compileCount == 0);
+}
+
+TEST_CASE("Truncated cached shader is not loaded")
+{
+    vector<string> defines = {"TRUNCATED_CACHE_TEST"};
+    string path = "./" + ShaderCompiler::getCacheKey(SOURCE, defines) + ".spv";
+    //word count of 6 words doesn't match 4 words of code written before it
+    uint32_t spirv[] = {0x07230203, 0x00010000, 0, 1, 6};
+    {
+        ofstream file(path.c_str(), ios::binary);
+        file.write(reinterpret_cast<const char*>(spirv), sizeof(spirv));
+    }
+
+    ShaderCompiler compiler(".");
+    if (ShaderCompiler::isCompilationSupported())
+        REQUIRE(compiler.compile(SOURCE, defines).size() > 5);
+    else
+        REQUIRE_THROWS_AS(compiler.compile(SOURCE, defines), ShaderCompilationException);
+    remove(path.c_str());
+    REQUIRE(compiler.getStatistics().cacheHitCount == 0);
+}
+
+TEST_CASE("Shader is not compiled without runtime compiler")
+{
+    if (ShaderCompiler::isCompilationSupported())
+        return;
+    ShaderCompiler compiler(nullptr);
+    REQUIRE_THROWS_AS(compiler.compile(SOURCE, {}), ShaderCompilationException);
+    REQUIRE(compiler.getStatistics().cacheHitCount == 0);
+}
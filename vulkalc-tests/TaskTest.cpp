@@ -0,0 +1,167 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Task.hpp>
+#include <Histogram.hpp>
+#include <Recording.hpp>
+#include <Context.hpp>
+#include <Buffer.hpp>
+#include <VulkanInfo.hpp>
+#include "catch.hpp"
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("Dispatch Task requires Shader")
+{
+    REQUIRE_THROWS_AS(Task(nullptr, 1), InvalidArgumentException);
+}
+
+TEST_CASE("Task push constants are limited")
+{
+    Shader* shader = reinterpret_cast<Shader*>(1);
+    Task task(shader, 4, 2);
+    REQUIRE(task.getType() == Task::TYPE_DISPATCH);
+    REQUIRE(task.getGroupCount(0) == 4);
+    REQUIRE(task.getGroupCount(1) == 2);
+    REQUIRE(task.getGroupCount(2) == 1);
+
+    SECTION("Push constants are copied")
+    {
+        uint32_t values[2] = {1, 2};
+        REQUIRE_NOTHROW(task.setPushConstants(values));
+        REQUIRE(task.getPushConstantsSize() == sizeof(values));
+        REQUIRE(static_cast<const uint32_t*>(task.getPushConstants())[1] == 2);
+    }
+
+    SECTION("Push constants bigger than guaranteed by Vulkan are rejected")
+    {
+        uint8_t values[Task::MAX_PUSH_CONSTANTS_SIZE + 4] = {};
+        REQUIRE_THROWS_AS(task.setPushConstants(values, sizeof(values)), InvalidArgumentException);
+    }
+
+    SECTION("Push constants must be aligned to 4 bytes")
+    {
+        uint8_t values[3] = {};
+        REQUIRE_THROWS_AS(task.setPushConstants(values, sizeof(values)), InvalidArgumentException);
+    }
+}
+
+TEST_CASE("Task specialization constants are overwritten")
+{
+    Task task(reinterpret_cast<Shader*>(1), 1);
+    task.setSpecializationConstant(1, 16).setSpecializationConstant(1, 32);
+    REQUIRE(task.getSpecializationConstants().size() == 1);
+    REQUIRE(task.getSpecializationConstants().at(1) == 32);
+}
+
+TEST_CASE("Histogram requires Runner")
+{
+    REQUIRE_THROWS_AS(Histogram(nullptr, 256, 0.0f, 1.0f), InvalidArgumentException);
+}
+
+TEST_CASE("Recording requires Runner")
+{
+    REQUIRE_THROWS_AS(Recording(nullptr, vector<Task>()), InvalidArgumentException);
+}
+
+/*
+ * Hand-assembled module of kernel, which does nothing:
+ * layout(local_size_x = 1) in; layout(binding = 0) buffer Data { uint data[]; };
+ */
+static vector<uint32_t> createModule()
+{
+    return {
+            0x07230203, 0x00010000, 0, 12, 0,
+            (2 << 16) | 17, 1,
+            (3 << 16) | 14, 0, 1,
+            (5 << 16) | 15, 5, 1, 0x6E69616D, 0,
+            (6 << 16) | 16, 1, 17, 1, 1, 1,
+            (3 << 16) | 71, 6, 3,
+            (5 << 16) | 72, 6, 0, 35, 0,
+            (4 << 16) | 71, 5, 6, 4,
+            (4 << 16) | 71, 8, 34, 0,
+            (4 << 16) | 71, 8, 33, 0,
+            (2 << 16) | 19, 2,
+            (3 << 16) | 33, 3, 2,
+            (4 << 16) | 21, 4, 32, 0,
+            (3 << 16) | 29, 5, 4,
+            (3 << 16) | 30, 6, 5,
+            (4 << 16) | 32, 7, 2, 6,
+            (4 << 16) | 59, 7, 8, 2,
+            (5 << 16) | 54, 2, 1, 0, 3,
+            (2 << 16) | 248, 9,
+            (1 << 16) | 253,
+            (1 << 16) | 56
+    };
+}
+
+TEST_CASE("Dispatches take descriptor sets from growing pools or push them")
+{
+    Context context;
+    Configuration* configuration = context.getConfigurator()->getConfiguration();
+    configuration->descriptorSetsPerPool = 4;
+    //push descriptors require this instance extension
+    if (VulkanInfo::getInstance()->isInstanceExtensionSupported("VK_KHR_get_physical_device_properties2"))
+        configuration->enabledExtensionsNames.push_back("VK_KHR_get_physical_device_properties2");
+    context.configure();
+    Runner* runner = context.getRunner();
+    Shader shader(runner->getVkDevice(), createModule(), "main", "nothing");
+    Buffer<uint32_t> buffer(runner, 16);
+    Task task(&shader, 1);
+    task.bind(buffer);
+    vector<Task> tasks(10, task);
+
+    SECTION("Pools are created for sets of one execution and are reused after reset")
+    {
+        runner->setPushDescriptorEnabled(false);
+        REQUIRE_FALSE(runner->isPushDescriptorEnabled());
+        DescriptorAllocator::Statistics before = runner->getDescriptorStatistics();
+        uint64_t pushedCount = runner->getPushedDescriptorSetCount();
+        runner->execute(tasks);
+        REQUIRE(runner->getDescriptorStatistics().allocationCount == before.allocationCount + 10);
+        REQUIRE(runner->getDescriptorStatistics().poolCount == before.poolCount + 3);
+        REQUIRE(runner->getDescriptorStatistics().resetCount == before.resetCount + 1);
+
+        runner->execute(tasks);
+        runner->execute(task);
+        REQUIRE(runner->getDescriptorStatistics().allocationCount == before.allocationCount + 21);
+        REQUIRE(runner->getDescriptorStatistics().poolCount == before.poolCount + 3);
+        REQUIRE(runner->getDescriptorStatistics().resetCount == before.resetCount + 3);
+        REQUIRE(runner->getPushedDescriptorSetCount() == pushedCount);
+    }
+
+    SECTION("Pushed descriptors need no sets")
+    {
+        if (!runner->isPushDescriptorSupported())
+            return;
+        runner->setPushDescriptorEnabled(true);
+        REQUIRE(runner->isPushDescriptorEnabled());
+        uint64_t allocationCount = runner->getDescriptorStatistics().allocationCount;
+        uint64_t pushedCount = runner->getPushedDescriptorSetCount();
+        runner->execute(tasks);
+        REQUIRE(runner->getPushedDescriptorSetCount() == pushedCount + 10);
+        REQUIRE(runner->getDescriptorStatistics().allocationCount == allocationCount);
+    }
+}
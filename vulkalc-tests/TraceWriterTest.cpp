@@ -0,0 +1,130 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <TraceWriter.hpp>
+#include <Context.hpp>
+#include <Buffer.hpp>
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace Vulkalc;
+using namespace std;
+
+static string readFile(const char* path)
+{
+    ifstream file(path);
+    stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+TEST_CASE("TraceWriter writes spans in Chrome trace event format")
+{
+    const char* path = "vulkalc-test-trace.json";
+    {
+        TraceWriter writer(path);
+        writer.setTrackName(1, "Queue 0");
+        double begin = writer.now();
+        writer.addSpan("record", "host", begin, begin + 10.0, 0);
+        writer.addSpan("histogram", "device", begin + 20.0, begin + 25.5, 1);
+        writer.flush();
+        REQUIRE(writer.getWrittenCount() == 2);
+        REQUIRE(readFile(path).find("\"name\":\"histogram\",\"cat\":\"device\",\"ph\":\"X\"") != string::npos);
+    }
+
+    string trace = readFile(path);
+    remove(path);
+    REQUIRE(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") == 0);
+    REQUIRE(trace.find("\"dur\":10.000,\"pid\":1,\"tid\":0}") != string::npos);
+    REQUIRE(trace.find("\"dur\":5.500,\"pid\":1,\"tid\":1}") != string::npos);
+    REQUIRE(trace.find("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Queue 0\"}}")
+            != string::npos);
+    REQUIRE(trace.substr(trace.size() - 4) == "\n]}\n");
+}
+
+TEST_CASE("TraceWriter requires writable file")
+{
+    REQUIRE_THROWS_AS(TraceWriter("vulkalc-missing-directory/trace.json"), InvalidArgumentException);
+}
+
+TEST_CASE("TraceWriter escapes names of spans")
+{
+    const char* path = "vulkalc-test-trace.json";
+    string longName(1000, 'x');
+    {
+        TraceWriter writer(path);
+        writer.setTrackName(1, "Queue \"0\"");
+        writer.addSpan("shaders\\sum \"fast\"", "device", 0.0, 1.0, 1);
+        writer.addSpan(longName.c_str(), "host", 1.0, 2.0, 0);
+    }
+
+    string trace = readFile(path);
+    remove(path);
+    REQUIRE(trace.find("{\"name\":\"shaders\\\\sum \\\"fast\\\"\",\"cat\":\"device\"") != string::npos);
+    REQUIRE(trace.find("{\"name\":\"" + longName + "\",\"cat\":\"host\",\"ph\":\"X\"") != string::npos);
+    REQUIRE(trace.find("\"args\":{\"name\":\"Queue \\\"0\\\"\"}}") != string::npos);
+    REQUIRE(trace.substr(trace.size() - 4) == "\n]}\n");
+}
+
+TEST_CASE("TraceWriter copies names of spans")
+{
+    const char* path = "vulkalc-test-trace.json";
+    {
+        TraceWriter writer(path);
+        {
+            //name of span may be freed before it's written, like name of destroyed Shader
+            string name = "shaders/destroyed.spv";
+            writer.addSpan(name.c_str(), "device", 0.0, 1.0, 1);
+            name.assign(name.size(), 'x');
+        }
+        writer.flush();
+    }
+
+    string trace = readFile(path);
+    remove(path);
+    REQUIRE(trace.find("{\"name\":\"shaders/destroyed.spv\",\"cat\":\"device\"") != string::npos);
+}
+
+TEST_CASE("Tracing doesn't change statistics of Profiler")
+{
+    const char* path = "vulkalc-test-runner-trace.json";
+    {
+        Context context;
+        Configuration* configuration = context.getConfigurator()->getConfiguration();
+        configuration->traceFile = path;
+        context.configure();
+        Runner* runner = context.getRunner();
+        REQUIRE_FALSE(runner->isProfilingEnabled());
+        Buffer<uint32_t> buffer(runner, 16);
+        runner->execute(Task::fill(buffer, 1));
+        if (runner->isProfilingSupported())
+            REQUIRE(runner->getProfiler()->getStatistics().empty());
+    }
+
+    string trace = readFile(path);
+    remove(path);
+    REQUIRE(trace.find("\"cat\":\"device\"") != string::npos);
+}
@@ -0,0 +1,126 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <TuningDatabase.hpp>
+#include <Context.hpp>
+#include <Exceptions.h>
+#include "catch.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("TuningDatabase saves and loads parameters of devices")
+{
+    const char* path = "vulkalc-test-tuning.txt";
+    remove(path);
+
+    TuningDatabase database;
+    REQUIRE_FALSE(database.load(path));
+    database.setKernelParameters("first-1", {{"histogram_float", {{"workgroupSize", 128}, {"itemsPerInvocation", 4}}}});
+    database.setKernelParameters("second-2", {{"fused_float", {{"workgroupSize", 512}}}});
+    database.save(path);
+
+    TuningDatabase loaded;
+    REQUIRE(loaded.load(path));
+    TuningDatabase::KernelParameters parameters = loaded.getKernelParameters("first-1");
+    REQUIRE(parameters.size() == 1);
+    REQUIRE(parameters["histogram_float"]["workgroupSize"] == 128);
+    REQUIRE(parameters["histogram_float"]["itemsPerInvocation"] == 4);
+    REQUIRE(loaded.getKernelParameters("second-2")["fused_float"]["workgroupSize"] == 512);
+    REQUIRE(loaded.getKernelParameters("unknown").empty());
+    remove(path);
+}
+
+TEST_CASE("TuningDatabase is saved by concurrent processes")
+{
+    const char* path = "vulkalc-test-tuning.txt";
+    TuningDatabase database;
+    database.setKernelParameters("first-1", {{"histogram_float", {{"workgroupSize", 128}}}});
+    database.save(path);
+
+    //REQUIRE isn't thread-safe, so failures are counted
+    atomic<int> failureCount(0);
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            for (int j = 0; j < 50; ++j)
+            {
+                try
+                {
+                    database.save(path);
+                    TuningDatabase loaded;
+                    if (!loaded.load(path) ||
+                        loaded.getKernelParameters("first-1")["histogram_float"]["workgroupSize"] != 128)
+                        ++failureCount;
+                }
+                catch (const Exception&)
+                {
+                    ++failureCount;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(failureCount == 0);
+    remove(path);
+}
+
+TEST_CASE("TuningDatabase rejects invalid parameters")
+{
+    const char* path = "vulkalc-test-tuning.txt";
+    TuningDatabase database;
+    REQUIRE_THROWS_AS(database.setKernelParameters("device", {{"fused_float", {{"workgroupSize", 0}}}}),
+                      InvalidArgumentException);
+    REQUIRE_THROWS_AS(database.setKernelParameters("device key", {{"fused_float", {{"workgroupSize", 64}}}}),
+                      InvalidArgumentException);
+
+    ofstream(path) << "device fused_float workgroupSize\n";
+    REQUIRE_THROWS_AS(database.load(path), InvalidArgumentException);
+    remove(path);
+}
+
+TEST_CASE("Tuning database is loaded only from configured path")
+{
+    //file with default name of autotune output doesn't break configure
+    const char* path = "vulkalc-tuning.txt";
+    ofstream(path) << "device fused_float workgroupSize\n";
+    {
+        Context context;
+        REQUIRE_NOTHROW(context.configure());
+        REQUIRE(context.getRunner()->getKernelParameters().empty());
+    }
+
+    Context context;
+    context.getConfigurator()->getConfiguration()->tuningFile = path;
+    REQUIRE_THROWS_AS(context.configure(), InvalidArgumentException);
+    remove(path);
+}
@@ -0,0 +1,232 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <Verifier.hpp>
+#include "catch.hpp"
+#include <algorithm>
+
+using namespace Vulkalc;
+using namespace std;
+
+static uint32_t instruction(uint32_t opcode, uint32_t wordCount)
+{
+    return (wordCount << 16) | opcode;
+}
+
+/*
+ * Hand-assembled module of kernel:
+ * layout(local_size_x_id = 0) in; with default 64
+ * layout(binding = 0) buffer A { float a[]; }; layout(binding = 1) buffer B { float b[]; };
+ * shared float cache[256]; layout(push_constant) uniform P { uint count; float scale; };
+ * It also declares Float64 capability. Block A is named Data and instance of B is named output
+ */
+static vector<uint32_t> createModule()
+{
+    return {
+            0x07230203, 0x00010000, 0, 40, 0,
+            instruction(17, 2), 1,
+            instruction(17, 2), 10,
+            instruction(14, 3), 0, 1,
+            instruction(15, 5), 5, 1, 0x6E69616D, 0,
+            instruction(16, 6), 1, 17, 64, 1, 1,
+            instruction(5, 4), 20, 0x61746144, 0,
+            instruction(5, 3), 22, 0,
+            instruction(5, 4), 23, 0x7074756F, 0x00007475,
+            instruction(71, 4), 10, 1, 0,
+            instruction(71, 4), 11, 11, 25,
+            instruction(71, 4), 19, 6, 4,
+            instruction(71, 3), 20, 3,
+            instruction(72, 5), 20, 0, 35, 0,
+            instruction(71, 4), 22, 34, 0,
+            instruction(71, 4), 22, 33, 0,
+            instruction(71, 4), 23, 34, 0,
+            instruction(71, 4), 23, 33, 1,
+            instruction(71, 3), 30, 2,
+            instruction(72, 5), 30, 0, 35, 0,
+            instruction(72, 5), 30, 1, 35, 4,
+            instruction(21, 4), 2, 32, 0,
+            instruction(22, 3), 3, 32,
+            instruction(23, 4), 12, 2, 3,
+            instruction(50, 4), 2, 10, 64,
+            instruction(43, 4), 2, 13, 1,
+            instruction(51, 6), 12, 11, 10, 13, 13,
+            instruction(29, 3), 19, 3,
+            instruction(30, 3), 20, 19,
+            instruction(32, 4), 21, 2, 20,
+            instruction(59, 4), 21, 22, 2,
+            instruction(59, 4), 21, 23, 2,
+            instruction(43, 4), 2, 14, 256,
+            instruction(28, 4), 15, 3, 14,
+            instruction(32, 4), 16, 4, 15,
+            instruction(59, 4), 16, 17, 4,
+            instruction(30, 4), 30, 2, 3,
+            instruction(32, 4), 31, 9, 30,
+            instruction(59, 4), 31, 32, 9,
+            instruction(54, 5), 24, 1, 0, 25
+    };
+}
+
+static VkPhysicalDeviceLimits createLimits()
+{
+    VkPhysicalDeviceLimits limits = VkPhysicalDeviceLimits();
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        limits.maxComputeWorkGroupSize[i] = 1024;
+        limits.maxComputeWorkGroupCount[i] = 65535;
+    }
+    limits.maxComputeWorkGroupInvocations = 1024;
+    limits.maxComputeSharedMemorySize = 16384;
+    limits.maxPushConstantsSize = 128;
+    limits.maxBoundDescriptorSets = 4;
+    limits.maxPerStageDescriptorStorageBuffers = 4;
+    limits.maxPerStageDescriptorUniformBuffers = 12;
+    return limits;
+}
+
+TEST_CASE("ShaderReflection parses interface of kernel")
+{
+    ShaderReflection reflection(createModule());
+    REQUIRE(reflection.hasEntryPoint());
+    REQUIRE(reflection.isCompute());
+    REQUIRE(reflection.getLocalSize(0, map<uint32_t, uint32_t>()) == 64);
+    REQUIRE(reflection.getLocalSize(0, {{0, 256}}) == 256);
+    REQUIRE(reflection.getLocalSize(1, {{0, 256}}) == 1);
+    REQUIRE(reflection.getLocalSizeSpecializationId(0) == 0);
+    REQUIRE(reflection.getLocalSizeSpecializationId(1) == ShaderReflection::NO_SPECIALIZATION);
+    REQUIRE(reflection.getSharedMemorySize(map<uint32_t, uint32_t>()) == 1024);
+    REQUIRE(reflection.getPushConstantsSize() == 8);
+    REQUIRE(reflection.getBindings().size() == 2);
+    REQUIRE(reflection.getBindings()[1].binding == 1);
+    REQUIRE(reflection.getBindings()[1].type == ShaderReflection::BINDING_STORAGE_BUFFER);
+    REQUIRE(reflection.getCapabilities() == vector<uint32_t>({1, 10}));
+    REQUIRE(reflection.getSpecializationConstants().size() == 1);
+    REQUIRE(reflection.getSpecializationConstants().at(0) == 64);
+    REQUIRE(reflection.getBindings()[0].name == "Data");
+    REQUIRE(reflection.getBindings()[1].name == "output");
+    REQUIRE(reflection.findBinding("output") == &reflection.getBindings()[1]);
+    REQUIRE(reflection.findBinding("B") == nullptr);
+
+    REQUIRE_FALSE(ShaderReflection(createModule(), "other").hasEntryPoint());
+    REQUIRE_THROWS_AS(ShaderReflection(vector<uint32_t>(5, 0)), ShaderLoadingException);
+    vector<uint32_t> truncated = createModule();
+    truncated.resize(truncated.size() - 2);
+    REQUIRE_THROWS_AS(ShaderReflection(truncated), ShaderLoadingException);
+}
+
+TEST_CASE("Verifier reports limits exceeded by kernel")
+{
+    ShaderReflection reflection(createModule());
+    VkPhysicalDeviceFeatures features = VkPhysicalDeviceFeatures();
+    features.shaderFloat64 = VK_TRUE;
+    Verifier verifier(createLimits(), features);
+    REQUIRE(verifier.verify(reflection, map<uint32_t, uint32_t>()).empty());
+
+    vector<Verifier::Diagnostic> diagnostics = verifier.verify(reflection, {{0, 2048}});
+    REQUIRE(diagnostics.size() == 2);
+    REQUIRE(diagnostics[0].code == Verifier::DIAGNOSTIC_WORKGROUP_SIZE);
+    REQUIRE(diagnostics[0].value == 2048);
+    REQUIRE(diagnostics[0].limit == 1024);
+    REQUIRE(diagnostics[1].code == Verifier::DIAGNOSTIC_WORKGROUP_INVOCATIONS);
+    REQUIRE(Verifier::describe(diagnostics) ==
+            "Workgroup size in dimension 0 2048 exceeds limit 1024; "
+            "Number of invocations in workgroup 2048 exceeds limit 1024");
+
+    VkPhysicalDeviceLimits limits = createLimits();
+    limits.maxComputeSharedMemorySize = 512;
+    limits.maxPerStageDescriptorStorageBuffers = 1;
+    diagnostics = Verifier(limits, VkPhysicalDeviceFeatures()).verify(reflection, map<uint32_t, uint32_t>());
+    REQUIRE(diagnostics.size() == 3);
+    REQUIRE(diagnostics[0].code == Verifier::DIAGNOSTIC_SHARED_MEMORY);
+    REQUIRE(diagnostics[1].code == Verifier::DIAGNOSTIC_STORAGE_BUFFERS);
+    REQUIRE(diagnostics[2].code == Verifier::DIAGNOSTIC_CAPABILITY);
+}
+
+TEST_CASE("Verifier checks buffers bound by Task")
+{
+    Shader shader(VK_NULL_HANDLE, createModule(), "main", "test");
+    Verifier verifier(createLimits(), VkPhysicalDeviceFeatures());
+    Task task(&shader, 70000);
+    vector<Verifier::Diagnostic> diagnostics = verifier.verify(task);
+    REQUIRE(diagnostics.size() == 4);
+    REQUIRE(diagnostics[0].code == Verifier::DIAGNOSTIC_CAPABILITY);
+    REQUIRE(diagnostics[1].code == Verifier::DIAGNOSTIC_GROUP_COUNT);
+    REQUIRE(diagnostics[2].code == Verifier::DIAGNOSTIC_UNBOUND_BINDING);
+    REQUIRE(diagnostics[3].code == Verifier::DIAGNOSTIC_UNBOUND_BINDING);
+    REQUIRE(verifier.verify(Task::fill(*reinterpret_cast<BufferBase*>(1), 0)).empty());
+}
+
+TEST_CASE("Task binds buffers by names of shader variables")
+{
+    Shader shader(VK_NULL_HANDLE, createModule(), "main", "test");
+    Verifier verifier(createLimits(), VkPhysicalDeviceFeatures());
+    const BufferBase& buffer = *reinterpret_cast<BufferBase*>(1);
+    Task task(&shader, 1);
+    task.bind("output", buffer, Task::ACCESS_WRITE);
+    REQUIRE(task.getBuffers().size() == 2);
+    REQUIRE(task.getBuffers()[0] == nullptr);
+    REQUIRE(task.getBuffers()[1] == &buffer);
+    REQUIRE(task.getAccesses()[1] == Task::ACCESS_WRITE);
+    vector<Verifier::Diagnostic> diagnostics = verifier.verify(task);
+    REQUIRE(diagnostics.size() == 2);
+    REQUIRE(diagnostics[1].code == Verifier::DIAGNOSTIC_UNBOUND_BINDING);
+    REQUIRE(diagnostics[1].value == 0);
+
+    task.bind("Data", buffer, Task::ACCESS_READ);
+    REQUIRE(task.getBuffers()[0] == &buffer);
+    REQUIRE(verifier.verify(task).size() == 1);
+    REQUIRE_THROWS_AS(task.bind("missing", buffer), InvalidArgumentException);
+    REQUIRE_THROWS_AS(Task::fill(buffer, 0).bind("Data", buffer), InvalidArgumentException);
+}
+
+TEST_CASE("Verifier checks shared memory with specialized array lengths")
+{
+    //length of shared cache becomes specialization constant 1 with default 256
+    vector<uint32_t> code = createModule();
+    vector<uint32_t> constant = {instruction(43, 4), 2, 14, 256};
+    auto found = search(code.begin(), code.end(), constant.begin(), constant.end());
+    REQUIRE(found != code.end());
+    *found = instruction(50, 4);
+    vector<uint32_t> decoration = {instruction(71, 4), 14, 1, 1};
+    code.insert(found, decoration.begin(), decoration.end());
+
+    ShaderReflection reflection(code);
+    REQUIRE(reflection.getSharedMemorySize(map<uint32_t, uint32_t>()) == 1024);
+    REQUIRE(reflection.getSharedMemorySize({{1, 8192}}) == 32768);
+    REQUIRE(reflection.getSpecializationConstants().at(1) == 256);
+
+    VkPhysicalDeviceFeatures features = VkPhysicalDeviceFeatures();
+    features.shaderFloat64 = VK_TRUE;
+    Verifier verifier(createLimits(), features);
+    vector<Verifier::Diagnostic> diagnostics = verifier.verify(reflection, {{1, 8192}});
+    REQUIRE(diagnostics.size() == 1);
+    REQUIRE(diagnostics[0].code == Verifier::DIAGNOSTIC_SHARED_MEMORY);
+    REQUIRE(diagnostics[0].value == 32768);
+
+    //default size exceeds limit, specialized one fits
+    VkPhysicalDeviceLimits limits = createLimits();
+    limits.maxComputeSharedMemorySize = 512;
+    Verifier smallVerifier(limits, features);
+    REQUIRE(smallVerifier.verify(reflection, map<uint32_t, uint32_t>()).size() == 1);
+    REQUIRE(smallVerifier.verify(reflection, {{1, 64}}).empty());
+}
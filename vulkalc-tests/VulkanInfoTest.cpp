@@ -0,0 +1,93 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+#include <VulkanInfo.hpp>
+#include "catch.hpp"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace Vulkalc;
+using namespace std;
+
+TEST_CASE("VulkanInfo is shared by the whole process")
+{
+    REQUIRE(VulkanInfo::getInstance() == VulkanInfo::getInstance());
+    const vector<VkExtensionProperties>& extensions = VulkanInfo::getInstance()->getInstanceExtensions();
+    REQUIRE(&VulkanInfo::getInstance()->getInstanceExtensions() == &extensions);
+    REQUIRE_FALSE(VulkanInfo::getInstance()->isLayerSupported("VK_LAYER_vulkalc_missing"));
+}
+
+TEST_CASE("VulkanInfo snapshot is saved and loaded")
+{
+    const char* path = "vulkalc-test-info.bin";
+    remove(path);
+
+    VulkanInfo info;
+    REQUIRE_FALSE(info.load(path));
+    REQUIRE(info.save(path));
+    REQUIRE_FALSE(info.isModified());
+
+    VulkanInfo loaded;
+    REQUIRE(loaded.load(path));
+    REQUIRE_FALSE(loaded.isModified());
+    REQUIRE(loaded.getInstanceExtensions().size() == info.getInstanceExtensions().size());
+    REQUIRE(loaded.getLayers().size() == info.getLayers().size());
+    REQUIRE_FALSE(loaded.isModified());
+
+    ofstream(path, ios::binary | ios::trunc) << "VKLCINFO";
+    VulkanInfo corrupted;
+    REQUIRE_FALSE(corrupted.load(path));
+    remove(path);
+}
+
+TEST_CASE("VulkanInfo snapshot is saved by concurrent processes")
+{
+    const char* path = "vulkalc-test-info.bin";
+    VulkanInfo info;
+    REQUIRE(info.save(path));
+
+    //REQUIRE isn't thread-safe, so failures are counted
+    atomic<int> failureCount(0);
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            VulkanInfo writer;
+            for (int j = 0; j < 50; ++j)
+            {
+                VulkanInfo loaded;
+                if (!writer.save(path) || !loaded.load(path))
+                    ++failureCount;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(failureCount == 0);
+    remove(path);
+}
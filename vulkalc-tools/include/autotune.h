@@ -0,0 +1,56 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file autotune.h
+ * \brief Contains autotune command declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * autotune sweeps parameters of built-in kernels on selected device and persists the fastest ones
+ * to tuning database, which is loaded by Runner on configure
+ */
+
+#pragma once
+
+#ifndef VULKALC_AUTOTUNE_H
+#define VULKALC_AUTOTUNE_H
+
+/*!
+ * \copydoc VulkalcTools
+ */
+namespace VulkalcTools
+{
+    /*!
+     * \brief Runs autotune command
+     *
+     * Usage: autotune [--device index] [--output path] [kernel...]
+     * \param argc number of arguments after command name
+     * \param argv arguments after command name
+     * \return exit code of tool
+     */
+    int runAutotune(int argc, char** argv);
+}
+
+#endif //VULKALC_AUTOTUNE_H
@@ -1,4 +1,56 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file device_info.h
+ * \brief Contains device_info command declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ *
+ * device_info prints properties and limits of every Vulkan device, which are relevant to compute,
+ * and optionally measures them with micro-probes
+ */
+
+#pragma once
+
 #ifndef VULKALC_DEVICE_INFO_H
 #define VULKALC_DEVICE_INFO_H
 
+/*!
+ * \copydoc VulkalcTools
+ */
+namespace VulkalcTools
+{
+    /*!
+     * \brief Runs device_info command
+     *
+     * Usage: device_info [--json] [--probe] [--device index] [--output path]
+     * \param argc number of arguments after command name
+     * \param argv arguments after command name
+     * \return exit code of tool
+     */
+    int runDeviceInfo(int argc, char** argv);
+}
+
 #endif //VULKALC_DEVICE_INFO_H
@@ -0,0 +1,154 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file report_writer.h
+ * \brief Contains ReportWriter class declaration
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#pragma once
+
+#ifndef VULKALC_REPORT_WRITER_H
+#define VULKALC_REPORT_WRITER_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*!
+ * \namespace VulkalcTools
+ * \brief Contains command line tools of Vulkalc
+ */
+namespace VulkalcTools
+{
+    /*!
+     * \class ReportWriter
+     * \brief Writes tree of named values either as JSON or as indented text for humans
+     */
+    class ReportWriter
+    {
+    public:
+        /*!
+         * \brief ReportWriter constructor, opens root object
+         * \param file file to write to
+         * \param isJson true to write JSON, false to write indented text
+         */
+        ReportWriter(FILE* file, bool isJson);
+
+        /*!
+         * \brief ReportWriter destructor, closes root object
+         */
+        ~ReportWriter();
+
+        /*!
+         * \brief Opens nested object
+         * \param key name of object, ignored inside arrays
+         */
+        void beginObject(const char* key = nullptr);
+
+        /*!
+         * \brief Closes last opened object
+         */
+        void endObject();
+
+        /*!
+         * \brief Opens nested array
+         * \param key name of array, ignored inside arrays
+         */
+        void beginArray(const char* key = nullptr);
+
+        /*!
+         * \brief Closes last opened array
+         */
+        void endArray();
+
+        /*!
+         * \brief Writes string value
+         * \param key name of value, ignored inside arrays
+         * \param value string
+         */
+        void write(const char* key, const std::string& value);
+
+        /*!
+         * \copydoc write(const char*, const std::string&)
+         */
+        void write(const char* key, const char* value) { write(key, std::string(value)); }
+
+        /*!
+         * \brief Writes integer value
+         * \param key name of value, ignored inside arrays
+         * \param value integer
+         */
+        void write(const char* key, uint64_t value);
+
+        /*!
+         * \copydoc write(const char*, uint64_t)
+         */
+        void write(const char* key, uint32_t value) { write(key, static_cast<uint64_t>(value)); }
+
+        /*!
+         * \brief Writes real value
+         * \param key name of value, ignored inside arrays
+         * \param value real number
+         */
+        void write(const char* key, double value);
+
+        /*!
+         * \brief Writes boolean value
+         * \param key name of value, ignored inside arrays
+         * \param value boolean
+         */
+        void write(const char* key, bool value);
+
+        /*!
+         * \brief Writes missing value, like result of probe, which can't run on device
+         * \param key name of value, ignored inside arrays
+         */
+        void writeNull(const char* key);
+
+    private:
+        ReportWriter(const ReportWriter&);
+
+        void operator=(const ReportWriter&);
+
+        void beginValue(const char* key, bool isContainer);
+
+        void writeRaw(const char* key, const std::string& text);
+
+        struct Level
+        {
+            bool isArray;
+            bool hasValues;
+        };
+
+        FILE* m_pFile;
+        bool m_isJson;
+        std::vector<Level> m_levels;
+    };
+}
+
+#endif //VULKALC_REPORT_WRITER_H
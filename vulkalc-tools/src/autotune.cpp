@@ -0,0 +1,246 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file autotune.cpp
+ * \brief Contains autotune command implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "../include/autotune.h"
+
+#include <Application.hpp>
+#include <Expression.hpp>
+#include <Histogram.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+
+using namespace Vulkalc;
+using namespace VulkalcTools;
+
+static const size_t ELEMENT_COUNT = 16 * 1024 * 1024;
+static const uint32_t BIN_COUNT = 1024;
+static const unsigned REPETITIONS = 10;
+static const uint32_t WORKGROUP_SIZES[] = {64, 128, 256, 512, 1024};
+static const uint32_t ITEMS_PER_INVOCATION[] = {1, 4, 16, 64};
+
+/*
+ * Kernel is measured by body, which runs it once on its typical workload
+ */
+struct Kernel
+{
+    const char* name;
+    std::function<void()> body;
+};
+
+static double measureMedian(unsigned repetitions, const std::function<void()>& body)
+{
+    body();
+    std::vector<double> timings;
+    for (unsigned i = 0; i < repetitions; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        timings.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(timings.begin(), timings.end());
+    return timings[timings.size() / 2];
+}
+
+static double measureKernel(Runner* runner, const Kernel& kernel, const std::map<std::string, uint32_t>& parameters)
+{
+    TuningDatabase::KernelParameters kernelParameters;
+    if (!parameters.empty())
+        kernelParameters[kernel.name] = parameters;
+    runner->setKernelParameters(kernelParameters);
+    return measureMedian(REPETITIONS, kernel.body);
+}
+
+/*
+ * Returns the fastest parameters of every selected kernel, which beat its defaults
+ */
+static TuningDatabase::KernelParameters tuneKernels(Runner* runner, const std::vector<std::string>& filters)
+{
+    std::vector<float> values(ELEMENT_COUNT);
+    for (size_t i = 0; i < ELEMENT_COUNT; ++i)
+        values[i] = static_cast<float>(i % 4096) / 4096.0f;
+    Buffer<float> floatInput(runner, ELEMENT_COUNT), floatOutput(runner, ELEMENT_COUNT);
+    floatInput.upload(values);
+    Buffer<int32_t> intInput(runner, ELEMENT_COUNT), intOutput(runner, ELEMENT_COUNT);
+    Buffer<uint32_t> uintInput(runner, ELEMENT_COUNT), uintOutput(runner, ELEMENT_COUNT);
+    Buffer<uint8_t> byteInput(runner, ELEMENT_COUNT);
+    runner->execute({Task::fill(intInput, 7), Task::fill(uintInput, 7), Task::fill(byteInput, 0x07070707)});
+    Buffer<uint32_t> bins(runner, BIN_COUNT);
+    Histogram histogram(runner, BIN_COUNT, 0.0f, 1.0f);
+    Histogram integerHistogram(runner, BIN_COUNT, 0.0f, static_cast<float>(BIN_COUNT));
+
+    std::vector<Kernel> kernels = {
+            {"histogram_float",  [&]() { histogram.compute(floatInput, bins); }},
+            {"histogram_int",    [&]() { integerHistogram.compute(intInput, bins); }},
+            {"histogram_uint",   [&]() { integerHistogram.compute(uintInput, bins); }},
+            {"histogram_bytes",  [&]() { Histogram::computeBytes(runner, byteInput, bins); }},
+            {"fused_float",      [&]() { floatOutput = floatInput * 2.0f + floatInput; }},
+            {"fused_int",        [&]() { intOutput = intInput * 2 + intInput; }},
+            {"fused_uint",       [&]() { uintOutput = uintInput * 2u + uintInput; }}
+    };
+
+    const VkPhysicalDeviceLimits& limits = runner->getPhysicalDeviceProperties().limits;
+    uint32_t maxWorkgroupSize = std::min(limits.maxComputeWorkGroupSize[0], limits.maxComputeWorkGroupInvocations);
+    TuningDatabase::KernelParameters tuned;
+    for (const Kernel& kernel : kernels)
+    {
+        if (!filters.empty() && std::find(filters.begin(), filters.end(), kernel.name) == filters.end())
+            continue;
+
+        double defaultSeconds = measureKernel(runner, kernel, std::map<std::string, uint32_t>());
+        double bestSeconds = defaultSeconds;
+        std::map<std::string, uint32_t> best;
+        for (uint32_t workgroupSize : WORKGROUP_SIZES)
+        {
+            if (workgroupSize > maxWorkgroupSize)
+                continue;
+            for (uint32_t itemsPerInvocation : ITEMS_PER_INVOCATION)
+            {
+                std::map<std::string, uint32_t> candidate = {{"workgroupSize",      workgroupSize},
+                                                             {"itemsPerInvocation", itemsPerInvocation}};
+                double seconds = measureKernel(runner, kernel, candidate);
+                if (seconds < bestSeconds)
+                {
+                    bestSeconds = seconds;
+                    best = candidate;
+                }
+            }
+        }
+
+        //defaults are kept out of database, so they still follow changes of library
+        if (best.empty())
+            printf("  %-16s default is the fastest, %.3f ms\n", kernel.name, 1e3 * defaultSeconds);
+        else
+        {
+            printf("  %-16s workgroupSize %u, itemsPerInvocation %u: %.3f ms, %.2fx of default\n", kernel.name,
+                   best["workgroupSize"], best["itemsPerInvocation"], 1e3 * bestSeconds, defaultSeconds / bestSeconds);
+            tuned[kernel.name] = best;
+        }
+    }
+    runner->setKernelParameters(TuningDatabase::KernelParameters());
+    return tuned;
+}
+
+int VulkalcTools::runAutotune(int argc, char** argv)
+{
+    int selectedDevice = -1;
+    const char* outputPath = "vulkalc-tuning.txt";
+    std::vector<std::string> filters;
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--device") == 0 && i + 1 < argc)
+            selectedDevice = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (argv[i][0] != '-')
+            filters.push_back(argv[i]);
+        else
+        {
+            fprintf(stderr, "Usage: vulkalc-tools autotune [--device index] [--output path] [kernel...]\n");
+            return 1;
+        }
+    }
+
+    //database is merged, so tuning of one device keeps entries of others
+    TuningDatabase database;
+    try
+    {
+        database.load(outputPath);
+    }
+    catch (const Exception& exception)
+    {
+        fprintf(stderr, "Failed to load %s: %s\n", outputPath, exception.what());
+        return 1;
+    }
+
+    Application* application = Application::getInstance();
+    Configuration* configuration = application->getConfigurator()->getConfiguration();
+    configuration->isLoggingEnabled = false;
+    configuration->isMetricsEnabled = false;
+    //kernels are measured with defaults and candidates only
+    configuration->tuningFile = nullptr;
+    configuration->computeQueueCount = 1;
+    if (selectedDevice >= 0)
+        configuration->deviceToUse = static_cast<uint32_t>(selectedDevice);
+    try
+    {
+        application->configure();
+    }
+    catch (const Exception& exception)
+    {
+        fprintf(stderr, "Failed to configure Application: %s\n", exception.what());
+        return 1;
+    }
+    Runner* runner = application->getRunner();
+    std::string deviceKey = runner->getDeviceKey();
+    printf("Tuning %s (%s)\n", runner->getPhysicalDeviceProperties().deviceName, deviceKey.c_str());
+
+    TuningDatabase::KernelParameters tuned;
+    try
+    {
+        tuned = tuneKernels(runner, filters);
+    }
+    catch (const Exception& exception)
+    {
+        fprintf(stderr, "Failed to tune kernels: %s\n", exception.what());
+        return 1;
+    }
+
+    //kernels, which were not tuned now, keep their previous parameters
+    TuningDatabase::KernelParameters merged = database.getKernelParameters(deviceKey);
+    //bandwidth measured by DeviceSelector isn't a kernel, so it is kept
+    if (filters.empty())
+    {
+        for (auto kernel = merged.begin(); kernel != merged.end();)
+            kernel = kernel->first == DeviceSelector::DEVICE_KERNEL ? std::next(kernel) : merged.erase(kernel);
+    }
+    for (auto& filter : filters)
+        merged.erase(filter);
+    for (auto& kernel : tuned)
+        merged[kernel.first] = kernel.second;
+    database.setKernelParameters(deviceKey, merged);
+    try
+    {
+        database.save(outputPath);
+    }
+    catch (const Exception& exception)
+    {
+        fprintf(stderr, "Failed to save %s: %s\n", outputPath, exception.what());
+        return 1;
+    }
+    printf("Saved to %s, set Configuration::tuningFile or tuning_file setting to this path to use it\n",
+           outputPath);
+    return 0;
+}
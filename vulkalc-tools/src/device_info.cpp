@@ -1,3 +1,447 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file device_info.cpp
+ * \brief Contains device_info command implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
 #include "../include/device_info.h"
+#include "../include/report_writer.h"
+
+#include <Expression.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+
+using namespace Vulkalc;
+using namespace VulkalcTools;
+
+static const size_t PROBE_BUFFER_SIZE = 64 * 1024 * 1024;
+static const unsigned PROBE_REPETITIONS = 10;
+static const unsigned DISPATCH_PROBE_REPETITIONS = 100;
+static const uint32_t FLOP_PROBE_GROUP_COUNT = 4096;
+static const uint32_t FLOP_PROBE_ITERATIONS = 256;
+//every iteration of probe makes 4 independent fused multiply-adds, 2 operations each
+static const uint32_t FLOP_PROBE_OPERATIONS_PER_ITERATION = 8;
+
+static const char* const FLOP_PROBE_SOURCE =
+        "#version 450\n"
+        "layout(local_size_x = LOCAL_SIZE) in;\n"
+        "layout(std430, binding = 0) buffer Values { float values[]; };\n"
+        "void main()\n"
+        "{\n"
+        "    uint i = gl_GlobalInvocationID.x;\n"
+        "    float a = values[i], b = a + 1.0, c = a + 2.0, d = a + 3.0;\n"
+        "    for (int j = 0; j < ITERATIONS; ++j)\n"
+        "    {\n"
+        "        a = fma(a, 0.9999, 0.0001);\n"
+        "        b = fma(b, 0.9999, 0.0001);\n"
+        "        c = fma(c, 0.9999, 0.0001);\n"
+        "        d = fma(d, 0.9999, 0.0001);\n"
+        "    }\n"
+        "    values[i] = a + b + c + d;\n"
+        "}\n";
+
+static const char* getDeviceTypeName(VkPhysicalDeviceType type)
+{
+    switch (type)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+            return "integrated";
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+            return "discrete";
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+            return "virtual";
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:
+            return "cpu";
+        default:
+            return "other";
+    }
+}
+
+static std::string formatVersion(uint32_t version)
+{
+    return std::to_string(VK_VERSION_MAJOR(version)) + "." + std::to_string(VK_VERSION_MINOR(version)) + "." +
+           std::to_string(VK_VERSION_PATCH(version));
+}
+
+static std::string formatUuid(const uint8_t* uuid)
+{
+    char text[2 * VK_UUID_SIZE + 1];
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+        snprintf(text + 2 * i, 3, "%02x", uuid[i]);
+    return text;
+}
+
+static void writeFlags(ReportWriter& writer, const char* key, uint32_t flags,
+                       const std::vector<std::pair<uint32_t, const char*>>& names)
+{
+    writer.beginArray(key);
+    for (auto& name : names)
+    {
+        if (flags & name.first)
+            writer.write(nullptr, name.second);
+    }
+    writer.endArray();
+}
+
+static void writeLimits(ReportWriter& writer, const VkPhysicalDeviceLimits& limits)
+{
+    writer.beginObject("limits");
+    writer.beginArray("maxComputeWorkGroupCount");
+    for (uint32_t count : limits.maxComputeWorkGroupCount)
+        writer.write(nullptr, count);
+    writer.endArray();
+    writer.beginArray("maxComputeWorkGroupSize");
+    for (uint32_t size : limits.maxComputeWorkGroupSize)
+        writer.write(nullptr, size);
+    writer.endArray();
+    writer.write("maxComputeWorkGroupInvocations", limits.maxComputeWorkGroupInvocations);
+    writer.write("maxComputeSharedMemorySize", limits.maxComputeSharedMemorySize);
+    writer.write("maxStorageBufferRange", limits.maxStorageBufferRange);
+    writer.write("maxPerStageDescriptorStorageBuffers", limits.maxPerStageDescriptorStorageBuffers);
+    writer.write("maxBoundDescriptorSets", limits.maxBoundDescriptorSets);
+    writer.write("maxPushConstantsSize", limits.maxPushConstantsSize);
+    writer.write("maxMemoryAllocationCount", limits.maxMemoryAllocationCount);
+    writer.write("minStorageBufferOffsetAlignment", static_cast<uint64_t>(limits.minStorageBufferOffsetAlignment));
+    writer.write("nonCoherentAtomSize", static_cast<uint64_t>(limits.nonCoherentAtomSize));
+    writer.write("timestampComputeAndGraphics", limits.timestampComputeAndGraphics == VK_TRUE);
+    writer.write("timestampPeriod", static_cast<double>(limits.timestampPeriod));
+    writer.endObject();
+}
+
+static void writeSubgroupProperties(ReportWriter& writer, VkInstance instance, VkPhysicalDevice physicalDevice,
+                                    bool isProperties2Enabled)
+{
+    //subgroup properties are reported only by Vulkan 1.1 drivers through vkGetPhysicalDeviceProperties2
+#if defined(VK_VERSION_1_1) && defined(VK_KHR_get_physical_device_properties2)
+    PFN_vkGetPhysicalDeviceProperties2KHR getProperties2 = isProperties2Enabled ?
+            reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(
+                    vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties2KHR")) : nullptr;
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    if (getProperties2 != nullptr && properties.apiVersion >= VK_MAKE_VERSION(1, 1, 0))
+    {
+        VkPhysicalDeviceSubgroupProperties subgroupProperties = {};
+        subgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
+        VkPhysicalDeviceProperties2KHR properties2 = {};
+        properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+        properties2.pNext = &subgroupProperties;
+        getProperties2(physicalDevice, &properties2);
+
+        writer.beginObject("subgroup");
+        writer.write("size", subgroupProperties.subgroupSize);
+        writer.write("supportedInCompute", (subgroupProperties.supportedStages & VK_SHADER_STAGE_COMPUTE_BIT) != 0);
+        writeFlags(writer, "operations", subgroupProperties.supportedOperations,
+                   {{VK_SUBGROUP_FEATURE_BASIC_BIT, "basic"}, {VK_SUBGROUP_FEATURE_VOTE_BIT, "vote"},
+                    {VK_SUBGROUP_FEATURE_ARITHMETIC_BIT, "arithmetic"}, {VK_SUBGROUP_FEATURE_BALLOT_BIT, "ballot"},
+                    {VK_SUBGROUP_FEATURE_SHUFFLE_BIT, "shuffle"},
+                    {VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT, "shuffle_relative"},
+                    {VK_SUBGROUP_FEATURE_CLUSTERED_BIT, "clustered"}, {VK_SUBGROUP_FEATURE_QUAD_BIT, "quad"}});
+        writer.endObject();
+        return;
+    }
+#else
+    (void) instance;
+    (void) physicalDevice;
+    (void) isProperties2Enabled;
+#endif
+    writer.writeNull("subgroup");
+}
+
+static void writeMemory(ReportWriter& writer, VkPhysicalDevice physicalDevice)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+    writer.beginArray("memoryHeaps");
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        writer.beginObject();
+        writer.write("size", static_cast<uint64_t>(memoryProperties.memoryHeaps[i].size));
+        writeFlags(writer, "flags", memoryProperties.memoryHeaps[i].flags,
+                   {{VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, "device_local"}});
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.beginArray("memoryTypes");
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+    {
+        writer.beginObject();
+        writer.write("heapIndex", memoryProperties.memoryTypes[i].heapIndex);
+        writeFlags(writer, "flags", memoryProperties.memoryTypes[i].propertyFlags,
+                   {{VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, "device_local"},
+                    {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, "host_visible"},
+                    {VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, "host_coherent"},
+                    {VK_MEMORY_PROPERTY_HOST_CACHED_BIT, "host_cached"},
+                    {VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, "lazily_allocated"}});
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+static void writeQueueFamilies(ReportWriter& writer, VkPhysicalDevice physicalDevice)
+{
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+    writer.beginArray("queueFamilies");
+    for (auto& queueFamily : queueFamilies)
+    {
+        writer.beginObject();
+        writeFlags(writer, "flags", queueFamily.queueFlags,
+                   {{VK_QUEUE_GRAPHICS_BIT, "graphics"}, {VK_QUEUE_COMPUTE_BIT, "compute"},
+                    {VK_QUEUE_TRANSFER_BIT, "transfer"}, {VK_QUEUE_SPARSE_BINDING_BIT, "sparse_binding"}});
+        writer.write("queueCount", queueFamily.queueCount);
+        writer.write("timestampValidBits", queueFamily.timestampValidBits);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+/*
+ * Returns median duration of body in seconds, after one warm up run
+ */
+static double measureMedian(unsigned repetitions, const std::function<void()>& body)
+{
+    body();
+    std::vector<double> timings;
+    for (unsigned i = 0; i < repetitions; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        timings.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(timings.begin(), timings.end());
+    return timings[timings.size() / 2];
+}
+
+/*
+ * Results of micro-probes, which are measured before anything is written, so failed probe leaves no partial output
+ */
+struct ProbeResults
+{
+    double uploadGigabytesPerSecond;
+    double downloadGigabytesPerSecond;
+    double copyGigabytesPerSecond;
+    double dispatchLatencyMicroseconds;
+    //FLOP probe is compiled at runtime, so it is measured only with VULKALC_RUNTIME_COMPILER
+    bool hasGigaflops;
+    double gigaflops;
+};
+
+/*
+ * Measures host access to mapped memory, device copy, fixed cost of dispatch and arithmetic throughput
+ */
+static ProbeResults runProbes(VkInstance instance, uint32_t deviceIndex,
+                              const std::vector<const char*>& enabledExtensions)
+{
+    Configuration configuration;
+    configuration.deviceToUse = deviceIndex;
+    configuration.computeQueueCount = 1;
+    configuration.enabledExtensionsNames = enabledExtensions;
+    Runner runner(instance, &configuration);
+
+    ProbeResults results = {};
+    {
+        std::vector<uint32_t> data(PROBE_BUFFER_SIZE / sizeof(uint32_t), 1);
+        Buffer<uint32_t> source(&runner, data.size()), destination(&runner, data.size());
+        double gigabytes = PROBE_BUFFER_SIZE / 1e9;
+        results.uploadGigabytesPerSecond = gigabytes / measureMedian(PROBE_REPETITIONS, [&]()
+        {
+            source.upload(data);
+        });
+        results.downloadGigabytesPerSecond = gigabytes / measureMedian(PROBE_REPETITIONS, [&]()
+        {
+            source.download(data.data(), data.size());
+        });
+        //copy reads and writes every byte
+        results.copyGigabytesPerSecond = 2.0 * gigabytes / measureMedian(PROBE_REPETITIONS, [&]()
+        {
+            runner.execute(Task::copy(source, destination));
+        });
+    }
+
+    Buffer<float> a(&runner, 64), b(&runner, 64);
+    Task dispatch = createExpressionTask(b, a + 1.0f);
+    results.dispatchLatencyMicroseconds = 1e6 * measureMedian(DISPATCH_PROBE_REPETITIONS, [&]()
+    {
+        runner.execute(dispatch);
+    });
+
+    results.hasGigaflops = ShaderCompiler::isCompilationSupported();
+    if (results.hasGigaflops)
+    {
+        uint32_t workgroupSize = runner.getWorkgroupSize(256);
+        Shader* shader = runner.getShaderLoader()->compile(
+                FLOP_PROBE_SOURCE, {"LOCAL_SIZE=" + std::to_string(workgroupSize),
+                                    "ITERATIONS=" + std::to_string(FLOP_PROBE_ITERATIONS)}, "flop_probe");
+        Buffer<float> values(&runner, static_cast<size_t>(FLOP_PROBE_GROUP_COUNT) * workgroupSize);
+        Task task(shader, FLOP_PROBE_GROUP_COUNT);
+        task.bind(values);
+        double operations = double(FLOP_PROBE_GROUP_COUNT) * workgroupSize * FLOP_PROBE_ITERATIONS *
+                            FLOP_PROBE_OPERATIONS_PER_ITERATION;
+        results.gigaflops = operations / 1e9 / measureMedian(PROBE_REPETITIONS, [&]() { runner.execute(task); });
+    }
+    return results;
+}
+
+static void writeProbes(ReportWriter& writer, const ProbeResults& results)
+{
+    writer.beginObject("probes");
+    writer.write("uploadGigabytesPerSecond", results.uploadGigabytesPerSecond);
+    writer.write("downloadGigabytesPerSecond", results.downloadGigabytesPerSecond);
+    writer.write("copyGigabytesPerSecond", results.copyGigabytesPerSecond);
+    writer.write("dispatchLatencyMicroseconds", results.dispatchLatencyMicroseconds);
+    if (results.hasGigaflops)
+        writer.write("gigaflops", results.gigaflops);
+    else
+        writer.writeNull("gigaflops");
+    writer.endObject();
+}
+
+int VulkalcTools::runDeviceInfo(int argc, char** argv)
+{
+    bool isJson = false;
+    bool isProbing = false;
+    int selectedDevice = -1;
+    const char* outputPath = nullptr;
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+            isJson = true;
+        else if (strcmp(argv[i], "--probe") == 0)
+            isProbing = true;
+        else if (strcmp(argv[i], "--device") == 0 && i + 1 < argc)
+            selectedDevice = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+        else
+        {
+            fprintf(stderr, "Usage: vulkalc-tools device_info [--json] [--probe] [--device index] [--output path]\n");
+            return 1;
+        }
+    }
+
+    //subgroup properties and push descriptors need this instance extension
+    std::vector<const char*> enabledExtensions;
+    uint32_t extensionCount = 0;
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, extensions.data());
+    for (auto& extension : extensions)
+    {
+        if (strcmp(extension.extensionName, "VK_KHR_get_physical_device_properties2") == 0)
+            enabledExtensions.push_back("VK_KHR_get_physical_device_properties2");
+    }
+
+    VkApplicationInfo applicationInfo = {};
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = "vulkalc-tools";
+    applicationInfo.apiVersion = VK_MAKE_VERSION(1, 0, 39);
+    VkInstanceCreateInfo instanceCreateInfo = {};
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+    instanceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(enabledExtensions.size());
+    instanceCreateInfo.ppEnabledExtensionNames = enabledExtensions.data();
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(&instanceCreateInfo, nullptr, &instance);
+    if (result != VK_SUCCESS)
+    {
+        fprintf(stderr, "Failed to create VkInstance: %d\n", result);
+        return 1;
+    }
+
+    uint32_t deviceCount = 0;
+    vkEnumeratePhysicalDevices(instance, &deviceCount, nullptr);
+    std::vector<VkPhysicalDevice> physicalDevices(deviceCount);
+    vkEnumeratePhysicalDevices(instance, &deviceCount, physicalDevices.data());
 
+    FILE* file = outputPath ? fopen(outputPath, "w") : stdout;
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Failed to open %s\n", outputPath);
+        vkDestroyInstance(instance, nullptr);
+        return 1;
+    }
+    int exitCode = 0;
+    {
+        ReportWriter writer(file, isJson);
+        writer.write("instanceApiVersion", formatVersion(applicationInfo.apiVersion));
+        writer.beginArray("devices");
+        for (uint32_t i = 0; i < deviceCount; ++i)
+        {
+            if (selectedDevice >= 0 && static_cast<uint32_t>(selectedDevice) != i)
+                continue;
 
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(physicalDevices[i], &properties);
+            VkPhysicalDeviceFeatures features;
+            vkGetPhysicalDeviceFeatures(physicalDevices[i], &features);
+            writer.beginObject();
+            writer.write("index", i);
+            writer.write("name", properties.deviceName);
+            writer.write("type", getDeviceTypeName(properties.deviceType));
+            writer.write("vendorId", properties.vendorID);
+            writer.write("deviceId", properties.deviceID);
+            writer.write("apiVersion", formatVersion(properties.apiVersion));
+            writer.write("driverVersion", properties.driverVersion);
+            writer.write("pipelineCacheUuid", formatUuid(properties.pipelineCacheUUID));
+            writeLimits(writer, properties.limits);
+            writeSubgroupProperties(writer, instance, physicalDevices[i], !enabledExtensions.empty());
+            writer.beginObject("features");
+            writer.write("shaderFloat64", features.shaderFloat64 == VK_TRUE);
+            writer.write("shaderInt64", features.shaderInt64 == VK_TRUE);
+            writer.write("shaderInt16", features.shaderInt16 == VK_TRUE);
+            writer.endObject();
+            writeMemory(writer, physicalDevices[i]);
+            writeQueueFamilies(writer, physicalDevices[i]);
+            if (isProbing)
+            {
+                try
+                {
+                    writeProbes(writer, runProbes(instance, i, enabledExtensions));
+                }
+                catch (Exception& e)
+                {
+                    //other devices are still probed
+                    fprintf(stderr, "Probes failed on %s: %s\n", properties.deviceName, e.what());
+                    exitCode = 1;
+                }
+            }
+            writer.endObject();
+        }
+        writer.endArray();
+    }
+    if (outputPath)
+        fclose(file);
+    vkDestroyInstance(instance, nullptr);
+    return exitCode;
+}
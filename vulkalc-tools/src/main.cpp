@@ -0,0 +1,70 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file main.cpp
+ * \brief Contains entry point of vulkalc-tools, which dispatches commands
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "../include/autotune.h"
+#include "../include/device_info.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace VulkalcTools;
+
+/*
+ * Command receives arguments, which follow its name
+ */
+struct Command
+{
+    const char* name;
+    int (* run)(int argc, char** argv);
+    const char* description;
+};
+
+static const Command COMMANDS[] = {
+        {"device_info", runDeviceInfo, "print compute properties and limits of devices, optionally measure them"},
+        {"autotune",    runAutotune,   "sweep parameters of built-in kernels and save the fastest ones for device"}
+};
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2)
+    {
+        for (const Command& command : COMMANDS)
+        {
+            if (strcmp(argv[1], command.name) == 0)
+                return command.run(argc - 2, argv + 2);
+        }
+    }
+
+    fprintf(stderr, "Usage: vulkalc-tools <command> [options]\nCommands:\n");
+    for (const Command& command : COMMANDS)
+        fprintf(stderr, "  %-16s %s\n", command.name, command.description);
+    return 1;
+}
@@ -0,0 +1,151 @@
+/*
+* The MIT License (MIT)
+*
+* Copyright (c) 2017 Lev Sizov
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+/*!
+ * \file report_writer.cpp
+ * \brief Contains ReportWriter class implementation
+ * \author Lev Sizov
+ * \date 19.10.2026
+ */
+
+#include "../include/report_writer.h"
+
+#include <Utilities.h>
+
+using namespace VulkalcTools;
+
+static std::string quoteJson(const std::string& text)
+{
+    return "\"" + Vulkalc::escapeJson(text) + "\"";
+}
+
+ReportWriter::ReportWriter(FILE* file, bool isJson) : m_pFile(file), m_isJson(isJson)
+{
+    if (m_isJson)
+        fprintf(m_pFile, "{");
+    Level root = {false, false};
+    m_levels.push_back(root);
+}
+
+ReportWriter::~ReportWriter()
+{
+    while (m_levels.size() > 1)
+    {
+        if (m_levels.back().isArray)
+            endArray();
+        else
+            endObject();
+    }
+    if (m_isJson)
+        fprintf(m_pFile, "\n}\n");
+    fflush(m_pFile);
+}
+
+void ReportWriter::beginValue(const char* key, bool isContainer)
+{
+    //text output indents values by depth, JSON output separates them with commas
+    Level& level = m_levels.back();
+    size_t depth = m_levels.size() - 1;
+    if (m_isJson)
+    {
+        fprintf(m_pFile, "%s\n%*s", level.hasValues ? "," : "", static_cast<int>(depth * 2 + 2), "");
+        if (!level.isArray)
+            fprintf(m_pFile, "%s: ", quoteJson(key ? key : "").c_str());
+    }
+    else
+    {
+        fprintf(m_pFile, "%*s", static_cast<int>(depth * 2), "");
+        //containers start on next line, so their first line doesn't end with space
+        if (level.isArray)
+            fprintf(m_pFile, isContainer ? "-" : "- ");
+        else
+            fprintf(m_pFile, isContainer ? "%s:" : "%s: ", key ? key : "");
+    }
+    level.hasValues = true;
+}
+
+void ReportWriter::writeRaw(const char* key, const std::string& text)
+{
+    beginValue(key, false);
+    fprintf(m_pFile, m_isJson ? "%s" : "%s\n", text.c_str());
+}
+
+void ReportWriter::beginObject(const char* key)
+{
+    beginValue(key, true);
+    fprintf(m_pFile, m_isJson ? "{" : "\n");
+    Level level = {false, false};
+    m_levels.push_back(level);
+}
+
+void ReportWriter::endObject()
+{
+    bool hasValues = m_levels.back().hasValues;
+    m_levels.pop_back();
+    if (m_isJson)
+        fprintf(m_pFile, hasValues ? "\n%*s}" : "}", static_cast<int>(m_levels.size() * 2), "");
+}
+
+void ReportWriter::beginArray(const char* key)
+{
+    beginValue(key, true);
+    fprintf(m_pFile, m_isJson ? "[" : "\n");
+    Level level = {true, false};
+    m_levels.push_back(level);
+}
+
+void ReportWriter::endArray()
+{
+    bool hasValues = m_levels.back().hasValues;
+    m_levels.pop_back();
+    if (m_isJson)
+        fprintf(m_pFile, hasValues ? "\n%*s]" : "]", static_cast<int>(m_levels.size() * 2), "");
+}
+
+void ReportWriter::write(const char* key, const std::string& value)
+{
+    writeRaw(key, m_isJson ? quoteJson(value) : value);
+}
+
+void ReportWriter::write(const char* key, uint64_t value)
+{
+    writeRaw(key, std::to_string(static_cast<unsigned long long>(value)));
+}
+
+void ReportWriter::write(const char* key, double value)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%.6g", value);
+    writeRaw(key, text);
+}
+
+void ReportWriter::write(const char* key, bool value)
+{
+    writeRaw(key, value ? "true" : "false");
+}
+
+void ReportWriter::writeNull(const char* key)
+{
+    writeRaw(key, m_isJson ? "null" : "n/a");
+}